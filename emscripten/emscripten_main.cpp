@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iostream>
 #include <sstream>
+#include <string.h>
 #include <string>
 #include <vector>
 
@@ -50,9 +51,14 @@ const char *vrvToolkit_getVersion(Toolkit *tk)
     return tk->GetCString();
 }
 
-int vrvToolkit_getPageCount(Toolkit *tk)
+int vrvToolkit_getPageCount(Toolkit *tk, bool estimate)
 {
-    return tk->GetPageCount();
+    return tk->GetPageCount(estimate);
+}
+
+bool vrvToolkit_isCastOffPending(Toolkit *tk)
+{
+    return tk->IsCastOffPending();
 }
 
 int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId)
@@ -68,7 +74,7 @@ double vrvToolkit_getTimeForElement(Toolkit *tk, const char *xmlId)
 bool vrvToolkit_loadData(Toolkit *tk, const char *data)
 {
     tk->ResetLogBuffer();
-    return tk->LoadData(data);
+    return tk->LoadData(data, strlen(data));
 }
 
 const char *vrvToolkit_getMEI(Toolkit *tk, int page_no, bool score_based)
@@ -103,6 +109,12 @@ const char *vrvToolkit_getElementsAtTime(Toolkit *tk, int millisec)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementChangesBetweenTimes(Toolkit *tk, int startMillisec, int endMillisec)
+{
+    tk->SetCString(tk->GetElementChangesBetweenTimes(startMillisec, endMillisec));
+    return tk->GetCString();
+}
+
 void vrvToolkit_setOptions(Toolkit *tk, const char *options)
 {
     if (!tk->ParseOptions(options)) {
@@ -18,6 +18,9 @@ verovio.vrvToolkit.edit = Module.cwrap('vrvToolkit_edit', 'number', ['number', '
 // char *getElementsAtTime(Toolkit *ic, int time )
 verovio.vrvToolkit.getElementsAtTime = Module.cwrap('vrvToolkit_getElementsAtTime', 'string', ['number', 'number']);
 
+// char *getElementChangesBetweenTimes(Toolkit *ic, int startTime, int endTime )
+verovio.vrvToolkit.getElementChangesBetweenTimes = Module.cwrap('vrvToolkit_getElementChangesBetweenTimes', 'string', ['number', 'number', 'number']);
+
 // char *getElementAttr(Toolkit *ic, const char *xmlId )
 verovio.vrvToolkit.getElementAttr = Module.cwrap('vrvToolkit_getElementAttr', 'string', ['number', 'string']);
 
@@ -30,8 +33,11 @@ verovio.vrvToolkit.getMEI = Module.cwrap('vrvToolkit_getMEI', 'string', ['number
 // char *getHumdrum(Toolkit *ic)
 verovio.vrvToolkit.getHumdrum = Module.cwrap('vrvToolkit_getHumdrum', 'string');
 
-// int getPageCount(Toolkit *ic)
-verovio.vrvToolkit.getPageCount = Module.cwrap('vrvToolkit_getPageCount', 'number', ['number']);
+// int getPageCount(Toolkit *ic, int estimate)
+verovio.vrvToolkit.getPageCount = Module.cwrap('vrvToolkit_getPageCount', 'number', ['number', 'number']);
+
+// bool isCastOffPending(Toolkit *ic)
+verovio.vrvToolkit.isCastOffPending = Module.cwrap('vrvToolkit_isCastOffPending', 'number', ['number']);
 
 // int getPageWithElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getPageWithElement = Module.cwrap('vrvToolkit_getPageWithElement', 'number', ['number', 'string']);
@@ -100,6 +106,10 @@ verovio.toolkit.prototype.getElementsAtTime = function (millisec) {
 	return JSON.parse(verovio.vrvToolkit.getElementsAtTime(this.ptr, millisec));
 };
 
+verovio.toolkit.prototype.getElementChangesBetweenTimes = function (startMillisec, endMillisec) {
+	return JSON.parse(verovio.vrvToolkit.getElementChangesBetweenTimes(this.ptr, startMillisec, endMillisec));
+};
+
 verovio.toolkit.prototype.getLog = function () {
 	return verovio.vrvToolkit.getLog(this.ptr);
 };
@@ -112,8 +122,12 @@ verovio.toolkit.prototype.getHumdrum = function () {
 	return verovio.vrvToolkit.getHumdrum(this.ptr);
 };
 
-verovio.toolkit.prototype.getPageCount = function () {
-	return verovio.vrvToolkit.getPageCount(this.ptr);
+verovio.toolkit.prototype.getPageCount = function (estimate) {
+	return verovio.vrvToolkit.getPageCount(this.ptr, estimate ? 1 : 0);
+};
+
+verovio.toolkit.prototype.isCastOffPending = function () {
+	return verovio.vrvToolkit.isCastOffPending(this.ptr) ? true : false;
 };
 
 verovio.toolkit.prototype.getPageWithElement = function (xmlId) {
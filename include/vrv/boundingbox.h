@@ -262,6 +262,54 @@ private:
     static int s_deCasteljau[4][4];
 };
 
+//----------------------------------------------------------------------------
+// BoundingBoxIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class indexes bounding boxes by their horizontal content position.
+ * The boxes are grouped by the bit length of their width and sorted by their left position within each group.
+ * Looking for the boxes overlapping horizontally with another one needs one binary search per group.
+ */
+class BoundingBoxIndex {
+public:
+    /**
+     * @name Constructors, destructors, reset methods
+     */
+    ///@{
+    BoundingBoxIndex() { m_count = 0; }
+    virtual ~BoundingBoxIndex(){};
+    void Clear();
+    ///@}
+
+    /**
+     * Add a box to the index.
+     * The horizontal content position of the box is not expected to change once it has been added.
+     */
+    void Add(BoundingBox *box);
+
+    /**
+     * Fill overlaps with the boxes overlapping horizontally with the box (see BoundingBox::HorizontalContentOverlap).
+     * The boxes are given in the order they were added to the index.
+     */
+    void FindHorizontalContentOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes &overlaps) const;
+
+private:
+    //
+public:
+    //
+private:
+    /**
+     * The number of boxes added, for keeping their order
+     */
+    int m_count;
+
+    /**
+     * The boxes (with the order they were added) by left position, one multimap for each width bit length
+     */
+    std::vector<std::multimap<int, std::pair<int, BoundingBox *> > > m_groups;
+};
+
 } // namespace vrv
 
 #endif
@@ -8,9 +8,16 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "scoredef.h"
 #include "style.h"
+#include "vrv.h"
 
 class MidiFile;
 
@@ -18,6 +25,8 @@ namespace vrv {
 
 class FontInfo;
 class Glyph;
+class Measure;
+class Note;
 class Page;
 class Score;
 
@@ -58,6 +67,33 @@ public:
      */
     virtual void Refresh();
 
+    /**
+     * Overridden for invalidating the time index whenever the content of the document changes.
+     */
+    virtual void Modify(bool modified = true);
+
+    /**
+     * @name Methods for the uuid index of the document.
+     * The index is built when an object is first looked up and then kept up-to-date when children are added or
+     * removed (see Object::AddToDocUuidIndex) and when uuids change (called by Object::SetUuid). It is rebuilt only
+     * when this cannot be done, i.e., when a uuid appears more than once in the document.
+     * GetIndexedObject returns the first object with the uuid in the document (including hidden editorial content).
+     * When compiling with UUID_INDEX_CHECK, the object is checked against the one found by the Object::FindByUuid
+     * functor.
+     */
+    ///@{
+    Object *GetIndexedObject(const std::string &uuid);
+    void AddToUuidIndex(Object *object);
+    void RemoveFromUuidIndex(Object *object);
+    void UpdateUuidIndex(Object *object, const std::string &previousUuid);
+    ///@}
+
+    /**
+     * Return the random number generator for the uuids of the objects of the document.
+     * The Toolkit selects it for the thread it runs in with Object::SetCurrentUuidGenerator.
+     */
+    std::minstd_rand *GetUuidGenerator() { return &m_uuidGenerator; }
+
     /**
      * Generate a document scoreDef when none is provided.
      * This only looks at the content first system of the document.
@@ -89,6 +125,12 @@ public:
     */
     int GetPageCount() const;
 
+    /**
+     * Get the page count estimated from the number of objects per page cast off so far when the document is being
+     * cast off lazily (see Doc::CastOffDocLazily), or the page count otherwise.
+     */
+    int GetEstimatedPageCount() const;
+
     bool GetMidiExportDone() const;
 
     /**
@@ -129,7 +171,7 @@ public:
 
     /**
      * @name Get the height or width for a glyph taking into account the staff and grace sizes
-     * (no const because the size of the member font is changed)
+     * The font returned is a thread-local one whose size is changed at every call
      */
     ///@{
     FontInfo *GetDrawingSmuflFont(int staffSize, bool graceSize);
@@ -201,6 +243,21 @@ public:
     bool GetEvenSpacing() const { return m_drawingEvenSpacing; }
     ///@}
 
+    /*
+     * @name Setter and getter for the number of threads laying out the measures of a page concurrently.
+     * The layout is sequential with one thread, which is the default.
+     */
+    ///@{
+    void SetLayoutThreads(int layoutThreads) { m_layoutThreads = layoutThreads; }
+    int GetLayoutThreads() const { return m_layoutThreads; }
+    ///@}
+
+    /**
+     * Return the pool of the layout threads (NULL with one thread).
+     * The threads are started once and kept from one page and one layout to the next while their number is the same.
+     */
+    ThreadPool *GetLayoutThreadPool();
+
     /*
      * @name Setter and getter for linear and non-linear spacing parameters
      */
@@ -214,9 +271,22 @@ public:
     /**
      * Export the document to a MIDI file.
      * Run trough all the layer and fill the midi file content.
+     * The time index of the notes is built at the end.
      */
     void ExportMIDI(MidiFile *midiFile);
 
+    /**
+     * @name Methods for the time index of the notes, built from their playing onset and offset.
+     * The index is rebuilt lazily when a time is looked up after the content of the document was modified.
+     * FindNotesAtTime fills the notes being played at a time, i.e., with an onset before and an offset after it.
+     * FindNotesChangingBetweenTimes fills the notes with an onset or an offset in [startTime, endTime).
+     * The notes are in the order of the document. ExportMIDI must have been called before.
+     */
+    ///@{
+    void FindNotesAtTime(double time, ArrayOfObjects *notes);
+    void FindNotesChangingBetweenTimes(double startTime, double endTime, ArrayOfObjects *notes);
+    ///@}
+
     /**
      * Set the initial scoreDef of each page.
      * This is necessary for integrating changes that occur within a page.
@@ -225,6 +295,14 @@ public:
      */
     void CollectScoreDefs(bool force = false);
 
+    /**
+     * Set the scoreDefs again from the page at pageIdx to the last one only, starting with the scoreDef at the
+     * beginning of the page (e.g., the one of the page it replaces). The pages before are left unchanged, including
+     * the cautionary scoreDef of the last measure before, which is expected to be set already.
+     * See Doc::CastOffDocUpTo
+     */
+    void CollectScoreDefsFrom(int pageIdx, const ScoreDef &pageScoreDef);
+
     /**
      * Prepare the document for drawing.
      * This sets drawing pointers and value and needs to be done after loading and any editing.
@@ -232,12 +310,64 @@ public:
      */
     void PrepareDrawing();
 
+    /**
+     * Match the time spanning elements of the measures from start to end and set them as running to the staves, as
+     * PrepareDrawing does for the entire document. This is for an element added to the start measure.
+     * Return false if the end measure does not follow the start measure (nothing is done).
+     */
+    bool PrepareMeasuresTimeSpanning(Measure *startMeasure, Measure *endMeasure);
+
+    /**
+     * Prepare the document for drawing pages concurrently.
+     * This fills linkedPages with, for each page, true if it is linked to the next one by a spanning element
+     * (slur, tie, ending, etc.). Linked pages need to be drawn in the same thread since the spanning element and its
+     * drawing values are shared by these pages.
+     * The layout of the pages must have been done.
+     */
+    void PrepareParallelDrawing(std::vector<bool> &linkedPages);
+
     /**
      * Casts off the entire document.
      * Starting from a single system, create and fill pages and systems.
      */
     void CastOffDoc();
 
+    /**
+     * Casts off the document lazily.
+     * Nothing is cast off until pages are requested with Doc::CastOffDocUpTo. Until then, the content not cast off
+     * remains in the last page of the document with one single system.
+     */
+    void CastOffDocLazily();
+
+    /**
+     * Casts off the pages of a lazily cast off document up to the page at pageIdx (-1 for the entire document).
+     * Chunks of the remaining content are cast off until the page is complete, which is the case once it is followed
+     * by another page. Does nothing if the document is not being cast off lazily.
+     */
+    void CastOffDocUpTo(int pageIdx);
+
+    /**
+     * Return true if the document is being cast off lazily and not entirely cast off yet.
+     */
+    bool IsCastOffPending() const { return m_castOffPending; }
+
+    /**
+     * Casts off the document again after it has been edited.
+     * Only the pages from the first one marked with Doc::SetCastOffModified are cast off again. This stops as soon
+     * as the page and system breaks are the same as before the edition, the following pages being kept.
+     * The entire document is cast off again if nothing was marked or if the page size, the spacing, the font or the
+     * longest duration changed.
+     */
+    void RedoCastOffDoc();
+
+    /**
+     * Mark the page of an edited object as to be cast off again by Doc::RedoCastOffDoc.
+     * Objects outside the pages (e.g., in the scoreDef of the document) mark all of them. Editing a scoreDef or a
+     * staffDef (or their content), a clef, a key signature, a meter signature or a mensur changes the following pages
+     * too, which are then all marked.
+     */
+    void SetCastOffModified(Object *object);
+
     /**
      * Undo the cast off of the entire document.
      * The document will then contain one single page with one single system.
@@ -311,6 +441,43 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * Rebuild the uuid index by processing the entire document.
+     */
+    void BuildUuidIndex();
+
+    /**
+     * Rebuild the time index of the notes from their playing onset and offset.
+     */
+    void BuildTimeIndex();
+
+    /**
+     * Return the first of the positions sorted by onset (or by offset) with an onset (or offset) not before the time.
+     */
+    std::vector<int>::iterator FindFirstPositionAt(std::vector<int> &positions, double time, bool byOffset);
+
+    /**
+     * Process the staves of a staff/layer processing list with the filters (e.g., the layer @n).
+     * This replaces a filtered processing of the entire document when processing layer by layer.
+     * The end functor is called on the document once all the staves have been processed.
+     */
+    void ProcessLayerStaves(const ArrayOfObjects &staves, Functor *functor, FunctorParams *functorParams,
+        Functor *endFunctor, ArrayOfAttComparisons *filters);
+
+    /**
+     * Return the longest actual duration (DUR_*) in the document, which the spacing by duration is based on.
+     */
+    int GetLongestActualDur();
+
+    /**
+     * Cast off the content page (one single system) at pageIdx into pages appended to the document.
+     * The content page has to be the last page. For the first page, the system breaks take into account the
+     * labels of the first system. The longest duration is the one of the entire document.
+     * With a page scoreDef, the scoreDefs are set again only from the content page (see Doc::CollectScoreDefsFrom)
+     * instead of in the entire document.
+     */
+    void CastOffContentPage(int pageIdx, int longestActualDur, const ScoreDef *pageScoreDef = NULL);
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -341,6 +508,10 @@ public:
     bool m_drawingJustifyX;
     /** flag for disabling spacing by duration */
     bool m_drawingEvenSpacing;
+    /** number of threads for the layout of the measures */
+    int m_layoutThreads;
+    /** the pool of the layout threads (owned) */
+    ThreadPool *m_layoutThreadPool;
     /** value of the linear spacing factor */
     double m_drawingSpacingLinear;
     /** value of the non linear spacing factor */
@@ -394,10 +565,6 @@ private:
     int m_drawingSmuflFontSize;
     /** Lyric font size  */
     int m_drawingLyricFontSize;
-    /** Current music font */
-    FontInfo m_drawingSmuflFont;
-    /** Current lyric font */
-    FontInfo m_drawingLyricFont;
 
     /**
      * A flag to indicate whether the currentScoreDef has been set or not.
@@ -433,10 +600,67 @@ private:
     /** System minimal spacing (MEI scoredef@spacing.system) - currently not saved */
     short m_spacingSystem;
 
+    /**
+     * The first and last pages to be cast off again (-1 if none) and the system width, page height, longest
+     * duration, spacing and font with which the document was cast off (system width VRV_UNSET if not cast off).
+     * See Doc::RedoCastOffDoc
+     */
+    ///@{
+    int m_castOffFirstModifiedPage;
+    int m_castOffLastModifiedPage;
+    int m_castOffSystemWidth;
+    int m_castOffPageHeight;
+    int m_castOffLongestActualDur;
+    short m_castOffSpacingStaff;
+    short m_castOffSpacingSystem;
+    bool m_castOffEvenSpacing;
+    double m_castOffSpacingLinear;
+    double m_castOffSpacingNonLinear;
+    Resources::LoadedFont *m_castOffFont;
+    ///@}
+
+    /**
+     * True when the last page of the document contains the content still to be cast off, and the number of
+     * objects of the content per page estimated for the size of the chunks cast off.
+     * See Doc::CastOffDocLazily
+     */
+    ///@{
+    bool m_castOffPending;
+    int m_castOffPageObjectCount;
+    ///@}
+
     /**
      * A score buffer for loading or creating a scoreBased MEI.
      */
     Score *m_scoreBuffer;
+
+    /**
+     * The uuid index of the document, the uuids appearing more than once, and a flag indicating if it is up-to-date.
+     * See Doc::GetIndexedObject
+     */
+    ///@{
+    std::unordered_map<std::string, Object *> m_uuidIndex;
+    std::unordered_set<std::string> m_duplicatedUuids;
+    bool m_uuidIndexIsValid;
+    ///@}
+
+    /**
+     * The random number generator for the uuids, seeded randomly unless seeded with Object::SeedUuid once selected.
+     */
+    std::minstd_rand m_uuidGenerator;
+
+    /**
+     * The time index of the notes and a flag indicating if it is up-to-date.
+     * m_timeIndexNotes is in the order of the document. m_notesByOnset and m_notesByOffset hold the positions of the
+     * notes sorted by onset and by offset, and m_maxOffsets the maximum offset up to each position in m_notesByOnset.
+     */
+    ///@{
+    std::vector<Note *> m_timeIndexNotes;
+    std::vector<int> m_notesByOnset;
+    std::vector<int> m_notesByOffset;
+    std::vector<double> m_maxOffsets;
+    bool m_timeIndexIsValid;
+    ///@}
 };
 
 } // namespace vrv
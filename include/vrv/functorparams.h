@@ -795,14 +795,39 @@ public:
 // GenerateMIDIParams
 //----------------------------------------------------------------------------
 
+/**
+ * The state of a staff/layer when generating the MIDI output of all the layers in one pass.
+ * The notes are buffered and added to the MidiFile once the document has been processed,
+ * staff/layer by staff/layer, so the order of the events in the tracks does not depend on the processing order.
+ */
+
+class MIDILayerTrack {
+public:
+    MIDILayerTrack()
+    {
+        m_midiTrack = 1;
+        m_transSemi = 0;
+        m_currentMeasureTime = 0.0;
+    }
+    /** A note buffered with its pitch, onset and offset */
+    struct MIDINote {
+        int m_pitch;
+        double m_onset;
+        double m_offset;
+    };
+    int m_midiTrack;
+    int m_transSemi;
+    double m_currentMeasureTime;
+    std::vector<MIDINote> m_notes;
+};
+
 /**
  * member 0: MidiFile*: the MidiFile we are writing to
- * member 1: int*: the midi track number
- * member 2: int*: the current time in the measure (incremented by each element)
- * member 3: int*: the current total measure time (incremented by each measure
- * member 4: std::vector<double>: a stack of maximum duration filled by the functor
- * member 5: int* the semi tone transposition for the current track
- * member 6: int with the current bpm
+ * member 1: double: the current total measure time (incremented by each measure
+ * member 2: std::vector<double>: a stack of maximum duration filled by the functor
+ * member 3: int with the current bpm
+ * member 4: the state of each staff/layer by @n (see MIDILayerTrack)
+ * member 5: the state of the layer being processed (NULL outside a layer)
 **/
 
 class GenerateMIDIParams : public FunctorParams {
@@ -810,19 +835,16 @@ public:
     GenerateMIDIParams(MidiFile *midiFile)
     {
         m_midiFile = midiFile;
-        m_midiTrack = 1;
-        m_currentMeasureTime = 0.0;
         m_totalTime = 0.0;
-        m_transSemi = 0;
         m_currentBpm = 120;
+        m_currentLayerTrack = NULL;
     }
     MidiFile *m_midiFile;
-    int m_midiTrack;
-    double m_currentMeasureTime;
     double m_totalTime;
     std::vector<double> m_maxValues;
-    int m_transSemi;
     int m_currentBpm;
+    std::map<std::pair<int, int>, MIDILayerTrack> m_layerTracks;
+    MIDILayerTrack *m_currentLayerTrack;
 };
 
 //----------------------------------------------------------------------------
@@ -1006,6 +1028,7 @@ public:
 /**
  * member 0: the IntTree* for staff/layer/verse
  * member 1: the IntTree* for staff/layer
+ * member 2: the staves containing each staff/layer (in document order)
 **/
 
 class PrepareProcessingListsParams : public FunctorParams {
@@ -1013,6 +1036,7 @@ public:
     PrepareProcessingListsParams() {}
     IntTree m_verseTree;
     IntTree m_layerTree;
+    std::map<std::pair<int, int>, ArrayOfObjects> m_layerStaves;
 };
 
 //----------------------------------------------------------------------------
@@ -1038,12 +1062,14 @@ public:
 
 /**
  * member 0: std::vector< Object*>* that holds the current elements to match
+ * member 1: the Doc for looking for the elements through its uuid index
  **/
 
 class PrepareTimePointingParams : public FunctorParams {
 public:
-    PrepareTimePointingParams() {}
+    PrepareTimePointingParams(Doc *doc) { m_doc = doc; }
     ArrayOfPointingInterClassIdPairs m_timePointingInterfaces;
+    Doc *m_doc;
 };
 
 //----------------------------------------------------------------------------
@@ -1053,13 +1079,21 @@ public:
 /**
  * member 0: std::vector< Object*>* that holds the current elements to match
  * member 1: bool* fillList for indicating whether the elements have to be stacked or not
+ * member 2: std::vector< Object*>* that holds the elements not matched but that cannot be matched by uuid anymore
+ * member 3: the Doc for looking for the elements through its uuid index
 **/
 
 class PrepareTimeSpanningParams : public FunctorParams {
 public:
-    PrepareTimeSpanningParams() { m_fillList = true; }
+    PrepareTimeSpanningParams(Doc *doc)
+    {
+        m_fillList = true;
+        m_doc = doc;
+    }
     ArrayOfSpanningInterClassIdPairs m_timeSpanningInterfaces;
     bool m_fillList;
+    ArrayOfSpanningInterClassIdPairs m_unmatchedInterfaces;
+    Doc *m_doc;
 };
 
 //----------------------------------------------------------------------------
@@ -1192,7 +1226,8 @@ public:
  * member 3: the previous measure (for setting cautionary scoreDef)
  * member 4: the current system (for setting the system scoreDef)
  * member 5: the flag indicating whereas full labels have to be drawn
- * member 6: the doc
+ * member 6: the flag indicating that the cautionary scoreDef of the previous measure is already set
+ * member 7: the doc
 **/
 
 class SetCurrentScoreDefParams : public FunctorParams {
@@ -1205,6 +1240,7 @@ public:
         m_previousMeasure = NULL;
         m_currentSystem = NULL;
         m_drawLabels = false;
+        m_cautionaryDone = false;
         m_doc = doc;
     }
     ScoreDef *m_currentScoreDef;
@@ -1213,6 +1249,7 @@ public:
     Measure *m_previousMeasure;
     System *m_currentSystem;
     bool m_drawLabels;
+    bool m_cautionaryDone;
     Doc *m_doc;
 };
 
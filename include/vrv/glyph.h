@@ -9,6 +9,8 @@
 #define __VRV_GLYPH_H__
 
 #include <algorithm>
+#include <iostream>
+#include <map>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -59,6 +61,25 @@ public:
     /** Get the code string */
     std::string GetCodeStr() { return m_codeStr; }
 
+    /**
+     * @name Setter and getter for the XML content of the glyph file (i.e., the <symbol>)
+     * It is set only when the glyph is loaded from the binary font cache and empty otherwise.
+     */
+    ///@{
+    const std::string &GetXML() const { return m_xml; }
+    void SetXML(const std::string &xml) { m_xml = xml; }
+    ///@}
+
+    /**
+     * @name Methods for writing and reading the glyph to and from the binary font cache.
+     * See Resources::WriteFontCache.
+     * ReadCache returns false if the input is truncated.
+     */
+    ///@{
+    void WriteCache(std::ostream &output) const;
+    bool ReadCache(std::istream &input);
+    ///@}
+
     /**
      * @name Setter and getter for the horizAdvX
      */
@@ -101,6 +122,8 @@ private:
     std::string m_path;
     /** The Unicode code in hexa as string */
     std::string m_codeStr;
+    /** The XML content of the glyph file (if loaded from the cache) */
+    std::string m_xml;
     /** A map of the available anchors */
     std::map<SMuFLGlyphAnchor, Point> m_anchors;
 };
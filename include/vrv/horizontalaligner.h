@@ -344,6 +344,13 @@ public:
 
     int GetAlignmentCount() const { return (int)m_children.size(); }
 
+    /**
+     * Do not propagate the modification to the parent.
+     * The aligners only hold layout data, so adding alignments does not modify the measure, and the uuid and time
+     * indexes of the doc are kept. This also means that the measures can be laid out concurrently.
+     */
+    virtual void Modify(bool modified = true) {}
+
     //----------//
     // Functors //
     //----------//
@@ -352,6 +359,7 @@ protected:
     /**
      * Search if an alignment of the type is already there at the time.
      * If not, return in idx the position where it needs to be inserted (-1 if it is the end)
+     * The alignments are kept ordered by time and then by type, which makes it a binary search.
      */
     Alignment *SearchAlignmentAtTime(double time, AlignmentType type, int &idx);
 
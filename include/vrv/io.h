@@ -75,6 +75,16 @@ public:
     virtual bool ImportFile() { return true; }
     virtual bool ImportString(std::string const &data) { return true; }
 
+    /**
+     * @name Import from a buffer of length bytes that does not need to be null terminated.
+     * With ImportBufferInPlace, the buffer can be modified and used by the parser without copying it.
+     * By default, the buffer is copied into a string passed to ImportString.
+     */
+    ///@{
+    virtual bool ImportBuffer(const char *data, size_t length) { return ImportString(std::string(data, length)); }
+    virtual bool ImportBufferInPlace(char *data, size_t length) { return ImportBuffer(data, length); }
+    ///@}
+
     /**
      * Getter for layoutInformation flag that is set to true during import
      * if layout information is found (and not to be ignored).
@@ -330,6 +330,57 @@ private:
     std::list<pugi::xml_node> m_nodeStack;
 };
 
+//----------------------------------------------------------------------------
+// MeiChildQuery
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an XPath query for selecting a child of <app> or <choice>, compiled once for all of them.
+ * Queries only testing the name and the attributes of the children are evaluated directly without XPath, e.g.,
+ * "./rdg[@source='#A']", "rdg[contains(@source, 'A')][@type='x']" or "*[@type='x']".
+ * Any other query is compiled as an XPath query.
+ */
+class MeiChildQuery {
+public:
+    // constructors and destructors
+    MeiChildQuery(const std::string &query);
+
+    /**
+     * Return the node selected by the query in the parent (empty if none).
+     * This is the first node in document order, as with pugi::xml_node::select_single_node.
+     */
+    pugi::xml_node Select(pugi::xml_node parent) const;
+
+    /**
+     * Return true if the query is evaluated without XPath
+     */
+    bool IsSimple() const { return m_isSimple; }
+
+private:
+    /**
+     * Parse the query as a name test with predicates on attributes.
+     * Return false if the query has another form.
+     */
+    bool ParseSimpleQuery(const std::string &query);
+
+    /**
+     * A predicate on an attribute, either [@attribute='value'] or [contains(@attribute, 'value')]
+     */
+    struct AttributePredicate {
+        std::string m_attribute;
+        std::string m_value;
+        bool m_contains;
+    };
+
+    std::string m_query;
+    bool m_isSimple;
+    /** The element name for simple queries ("*" for any) */
+    std::string m_name;
+    std::vector<AttributePredicate> m_predicates;
+    /** The compiled query for the other queries (empty if it could not be compiled) */
+    pugi::xpath_query m_xPathQuery;
+};
+
 //----------------------------------------------------------------------------
 // MeiInput
 //----------------------------------------------------------------------------
@@ -347,6 +398,8 @@ public:
 
     virtual bool ImportFile();
     virtual bool ImportString(std::string const &mei);
+    virtual bool ImportBuffer(const char *data, size_t length);
+    virtual bool ImportBufferInPlace(char *data, size_t length);
 
     /**
      * Set the xPath queries for selecting specific <rdg>.
@@ -354,13 +407,13 @@ public:
      * If one (or more) query is provided, the element matching the specified xPath
      * query will be selected (if any, otherwise the first one will be used).
      */
-    virtual void SetAppXPathQueries(std::vector<std::string> &xPathQueries) { m_appXPathQueries = xPathQueries; }
+    virtual void SetAppXPathQueries(std::vector<std::string> &xPathQueries);
 
     /**
      * Set the xPath queries for selecting <choice> children.
      * Works similarly as SetAppXPathQueries. By default, the first child is made visible
      */
-    virtual void SetChoiceXPathQueries(std::vector<std::string> &xPathQueries) { m_choiceXPathQueries = xPathQueries; }
+    virtual void SetChoiceXPathQueries(std::vector<std::string> &xPathQueries);
 
     /**
      * Set the XPath query for selecting a specific <mdiv>
@@ -575,14 +628,14 @@ private:
     MEIVersion m_version;
 
     /**
-     * A vector for storing xpath queries for selecting <app> children
+     * A vector for storing the compiled xpath queries for selecting <app> children
      */
-    std::vector<std::string> m_appXPathQueries;
+    std::vector<MeiChildQuery> m_appQueries;
 
     /**
-     * A vector the storing xpath queries for selecting <choice> children
+     * A vector the storing the compiled xpath queries for selecting <choice> children
      */
-    std::vector<std::string> m_choiceXPathQueries;
+    std::vector<MeiChildQuery> m_choiceQueries;
 
     /**
      * A string for storing the xpath query for selecting a <mdiv>
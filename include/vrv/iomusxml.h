@@ -8,6 +8,7 @@
 #ifndef __VRV_IOMUSXML_H__
 #define __VRV_IOMUSXML_H__
 
+#include <set>
 #include <string>
 #include <vector>
 
@@ -33,6 +34,7 @@ class Harm;
 class Layer;
 class LayerElement;
 class Measure;
+class MusicXmlInput;
 class Octave;
 class Pedal;
 class Section;
@@ -89,6 +91,40 @@ namespace musicxml {
         std::string m_endID;
     };
 
+    class StagedPart {
+    public:
+        StagedPart(pugi::xml_node part, int nbStaves, int staffOffset)
+        {
+            m_part = part;
+            m_nbStaves = nbStaves;
+            m_staffOffset = staffOffset;
+            m_meterCount = VRV_UNSET;
+            m_meterUnit = VRV_UNSET;
+            m_ppq = VRV_UNSET;
+            m_reader = NULL;
+            m_section = NULL;
+            m_uuidSeed = 0;
+        }
+
+        pugi::xml_node m_part;
+        int m_nbStaves;
+        int m_staffOffset;
+        /* The meter and the MIDI ticks given by the first attributes of the part (VRV_UNSET if not given) */
+        int m_meterCount;
+        int m_meterUnit;
+        int m_ppq;
+        /* The values the reader of the part starts with */
+        int m_startMeterCount;
+        int m_startMeterUnit;
+        int m_startPpq;
+        /* The reader of the part and the section in which the measures of the part are staged */
+        MusicXmlInput *m_reader;
+        Section *m_section;
+        /* The seed of the uuid generator and the log messages of the thread reading the part */
+        unsigned int m_uuidSeed;
+        std::vector<std::string> m_log;
+    };
+
 } // namespace musicxml
 
 //----------------------------------------------------------------------------
@@ -103,6 +139,14 @@ public:
 
     virtual bool ImportFile();
     virtual bool ImportString(std::string const &musicxml);
+    virtual bool ImportBuffer(const char *data, size_t length);
+    virtual bool ImportBufferInPlace(char *data, size_t length);
+
+    /**
+     * Set the number of threads for reading the parts concurrently (default is 1).
+     * Apart from the uuids generated, the output is the same as when the parts are read one after the other.
+     */
+    void SetImportThreads(int threads) { m_importThreads = threads; }
 
 private:
     /*
@@ -117,12 +161,28 @@ private:
 
     /*
      * @name Top level methods for reading MusicXml part and measure elements.
+     * The uuids of a part are generated from a seed of its own (see MusicXmlInput::GeneratePartUuidSeed), so they
+     * are the same whether the parts are read sequentially or concurrently.
      */
     ///@{
-    bool ReadMusicXmlPart(pugi::xml_node node, Section *section, int nbStaves, int staffOffset);
+    bool ReadMusicXmlPart(pugi::xml_node node, Section *section, int nbStaves, int staffOffset, unsigned int uuidSeed);
     bool ReadMusicXmlMeasure(pugi::xml_node node, Section *section, Measure *measure, int nbStaves, int staffOffset);
     ///@}
 
+    /*
+     * @name Methods for reading the parts concurrently.
+     * Each part is read by a MusicXmlInput of its own into a staging section, assuming nothing was left open by the
+     * previous part. The staging sections are then merged in the order of the parts. A part for which this does not
+     * hold (e.g., because of a direction without a following note at the end of the previous part) is discarded and
+     * read again sequentially.
+     */
+    ///@{
+    void ReadMusicXmlStagedParts(std::vector<musicxml::StagedPart> &stagedParts, Section *section);
+    bool CanMergeStagedPart(const musicxml::StagedPart &stagedPart);
+    void MergeStagedPart(musicxml::StagedPart &stagedPart, Section *section);
+    void DiscardStagedPart(musicxml::StagedPart &stagedPart);
+    ///@}
+
     /*
      * Methods for reading the first MusicXml attributes element as MEI staffDef.
      * Returns the number of staves in the part.
@@ -185,6 +245,7 @@ private:
     ///@{
     bool HasAttributeWithValue(pugi::xml_node node, std::string attribute, std::string value);
     bool IsElement(pugi::xml_node node, std::string name);
+    bool IsInFirstPart(pugi::xml_node node);
     bool HasContentWithValue(pugi::xml_node node, std::string value);
     bool HasContent(pugi::xml_node);
     ///@}
@@ -196,6 +257,7 @@ private:
     std::string GetAttributeValue(pugi::xml_node node, std::string attribute);
     std::string GetContent(pugi::xml_node node);
     std::string GetContentOfChild(pugi::xml_node node, std::string child);
+    int GetChildCount(pugi::xml_node node, std::string child);
     ///@}
 
     /*
@@ -217,7 +279,7 @@ private:
      */
     ///@{
     ///@}
-    void TextRendition(pugi::xpath_node_set words, ControlElement *element);
+    void TextRendition(const std::vector<pugi::xml_node> &words, ControlElement *element);
     void PrintMetronome(pugi::xml_node metronome, Tempo *tempo);
 
     /*
@@ -234,6 +296,12 @@ private:
     ///@}
     void GenerateUuid(pugi::xml_node node);
 
+    /*
+     * Draw the seed of the uuids of a part from the uuid generator of the current thread.
+     * The uuids of the parts are reproducible if the uuids of the current thread are.
+     */
+    unsigned int GeneratePartUuidSeed();
+
     /*
      * @name Methods for converting MusicXML string values to MEI attributes.
      */
@@ -253,12 +321,16 @@ private:
 private:
     /* The filename */
     std::string m_filename;
+    /* The number of threads for reading the parts */
+    int m_importThreads = 1;
     /* octave offset **/
     std::vector<int> m_octDis;
+    /* The staff numbers of the octave-shifts read, for merging the staged parts */
+    std::set<int> m_octaveShiftStaves;
     /* measure repeats **/
     bool m_mRpt = false;
     /* MIDI ticks */
-    int m_ppq;
+    int m_ppq = 0;
     /* meaure time */
     int m_durTotal = 0;
     /* meter signature */
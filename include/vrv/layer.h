@@ -158,6 +158,14 @@ public:
      * See Object::AdjustSylSpacing
      */
     virtual int AdjustSylSpacing(FunctorParams *functorParams);
+    /**
+     * @name See Object::GenerateMIDI
+     */
+    ///@{
+    virtual int GenerateMIDI(FunctorParams *functorParams);
+    virtual int GenerateMIDIEnd(FunctorParams *functorParams);
+    ///@}
+
     /**
      * See Object::CalcMaxMeasureDuration
      */
@@ -83,6 +83,8 @@ public:
     bool IsInLigature();
     /** Return true if the element is a note or a chord within a fTrem */
     bool IsInFTrem();
+    /** Return true if the element can be the start or the end of time pointing or spanning elements */
+    bool IsTimePointingTarget();
     /**
      * Return the beam parent if in beam
      * Look if the note or rest is in a beam.
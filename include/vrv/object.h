@@ -12,7 +12,9 @@
 #include <ctime>
 #include <iterator>
 #include <map>
+#include <random>
 #include <string>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -77,6 +79,7 @@ public:
     /**
      * @name Constructors, destructors, and other standard methods
      * Reset method resets all attribute classes
+     * The default constructor is for the layout objects (aligners and alignments), which have no uuid.
      */
     ///@{
     Object();
@@ -201,10 +204,32 @@ public:
      */
     virtual Object *Clone() const;
 
-    std::string GetUuid() const { return m_uuid; }
+    /**
+     * @name Getter and setters for the uuid.
+     */
+    ///@{
+    const std::string &GetUuid() const { return m_uuid; }
     void SetUuid(std::string uuid);
     void ResetUuid();
+    ///@}
+
+    /**
+     * @name Seed the random number generator used for the uuids and get a number from it.
+     * The generator is the one selected for the thread with SetCurrentUuidGenerator.
+     */
+    ///@{
     static void SeedUuid(unsigned int seed = 0);
+    static int GetUuidRandomNumber();
+    ///@}
+
+    /**
+     * @name Get and select the random number generator used for the uuids of the objects created by the thread.
+     * The generator is usually the one of a Doc (see Toolkit). Without one selected (NULL), the thread uses its own.
+     */
+    ///@{
+    static std::minstd_rand *GetCurrentUuidGenerator();
+    static void SetCurrentUuidGenerator(std::minstd_rand *generator);
+    ///@}
 
     std::string GetComment() const { return m_comment; }
     void SetComment(std::string comment) { m_comment = comment; }
@@ -322,7 +347,9 @@ public:
 
     /**
      * Look for a child with the specified uuid (returns NULL if not found)
-     * This method is a wrapper for the Object::FindByUuid functor.
+     * When the object belongs to a Doc and the full depth is searched forward, the uuid index
+     * of the Doc is used (see Doc::GetIndexedObject). Otherwise, this method is a wrapper for the
+     * Object::FindByUuid functor.
      */
     Object *FindChildByUuid(std::string uuid, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
@@ -402,9 +429,11 @@ public:
     bool IsModified() const { return m_isModified; }
 
     /**
-     * Mark the object and its parent (if any) as modified
+     * Mark the object and its parent (if any) as modified.
+     * This is called whenever children are added or removed. It is overridden in Doc for
+     * invalidating the time index.
      */
-    void Modify(bool modified = true);
+    virtual void Modify(bool modified = true);
 
     /**
      * @name Setter and getter of the attribute flag
@@ -918,12 +947,37 @@ protected:
      */
     void ClearChildren();
 
+    /**
+     * @name Add the uuids of a child (and of its descendants) to the uuid index of the Doc the object belongs to (if
+     * any), or remove them.
+     * To be called by AddChild once the child is added, and before a child is detached or deleted.
+     */
+    ///@{
+    void AddToDocUuidIndex(Object *child);
+    void RemoveFromDocUuidIndex(Object *child);
+    ///@}
+
 private:
     /**
      * Method for generating the uuid.
      */
     void GenerateUuid();
 
+    /**
+     * Update the uuid index of the Doc the object belongs to (if any) after a uuid change.
+     */
+    void UpdateDocUuidIndex(const std::string &previousUuid);
+
+    /**
+     * Return the Doc the object belongs to (or the object itself if it is a Doc) for updating its uuid index.
+     */
+    Doc *GetUuidIndexDoc();
+
+    /**
+     * Delete the children, with or without updating the uuid index of the Doc (not when the object is being deleted).
+     */
+    void ClearChildren(bool updateDocUuidIndex);
+
     /**
      * Initialisation method taking a uuid prefix argument.
      */
@@ -1002,11 +1056,6 @@ private:
      * For example, a Artic child in Note for an original @artic
      */
     bool m_isAttribute;
-
-    /**
-     * A static counter for uuid generation.
-     */
-    static unsigned long s_objectCounter;
 };
 
 //----------------------------------------------------------------------------
@@ -1059,6 +1108,8 @@ public:
 private:
     mutable ListOfObjects m_list;
     ListOfObjects::iterator m_iteratorCurrent;
+    /** The position of each object in m_list, filled when the list is reset if it is long enough */
+    std::unordered_map<const Object *, int> m_listIndexes;
 
 protected:
     /**
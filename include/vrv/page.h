@@ -8,6 +8,8 @@
 #ifndef __VRV_PAGE_H__
 #define __VRV_PAGE_H__
 
+#include <functional>
+
 #include "object.h"
 #include "scoredef.h"
 
@@ -17,6 +19,7 @@ class DeviceContext;
 class PrepareProcessingListsParams;
 class Staff;
 class System;
+class ThreadPool;
 
 //----------------------------------------------------------------------------
 // Page
@@ -85,9 +88,18 @@ public:
     void LayOutTranscription(bool force = false);
 
     /**
-     * Lay out the content of the page (measures and their content) horizontally
+     * Reset the layout flag so the page is laid out again when drawn.
+     * This is necessary when the scoreDefs are collected again since the staffDef drawing objects are recreated.
+     */
+    void ResetLayout() { m_layoutDone = false; }
+
+    /**
+     * Lay out the content of the page (measures and their content) horizontally.
+     * The spacing by duration uses the longest duration of the page unless another one is given.
+     * With more than one layout thread in the document, the passes working within each measure are processed
+     * concurrently on the measures (see Page::ProcessMeasures).
      */
-    void LayOutHorizontally();
+    void LayOutHorizontally(int longestActualDur = VRV_UNSET);
 
     /**
      * Justifiy the content of the page (measures and their content) horizontally
@@ -144,6 +156,15 @@ private:
      */
     void AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Doc *doc);
 
+    /**
+     * Call the process function on each measure of the list with the layout threads of the document.
+     * The threads take the next measure to process as soon as they are done with one. Since the measures are
+     * processed concurrently, the function needs to use a functor and params of its own for each measure.
+     * The second parameter of the function is true for the first measure of a system.
+     */
+    void ProcessMeasures(const ArrayOfObjects &measures, const std::vector<bool> &firstMeasures, ThreadPool *threads,
+        const std::function<void(Object *, bool)> &process);
+
     //
 public:
     /** Page width (MEI scoredef@page.width). Saved if != -1 */
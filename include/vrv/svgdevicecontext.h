@@ -8,11 +8,14 @@
 #ifndef __VRV_SVG_DC_H__
 #define __VRV_SVG_DC_H__
 
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <list>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -26,13 +29,156 @@
 namespace vrv {
 
 //----------------------------------------------------------------------------
-// BBoxDeviceContext
+// SvgStringWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class is a pugixml writer appending the output directly to a string.
+ */
+class SvgStringWriter : public pugi::xml_writer {
+public:
+    SvgStringWriter(std::string *output) { m_output = output; }
+    virtual void write(const void *data, size_t size) { m_output->append(static_cast<const char *>(data), size); }
+
+private:
+    std::string *m_output;
+};
+
+//----------------------------------------------------------------------------
+// SvgStream
+//----------------------------------------------------------------------------
+
+/**
+ * This class writes the SVG elements directly as text, formatted as pugixml would with a tab indentation.
+ * Since elements can be inserted before the <g> children of the current element, and since the <g> elements with
+ * an id can be resumed once closed, the text is kept in buffers that can be anchored at a position in another one.
+ * Buffers are needed only for these insertions and the text is otherwise written in one single buffer.
+ * The resumed elements are expected to have been closed before.
+ */
+class SvgStream {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SvgStream();
+    virtual ~SvgStream();
+    ///@}
+
+    /**
+     * Add a child element to the current element, before its first <g> child if beforeGroups is true.
+     * Attributes and text are then added to the element until another one is added.
+     */
+    void AddElement(const std::string &name, bool beforeGroups);
+    void AddAttribute(const char *name, const std::string &value);
+    void AddText(const std::string &text);
+
+    /**
+     * @name Make the element added last the current one, or close the current one.
+     */
+    ///@{
+    void PushElement();
+    void PopElement();
+    ///@}
+
+    /**
+     * @name Register the current element for resuming it with its id, or resume it.
+     * If no element is registered with the id, the current element is pushed again.
+     */
+    ///@{
+    void RegisterElement(const std::string &id);
+    void ResumeElement(const std::string &id);
+    ///@}
+
+    /**
+     * Write the content of the root element.
+     */
+    void Write(pugi::xml_writer &writer);
+
+    /**
+     * Append the text escaped as pugixml would for an attribute value or for a text.
+     */
+    static void AppendEscaped(std::string &output, const std::string &text, bool attribute);
+
+private:
+    struct Element;
+
+    /**
+     * A buffer of text, with other buffers anchored at positions in it.
+     * A buffer can also be the content of an empty element that can be resumed, written only if not empty.
+     */
+    struct Buffer {
+        std::string m_text;
+        std::vector<std::pair<size_t, Buffer *> > m_anchors;
+        const Element *m_element = NULL;
+    };
+
+    /**
+     * A position in a buffer, at its end if the offset is std::string::npos.
+     */
+    struct Cursor {
+        Buffer *m_buffer = NULL;
+        size_t m_offset = std::string::npos;
+    };
+
+    struct Element {
+        std::string m_name;
+        int m_depth = 0;
+        // the position for the children and for inserting them before the first <g> child (if any)
+        Cursor m_end;
+        Cursor m_firstGroup;
+        bool m_hasGroup = false;
+        // the start tag has not been closed yet
+        bool m_tagOpen = false;
+        bool m_resumable = false;
+        // the cursor of the parent the element was added with
+        Cursor *m_parentCursor = NULL;
+    };
+
+    struct StackItem {
+        Element *m_element;
+        bool m_resumed;
+    };
+
+    /**
+     * Return the text to append to at the cursor, anchoring a new buffer there if it is not the end of a buffer.
+     */
+    std::string &GetText(Cursor &cursor);
+
+    Buffer *AddBuffer(Buffer *buffer, size_t offset);
+
+    /**
+     * Close the start tag of the last element added if it is not the current one.
+     */
+    void CloseLastElement();
+
+    void WriteBuffer(Buffer &buffer, pugi::xml_writer &writer);
+
+    static void AppendIndent(std::string &output, int depth) { output.append(depth, '\t'); }
+
+public:
+    //
+private:
+    // deques for not invalidating the pointers
+    std::deque<Buffer> m_buffers;
+    std::deque<Element> m_elements;
+    std::vector<StackItem> m_stack;
+    // the element added last and not pushed (if any)
+    Cursor *m_lastCursor;
+    std::string m_lastName;
+    std::unordered_map<std::string, Element *> m_resumableElements;
+};
+
+//----------------------------------------------------------------------------
+// SvgDeviceContext
 //----------------------------------------------------------------------------
 
 /**
  * This class implements a drawing context for generating SVG files.
  * The music font is embedded by incorporating ./data/[fontname]/[glyph].xml glyphs within
  * the SVG file.
+ * The SVG is written directly with a SvgStream, or built as a pugixml document before being written
+ * in the DOM (compatibility) mode. The output is the same in both cases.
  */
 class SvgDeviceContext : public DeviceContext {
 public:
@@ -40,7 +186,7 @@ public:
      * @name Constructors, destructors, and other standard methods
      */
     ///@{
-    SvgDeviceContext(int width, int height);
+    SvgDeviceContext(int width, int height, bool dom = false);
     virtual ~SvgDeviceContext();
     virtual ClassId GetClassId() const { return SVG_DEVICE_CONTEXT; }
     ///@}
@@ -71,6 +217,12 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * Write the SVG directly to the output stream.
+     * Add the xml tag if necessary.
+     */
+    void WriteSVG(std::ostream &output, bool xml_declaration = false);
+
     /**
      * @name Drawing methods
      */
@@ -160,17 +312,41 @@ private:
     void VrvTextFont() { m_vrvTextFont = true; }
 
     /**
-     * Flush the data to the internal buffer.
+     * Finalize the SVG document before it is written (DOM mode).
      * Adds the xml tag if necessary and the <defs> from m_smufl_glyphs
      */
     void Commit(bool xml_declaration);
 
+    /**
+     * Write the SVG, with the header (<desc>, <defs>, etc.) written before the content in the stream mode.
+     */
+    void Write(pugi::xml_writer &writer, bool xml_declaration);
+
     void WriteLine(std::string);
 
     std::string GetColour(int colour);
 
     pugi::xml_node AppendChild(std::string name);
 
+    /**
+     * @name Methods for building the SVG, either with the SvgStream or in the DOM.
+     * AddElement adds a child to the current element, before its first <g> child if beforeGroups is true.
+     * Attributes and text are then added to that element, and PushElement makes it the current one.
+     * The numeric values are formatted as pugixml does.
+     */
+    ///@{
+    void AddElement(const std::string &name, bool beforeGroups = false);
+    void AddAttribute(const char *name, const std::string &value);
+    void AddAttribute(const char *name, int value);
+    void AddAttribute(const char *name, float value);
+    void AddAttribute(const char *name, double value);
+    void AddText(const std::string &text);
+    void PushElement();
+    void PopElement();
+    void RegisterElement(const std::string &id);
+    void ResumeElement(const std::string &id);
+    ///@}
+
 public:
     //
 private:
@@ -181,25 +357,35 @@ private:
      */
     bool m_vrvTextFont;
 
-    // we use a std::stringstream because we want to prepend the <defs> which will know only when we reach the end of
-    // the page
+    // the <defs> are prepended once we reach the end of the page
     // some viewer seem to support to have the <defs> at the end, but some do not (pdf2svg, for example)
-    // for this reason, the full svg is finally written a string from the destructor or when Flush() is called
-    std::ostringstream m_outdata;
+    // for this reason, the full svg is finally written to a string or a stream when GetStringSVG() or WriteSVG() are
+    // called
+    unsigned int m_outputFlags;
 
-    bool m_committed; // did we flushed the file?
+    bool m_committed; // did we finalize the document?
     int m_width, m_height;
     int m_originX, m_originY;
     double m_userScaleX, m_userScaleY;
 
-    // holds the list of glyphs from the smufl font used so far
-    // they will be added at the end of the file as <defs>
-    std::vector<std::string> m_smufl_glyphs;
+    // holds the list of glyphs (SMuFL code) from the smufl font used so far, in the order of their first use
+    // they will be added at the end of the file as <defs>, and m_smufl_glyphCodes is for checking if one is listed
+    std::vector<wchar_t> m_smufl_glyphs;
+    std::unordered_set<wchar_t> m_smufl_glyphCodes;
+
+    // build the SVG in a pugixml document instead of writing it directly
+    bool m_dom;
+    SvgStream m_stream;
+
+    // the <g> nodes by id for resuming graphics, instead of searching the document
+    std::unordered_map<std::string, pugi::xml_node> m_graphicNodes;
 
     // pugixml data
     pugi::xml_document m_svgDoc;
     pugi::xml_node m_svgNode;
     pugi::xml_node m_currentNode;
+    // the node added last with AddElement
+    pugi::xml_node m_element;
     std::list<pugi::xml_node> m_svgNodeStack;
 };
 
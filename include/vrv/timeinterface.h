@@ -13,6 +13,7 @@
 
 namespace vrv {
 
+class Doc;
 class Object;
 class FunctorParams;
 class LayerElement;
@@ -116,6 +117,14 @@ protected:
      */
     std::string ExtractUuidFragment(std::string refUuid);
 
+    /**
+     * Look for the LayerElement with the uuid through the uuid index of the doc.
+     * If a measure is given, the element has to be in it.
+     * Return NULL if there is none. lookUp is set to true when an object with the uuid exists but cannot be pointed to
+     * (e.g., it is hidden), in which case another one might still be found by processing the LayerElements.
+     */
+    LayerElement *GetIndexedElement(Doc *doc, const std::string &uuid, Measure *measure, bool &lookUp);
+
 private:
     //
 public:
@@ -14,6 +14,7 @@
 
 #include "doc.h"
 #include "view.h"
+#include "vrv.h"
 
 //----------------------------------------------------------------------------
 
@@ -26,6 +27,8 @@
 
 namespace vrv {
 
+class SvgDeviceContext;
+
 enum FileFormat { UNKNOWN = 0, AUTO, MEI, HUMDRUM, PAE, DARMS, MUSICXML, MUSICXMLHUM, MIDI };
 
 //----------------------------------------------------------------------------
@@ -38,14 +41,15 @@ public:
      * @name Constructors and destructors
      */
     ///@{
-    /** If initFont is set to false, Resources::InitFonts will have to be called explicitely */
+    /** If initFont is set to false, Resources::InitFonts or SetResourcePath will have to be called explicitely */
     Toolkit(bool initFont = true);
     virtual ~Toolkit();
     ///@}
 
     /**
-     * Set the resource path. To be called if the constructor had initFont=false.
-     * This needs refactoring.
+     * Set the resource path of the toolkit and select its default font (Leipzig).
+     * The process-wide path and default font (Resources::SetPath and Resources::InitFonts) are not changed, so other
+     * toolkits (possibly used in other threads) are not affected. Returns false if the font cannot be loaded.
      */
     bool SetResourcePath(const std::string &path);
 
@@ -55,9 +59,13 @@ public:
     bool LoadFile(const std::string &filename);
 
     /**
-     * Load a string data with the specified type.
+     * @name Load a string data with the specified type.
+     * The data of the buffer version does not need to be null terminated.
      */
+    ///@{
     bool LoadData(const std::string &data);
+    bool LoadData(const char *data, size_t length);
+    ///@}
 
     /**
      * Save an MEI file.
@@ -79,7 +87,7 @@ public:
     /**
      * Concatenates the vrv::logBuffer into a string an returns it.
      * This is used only for Emscripten-based compilation.
-     * The vrv::logBuffer is filled by the vrv::LogXXX functions.
+     * The vrv::logBuffer is filled by the vrv::LogXXX functions (one buffer per thread).
      */
     std::string GetLogString();
 
@@ -107,6 +115,14 @@ public:
      */
     bool RenderToSvgFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render all the pages in SVG and return them in a vector (one string per page).
+     * The pages are drawn concurrently with the given number of threads, each with its own view and device context.
+     * Pages linked by a spanning element (e.g., a slur across a page break) are drawn in the same thread.
+     * The pages are rendered one by one in a single thread when threads is 1 or with pages having their own dimensions.
+     */
+    std::vector<std::string> RenderAllToSvg(int threads, bool xml_declaration = false);
+
     /**
      * Creates a midi file, opens it, and writes to it.
      * currently generates a dummy midi file.
@@ -130,6 +146,12 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * Returns the changes of elements being played between two times, i.e., for each time with notes starting or
+     * ending in [startMillisec, endMillisec), the IDs of the notes starting ("on") and ending ("off") and the page.
+     */
+    std::string GetElementChangesBetweenTimes(int startMillisec, int endMillisec);
+
     /**
      * Get the MEI as a string.
      * Get all the pages unless a page number (1-based) is specified
@@ -221,6 +243,27 @@ public:
     int GetSpacingSystem() { return m_spacingSystem; }
     ///@}
 
+    /**
+     * @name Number of threads for laying out the measures of a page concurrently (default is 1)
+     */
+    ///@{
+    void SetLayoutThreads(int threads) { m_layoutThreads = threads; }
+    int GetLayoutThreads() { return m_layoutThreads; }
+    ///@}
+
+    /**
+     * @name Number of threads for importing the parts of a MusicXML file concurrently (default is 1)
+     */
+    ///@{
+    void SetImportThreads(int threads) { m_importThreads = threads; }
+    int GetImportThreads() { return m_importThreads; }
+    ///@}
+
+    /**
+     * Seed the generator of the xml:ids of the document (0 for a random seed)
+     */
+    void SetXmlIdSeed(int seed);
+
     /**
      * @name Space notes equally and close together (normally for mensural notation)
      */
@@ -246,6 +289,16 @@ public:
     int GetNoLayout() { return m_noLayout; }
     ///@}
 
+    /**
+     * @name Cast off the pages only when they are requested
+     * The number of pages is known once all the pages have been requested or with GetPageCount, which casts
+     * off the entire document. GetPageCount(true) returns an estimate instead (see IsCastOffPending)
+     */
+    ///@{
+    void SetLazyLayout(bool l) { m_lazyLayout = l; }
+    int GetLazyLayout() { return m_lazyLayout; }
+    ///@}
+
     /**
      * @name Include type attributes when importing from Humdrum
      */
@@ -295,6 +348,14 @@ public:
     int GetShowBoundingBoxes() { return m_showBoundingBoxes; }
     ///@}
 
+    /**
+     * @name Build the SVG as a DOM before writing it instead of writing it directly (compatibility mode)
+     */
+    ///@{
+    void SetSvgDom(bool dom) { m_svgDom = dom; }
+    int GetSvgDom() { return m_svgDom; }
+    ///@}
+
     /**
      * @name Get the input file format (defined as FileFormat)
      * The SetFormat with FileFormat does not perform any validation
@@ -320,6 +381,7 @@ public:
      */
     ///@{
     FileFormat IdentifyInputFormat(const std::string &data);
+    FileFormat IdentifyInputFormat(const char *data, size_t length);
     ///@}
 
     /**
@@ -356,6 +418,8 @@ public:
 
     /**
      * @name Set a specific font
+     * The font is used by the toolkit only, the default font being the one initialized with Resources::InitFonts
+     * The font is loaded from the resource path of the toolkit (or the process-wide one if none was set)
      */
     ///@{
     bool SetFont(std::string const &font);
@@ -364,9 +428,12 @@ public:
     /**
      * @name Get the pages for a loaded file
      * The SetFormat with FileFormat does not perform any validation
+     * With the lazy layout, the page count is exact only once the entire document is cast off. Unless an estimate
+     * is requested, GetPageCount casts it off. IsCastOffPending tells whether the estimate might not be exact.
      */
     ///@{
-    int GetPageCount();
+    int GetPageCount(bool estimate = false);
+    bool IsCastOffPending() const { return m_doc.IsCastOffPending(); }
     ///@}
 
     /**
@@ -382,6 +449,22 @@ private:
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
 
+    /**
+     * Load the data of a buffer of length bytes.
+     * With inPlace, the buffer is modified by the XML parsers that use it without copying it.
+     */
+    bool LoadBuffer(char *data, size_t length, bool inPlace);
+
+    /**
+     * @name Methods for rendering a page in SVG
+     * SetSvgPage sets the page (1-based) and returns the size of the SVG in accordance with the options.
+     * DrawSvgPage then draws the page with the view in the SVG device context created with that size.
+     */
+    ///@{
+    void SetSvgPage(int pageNo, int &width, int &height);
+    void DrawSvgPage(SvgDeviceContext *svg, View *view, Page *page);
+    ///@}
+
 protected:
 #ifdef USE_EMSCRIPTEN
     /**
@@ -411,6 +494,7 @@ private:
     int m_spacingSystem;
 
     bool m_noLayout;
+    bool m_lazyLayout;
     bool m_ignoreLayout;
     int m_humType = 0;
     bool m_adjustPageHeight;
@@ -419,14 +503,21 @@ private:
     std::string m_mdivXPathQuery;
     bool m_scoreBasedMei;
     bool m_evenNoteSpacing;
+    bool m_svgDom;
+    int m_layoutThreads;
+    int m_importThreads;
     float m_spacingLinear;
     float m_spacingNonLinear;
     // for debugging
     bool m_noJustification;
     bool m_showBoundingBoxes;
 
-    static char *m_humdrumBuffer;
+    char *m_humdrumBuffer;
     char *m_cString;
+    /** The resource path of the toolkit (empty for the process-wide one) */
+    std::string m_resourcePath;
+    /** The font of the toolkit (NULL for the default one), selected in the current thread for layout and drawing */
+    Resources::LoadedFont *m_font;
 };
 
 } // namespace vrv
@@ -9,6 +9,7 @@
 #define __VRV_VERTICAL_ALIGNER_H__
 
 #include "atts_shared.h"
+#include "boundingbox.h"
 #include "object.h"
 
 namespace vrv {
@@ -150,8 +151,16 @@ public:
      * @name Adds a bounding box to the array of overflowing objects above or below
      */
     ///@{
-    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.push_back(box); }
-    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.push_back(box); }
+    void AddBBoxAbove(BoundingBox *box)
+    {
+        m_overflowAboveBBoxes.push_back(box);
+        m_overflowAboveBBoxIndex.Add(box);
+    }
+    void AddBBoxBelow(BoundingBox *box)
+    {
+        m_overflowBelowBBoxes.push_back(box);
+        m_overflowBelowBBoxIndex.Add(box);
+    }
     ///@}
 
     /**
@@ -197,6 +206,10 @@ private:
      * The list of FloatingPositioner for the staff.
      */
     ArrayOfFloatingPositioners m_floatingPositioners;
+    /**
+     * The same FloatingPositioner grouped by the ClassId of their object (in the same order).
+     */
+    std::map<ClassId, ArrayOfFloatingPositioners> m_floatingPositionersByClassId;
     /**
      * Stores a pointer to the staff from which the aligner was created.
      * This is necessary since we don't always have all the staves.
@@ -227,6 +240,12 @@ private:
      */
     std::vector<BoundingBox *> m_overflowAboveBBoxes;
     std::vector<BoundingBox *> m_overflowBelowBBoxes;
+
+    /**
+     * The same bounding boxes indexed by horizontal position for looking for overlapping ones.
+     */
+    BoundingBoxIndex m_overflowAboveBBoxIndex;
+    BoundingBoxIndex m_overflowBelowBBoxIndex;
 };
 
 } // namespace vrv
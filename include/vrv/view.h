@@ -139,6 +139,14 @@ public:
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * Draw the given page without changing the drawing page of the document.
+     * The drawing values of the document must be the ones of the page.
+     * This is used for drawing pages concurrently in separate views (see Toolkit::RenderAllToSvg).
+     * Defined in view_page.cpp
+     */
+    void DrawPage(DeviceContext *dc, Page *page, bool background = true);
+
     /**
      * Return the pixel per unit factor of the current page (if any, 1.0 otherwise)
      */
@@ -8,11 +8,17 @@
 #ifndef __VRV_H__
 #define __VRV_H__
 
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <functional>
+#include <iostream>
 #include <map>
+#include <mutex>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifndef _WIN32
@@ -37,12 +43,21 @@ void LogMessage(const char *fmt, ...);
 void LogWarning(const char *fmt, ...);
 void DisableLog();
 
+/**
+ * Collect the log messages of the current thread in a vector instead of writing them (NULL to stop).
+ * This is for threads working concurrently whose messages are then written in order with LogCollected.
+ * Not supported with emscripten.
+ */
+void CollectLog(std::vector<std::string> *messages);
+void LogCollected(const std::vector<std::string> &messages);
+
 /**
  * Member and functions specific to emscripten loging that uses a vector of string to buffer the logs.
  */
 #ifdef EMSCRIPTEN
 enum consoleLogLevel { CONSOLE_LOG = 0, CONSOLE_INFO, CONSOLE_WARN, CONSOLE_ERROR };
-extern std::vector<std::string> logBuffer;
+/** One buffer per thread, so toolkits running in different threads do not share their logs */
+extern thread_local std::vector<std::string> logBuffer;
 bool LogBufferContains(std::string s);
 void AppendLogBuffer(bool checkDuplicate, std::string message, consoleLogLevel level);
 #endif
@@ -87,9 +102,21 @@ std::string GetFilename(std::string fullpath);
 std::string GetVersion();
 
 /**
- *
+ * @name Utilities for writing and reading values to and from binary files (e.g., the font cache)
+ * Values are written in the native byte order. The read functions return false if the input is truncated.
+ */
+///@{
+void BinaryWriteInt(std::ostream &output, int value);
+bool BinaryReadInt(std::istream &input, int &value);
+void BinaryWriteString(std::ostream &output, const std::string &value);
+bool BinaryReadString(std::istream &input, std::string &value);
+///@}
+
+/**
+ * Disable the logging (see DisableLog).
+ * The flag is shared by all the threads and all the toolkits of the process.
  */
-extern bool noLog;
+extern std::atomic<bool> noLog;
 
 /**
  * Functions for logging in milliseconds the elapsed time of an
@@ -102,7 +129,7 @@ extern bool noLog;
  * ... Do something
  * LogElapsedTimeEnd("name of the operation");
  */
-extern struct timeval start;
+extern thread_local struct timeval start;
 void LogElapsedTimeStart();
 void LogElapsedTimeEnd(const char *msg = "unspecified operation");
 
@@ -119,39 +146,143 @@ bool Check(Object *object);
 /**
  * This class provides static resource values.
  * The default values can be changed by setters.
+ * The fonts are loaded once for each resource path and are then shared (and not modified) between all the threads.
+ * The font is selected for each thread, the default one being the one initialized with InitFonts.
+ * The resource path and the default font are process-wide defaults. A toolkit with its own resource path or font
+ * loads it with GetFont or LoadDefaultFont and selects it for the thread it runs in with SetCurrentFont.
  */
 
 class Resources {
 public:
+    /**
+     * A loaded font, i.e., its glyphs over the Bravura ones, the text font, and the parsed glyph definitions.
+     * Defined in vrv.cpp
+     */
+    class LoadedFont;
+
     /**
      * @name Setters and getters for static environment variables
      */
     ///@{
-    /** Resource path */
-    static std::string GetPath() { return m_path; }
-    static void SetPath(std::string path) { m_path = path; }
-    /** Init the SMufL music and text fonts */
+    /** Default resource path (thread-safe) */
+    static std::string GetPath();
+    static void SetPath(std::string path);
+    /** Init the SMufL music and text fonts of the default resource path and make them the default for all threads */
     static bool InitFonts();
-    /** Init the text font (bounding boxes and ASCII only) */
-    static bool InitTextFont();
-    /** Select a particular font */
+    /** Select a particular font of the default resource path for the current thread */
     static bool SetFont(std::string fontName);
     /** Returns the glyph (if exists) for the current SMuFL font */
     static Glyph *GetGlyph(wchar_t smuflCode);
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
     static Glyph *GetTextGlyph(wchar_t code);
+    /**
+     * Returns the content of the glyph file for the SVG <defs> (empty if the glyph does not exist).
+     * The glyph files are read only once for each font and the returned string is never changed afterwards.
+     * The method is thread-safe.
+     */
+    static const std::string &GetGlyphDef(wchar_t smuflCode);
+    /** Write the binary cache for a font (in the resource directory) from its XML files */
+    static bool WriteFontCache(std::string fontName);
+    ///@}
+
+    /**
+     * @name Get and set the font of the current thread, e.g., for passing it to a worker thread.
+     */
+    ///@{
+    static LoadedFont *GetCurrentFont();
+    static void SetCurrentFont(LoadedFont *font);
+    ///@}
+
+    /**
+     * @name Load a font of a given resource path without changing the default path or font (thread-safe).
+     * LoadDefaultFont loads the Leipzig font and checks it as InitFonts does.
+     * They return NULL if the font cannot be loaded.
+     */
+    ///@{
+    static LoadedFont *GetFont(const std::string &path, const std::string &fontName);
+    static LoadedFont *LoadDefaultFont(const std::string &path);
     ///@}
 
 private:
-    static bool LoadFont(std::string fontName);
+    /**
+     * Return the font loaded for a resource path, loading it if necessary (NULL if it cannot be loaded).
+     * The glyphs are loaded either from the binary cache (if any and up-to-date) or from the XML files.
+     * The methods below need to be called with the resource mutex locked.
+     */
+    static LoadedFont *LoadFont(const std::string &path, const std::string &fontName);
+    /** Load the glyphs of a font from its XML files (glyph files and bounding box file) */
+    static bool LoadFontXML(const std::string &path, std::string fontName, std::map<wchar_t, Glyph> &glyphs);
+    /** Load the glyphs of a font from its binary cache - return false if no valid cache is available */
+    static bool LoadFontCache(const std::string &path, std::string fontName, std::map<wchar_t, Glyph> &glyphs);
+    /** Load the text font (bounding boxes and ASCII only) */
+    static bool LoadTextFont(const std::string &path, std::map<wchar_t, Glyph> &glyphs);
+    /** Return the filename of the binary cache of a font */
+    static std::string GetFontCacheFilename(const std::string &path, std::string fontName);
+    /**
+     * Return a signature of the glyph files and of the bounding box file of a font (from their names, sizes and
+     * modification times), stored in the binary cache for detecting changes in the font.
+     */
+    static std::string GetFontSignature(const std::string &path, std::string fontName);
 
 private:
-    /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
+    /** The default path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
     static std::string m_path;
-    /** The loaded SMuFL font */
-    static std::map<wchar_t, Glyph> m_font;
-    /** A text font used for bounding box calculations */
-    static std::map<wchar_t, Glyph> m_textFont;
+    /** The loaded fonts, by resource path and font name */
+    static std::map<std::string, LoadedFont> m_fonts;
+    /** The loaded text fonts, by resource path */
+    static std::map<std::string, std::map<wchar_t, Glyph> > m_textFonts;
+};
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+/**
+ * This class runs jobs on threads kept from one run to the next (e.g., the layout threads of a Doc).
+ * The threads of the pool and the calling thread take the next job as soon as they are done with one.
+ */
+class ThreadPool {
+public:
+    /**
+     * @name Constructors, destructors
+     * The number of threads includes the calling thread, so the pool starts one thread less.
+     */
+    ///@{
+    ThreadPool(int threads);
+    virtual ~ThreadPool();
+    ///@}
+
+    /**
+     * Return the number of threads, including the calling thread.
+     */
+    int GetThreadCount() const { return (int)m_workers.size() + 1; }
+
+    /**
+     * Call the job with each index from 0 to count - 1 and return once all of them are done.
+     * The job is called concurrently and needs to set up what is per thread itself (e.g., the current font).
+     */
+    void Run(int count, const std::function<void(int)> &job);
+
+private:
+    /** The loop of the threads of the pool */
+    void Work();
+    /** Call the job for the next index as long as there is one */
+    void RunJobs();
+
+private:
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    /** For waking up the threads when a run starts, and for waiting for them when it ends */
+    std::condition_variable m_runStarted;
+    std::condition_variable m_runEnded;
+    /** The job and the number of indexes of the current run, and the next index to be taken */
+    const std::function<void(int)> *m_job;
+    int m_count;
+    std::atomic<int> m_next;
+    /** The number of the current run and the number of threads still running jobs for it */
+    unsigned long m_run;
+    int m_busyWorkers;
+    bool m_stop;
 };
 
 //----------------------------------------------------------------------------
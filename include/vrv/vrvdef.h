@@ -9,6 +9,7 @@
 #define __VRV_DEF_H__
 
 #include <algorithm>
+#include <assert.h>
 #include <list>
 #include <map>
 #include <vector>
@@ -243,6 +244,18 @@ typedef std::map<Staff *, std::list<int> > MapOfDotLocs;
 
 #define isIn(x, a, b) (((x) >= std::min((a), (b))) && ((x) <= std::max((a), (b))))
 
+/**
+ * Cast a pointer to a class already known, either from the ClassId of the object (e.g., checked with Object::Is)
+ * or from the FunctorParams child class passed with the Functor.
+ * This is a static_cast checked with a dynamic_cast in debug builds only, so it has no RTTI cost in release builds.
+ * It cannot be used for casting to an interface, which still requires a dynamic_cast.
+ */
+template <class T, class U> inline T vrv_cast(U *ptr)
+{
+    assert(!ptr || dynamic_cast<T>(ptr));
+    return static_cast<T>(ptr);
+}
+
 /**
  * Codes returned by Functors.
  * Default is FUNCTOR_CONTINUE.
@@ -281,6 +294,13 @@ enum FunctorCode { FUNCTOR_CONTINUE = 0, FUNCTOR_SIBLINGS, FUNCTOR_STOP };
 /** Define the maximum levels between a note and its syls **/
 #define MAX_NOTE_DEPTH -1
 
+//----------------------------------------------------------------------------
+// Minimum size of the flat lists of ObjectListInterface for indexing the positions
+//----------------------------------------------------------------------------
+
+/** Shorter lists (e.g., in chords or beams) are searched faster without an index **/
+#define LIST_INDEX_MIN_SIZE 16
+
 //----------------------------------------------------------------------------
 // VerovioText codepoints
 //----------------------------------------------------------------------------
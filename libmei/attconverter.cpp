@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -64,28 +65,32 @@ std::string AttConverter::AccidentalExplicitToStr(data_ACCIDENTAL_EXPLICIT data)
 
 data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(std::string value) const
 {
-    if (value == "s") return ACCIDENTAL_EXPLICIT_s;
-    if (value == "f") return ACCIDENTAL_EXPLICIT_f;
-    if (value == "ss") return ACCIDENTAL_EXPLICIT_ss;
-    if (value == "x") return ACCIDENTAL_EXPLICIT_x;
-    if (value == "ff") return ACCIDENTAL_EXPLICIT_ff;
-    if (value == "xs") return ACCIDENTAL_EXPLICIT_xs;
-    if (value == "sx") return ACCIDENTAL_EXPLICIT_sx;
-    if (value == "ts") return ACCIDENTAL_EXPLICIT_ts;
-    if (value == "tf") return ACCIDENTAL_EXPLICIT_tf;
-    if (value == "n") return ACCIDENTAL_EXPLICIT_n;
-    if (value == "nf") return ACCIDENTAL_EXPLICIT_nf;
-    if (value == "ns") return ACCIDENTAL_EXPLICIT_ns;
-    if (value == "su") return ACCIDENTAL_EXPLICIT_su;
-    if (value == "sd") return ACCIDENTAL_EXPLICIT_sd;
-    if (value == "fu") return ACCIDENTAL_EXPLICIT_fu;
-    if (value == "fd") return ACCIDENTAL_EXPLICIT_fd;
-    if (value == "nu") return ACCIDENTAL_EXPLICIT_nu;
-    if (value == "nd") return ACCIDENTAL_EXPLICIT_nd;
-    if (value == "1qf") return ACCIDENTAL_EXPLICIT_1qf;
-    if (value == "3qf") return ACCIDENTAL_EXPLICIT_3qf;
-    if (value == "1qs") return ACCIDENTAL_EXPLICIT_1qs;
-    if (value == "3qs") return ACCIDENTAL_EXPLICIT_3qs;
+    static const std::unordered_map<std::string, data_ACCIDENTAL_EXPLICIT> values = {
+        { "s", ACCIDENTAL_EXPLICIT_s },
+        { "f", ACCIDENTAL_EXPLICIT_f },
+        { "ss", ACCIDENTAL_EXPLICIT_ss },
+        { "x", ACCIDENTAL_EXPLICIT_x },
+        { "ff", ACCIDENTAL_EXPLICIT_ff },
+        { "xs", ACCIDENTAL_EXPLICIT_xs },
+        { "sx", ACCIDENTAL_EXPLICIT_sx },
+        { "ts", ACCIDENTAL_EXPLICIT_ts },
+        { "tf", ACCIDENTAL_EXPLICIT_tf },
+        { "n", ACCIDENTAL_EXPLICIT_n },
+        { "nf", ACCIDENTAL_EXPLICIT_nf },
+        { "ns", ACCIDENTAL_EXPLICIT_ns },
+        { "su", ACCIDENTAL_EXPLICIT_su },
+        { "sd", ACCIDENTAL_EXPLICIT_sd },
+        { "fu", ACCIDENTAL_EXPLICIT_fu },
+        { "fd", ACCIDENTAL_EXPLICIT_fd },
+        { "nu", ACCIDENTAL_EXPLICIT_nu },
+        { "nd", ACCIDENTAL_EXPLICIT_nd },
+        { "1qf", ACCIDENTAL_EXPLICIT_1qf },
+        { "3qf", ACCIDENTAL_EXPLICIT_3qf },
+        { "1qs", ACCIDENTAL_EXPLICIT_1qs },
+        { "3qs", ACCIDENTAL_EXPLICIT_3qs },
+    };
+    std::unordered_map<std::string, data_ACCIDENTAL_EXPLICIT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.ACCIDENTAL.EXPLICIT", value.c_str());
     return ACCIDENTAL_EXPLICIT_NONE;
 }
@@ -113,15 +118,19 @@ std::string AttConverter::AccidentalImplicitToStr(data_ACCIDENTAL_IMPLICIT data)
 
 data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(std::string value) const
 {
-    if (value == "s") return ACCIDENTAL_IMPLICIT_s;
-    if (value == "f") return ACCIDENTAL_IMPLICIT_f;
-    if (value == "ss") return ACCIDENTAL_IMPLICIT_ss;
-    if (value == "ff") return ACCIDENTAL_IMPLICIT_ff;
-    if (value == "n") return ACCIDENTAL_IMPLICIT_n;
-    if (value == "su") return ACCIDENTAL_IMPLICIT_su;
-    if (value == "sd") return ACCIDENTAL_IMPLICIT_sd;
-    if (value == "fu") return ACCIDENTAL_IMPLICIT_fu;
-    if (value == "fd") return ACCIDENTAL_IMPLICIT_fd;
+    static const std::unordered_map<std::string, data_ACCIDENTAL_IMPLICIT> values = {
+        { "s", ACCIDENTAL_IMPLICIT_s },
+        { "f", ACCIDENTAL_IMPLICIT_f },
+        { "ss", ACCIDENTAL_IMPLICIT_ss },
+        { "ff", ACCIDENTAL_IMPLICIT_ff },
+        { "n", ACCIDENTAL_IMPLICIT_n },
+        { "su", ACCIDENTAL_IMPLICIT_su },
+        { "sd", ACCIDENTAL_IMPLICIT_sd },
+        { "fu", ACCIDENTAL_IMPLICIT_fu },
+        { "fd", ACCIDENTAL_IMPLICIT_fd },
+    };
+    std::unordered_map<std::string, data_ACCIDENTAL_IMPLICIT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.ACCIDENTAL.IMPLICIT", value.c_str());
     return ACCIDENTAL_IMPLICIT_NONE;
 }
@@ -175,41 +184,45 @@ std::string AttConverter::ArticulationToStr(data_ARTICULATION data) const
 
 data_ARTICULATION AttConverter::StrToArticulation(std::string value) const
 {
-    if (value == "acc") return ARTICULATION_acc;
-    if (value == "stacc") return ARTICULATION_stacc;
-    if (value == "ten") return ARTICULATION_ten;
-    if (value == "stacciss") return ARTICULATION_stacciss;
-    if (value == "marc") return ARTICULATION_marc;
-    if (value == "marc-stacc") return ARTICULATION_marc_stacc;
-    if (value == "spicc") return ARTICULATION_spicc;
-    if (value == "doit") return ARTICULATION_doit;
-    if (value == "scoop") return ARTICULATION_scoop;
-    if (value == "rip") return ARTICULATION_rip;
-    if (value == "plop") return ARTICULATION_plop;
-    if (value == "fall") return ARTICULATION_fall;
-    if (value == "longfall") return ARTICULATION_longfall;
-    if (value == "bend") return ARTICULATION_bend;
-    if (value == "flip") return ARTICULATION_flip;
-    if (value == "smear") return ARTICULATION_smear;
-    if (value == "shake") return ARTICULATION_shake;
-    if (value == "dnbow") return ARTICULATION_dnbow;
-    if (value == "upbow") return ARTICULATION_upbow;
-    if (value == "harm") return ARTICULATION_harm;
-    if (value == "snap") return ARTICULATION_snap;
-    if (value == "fingernail") return ARTICULATION_fingernail;
-    if (value == "ten-stacc") return ARTICULATION_ten_stacc;
-    if (value == "damp") return ARTICULATION_damp;
-    if (value == "dampall") return ARTICULATION_dampall;
-    if (value == "open") return ARTICULATION_open;
-    if (value == "stop") return ARTICULATION_stop;
-    if (value == "dbltongue") return ARTICULATION_dbltongue;
-    if (value == "trpltongue") return ARTICULATION_trpltongue;
-    if (value == "heel") return ARTICULATION_heel;
-    if (value == "toe") return ARTICULATION_toe;
-    if (value == "tap") return ARTICULATION_tap;
-    if (value == "lhpizz") return ARTICULATION_lhpizz;
-    if (value == "dot") return ARTICULATION_dot;
-    if (value == "stroke") return ARTICULATION_stroke;
+    static const std::unordered_map<std::string, data_ARTICULATION> values = {
+        { "acc", ARTICULATION_acc },
+        { "stacc", ARTICULATION_stacc },
+        { "ten", ARTICULATION_ten },
+        { "stacciss", ARTICULATION_stacciss },
+        { "marc", ARTICULATION_marc },
+        { "marc-stacc", ARTICULATION_marc_stacc },
+        { "spicc", ARTICULATION_spicc },
+        { "doit", ARTICULATION_doit },
+        { "scoop", ARTICULATION_scoop },
+        { "rip", ARTICULATION_rip },
+        { "plop", ARTICULATION_plop },
+        { "fall", ARTICULATION_fall },
+        { "longfall", ARTICULATION_longfall },
+        { "bend", ARTICULATION_bend },
+        { "flip", ARTICULATION_flip },
+        { "smear", ARTICULATION_smear },
+        { "shake", ARTICULATION_shake },
+        { "dnbow", ARTICULATION_dnbow },
+        { "upbow", ARTICULATION_upbow },
+        { "harm", ARTICULATION_harm },
+        { "snap", ARTICULATION_snap },
+        { "fingernail", ARTICULATION_fingernail },
+        { "ten-stacc", ARTICULATION_ten_stacc },
+        { "damp", ARTICULATION_damp },
+        { "dampall", ARTICULATION_dampall },
+        { "open", ARTICULATION_open },
+        { "stop", ARTICULATION_stop },
+        { "dbltongue", ARTICULATION_dbltongue },
+        { "trpltongue", ARTICULATION_trpltongue },
+        { "heel", ARTICULATION_heel },
+        { "toe", ARTICULATION_toe },
+        { "tap", ARTICULATION_tap },
+        { "lhpizz", ARTICULATION_lhpizz },
+        { "dot", ARTICULATION_dot },
+        { "stroke", ARTICULATION_stroke },
+    };
+    std::unordered_map<std::string, data_ARTICULATION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.ARTICULATION", value.c_str());
     return ARTICULATION_NONE;
 }
@@ -231,9 +244,13 @@ std::string AttConverter::BarplaceToStr(data_BARPLACE data) const
 
 data_BARPLACE AttConverter::StrToBarplace(std::string value) const
 {
-    if (value == "mensur") return BARPLACE_mensur;
-    if (value == "staff") return BARPLACE_staff;
-    if (value == "takt") return BARPLACE_takt;
+    static const std::unordered_map<std::string, data_BARPLACE> values = {
+        { "mensur", BARPLACE_mensur },
+        { "staff", BARPLACE_staff },
+        { "takt", BARPLACE_takt },
+    };
+    std::unordered_map<std::string, data_BARPLACE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.BARPLACE", value.c_str());
     return BARPLACE_NONE;
 }
@@ -263,17 +280,21 @@ std::string AttConverter::BarrenditionToStr(data_BARRENDITION data) const
 
 data_BARRENDITION AttConverter::StrToBarrendition(std::string value) const
 {
-    if (value == "dashed") return BARRENDITION_dashed;
-    if (value == "dotted") return BARRENDITION_dotted;
-    if (value == "dbl") return BARRENDITION_dbl;
-    if (value == "dbldashed") return BARRENDITION_dbldashed;
-    if (value == "dbldotted") return BARRENDITION_dbldotted;
-    if (value == "end") return BARRENDITION_end;
-    if (value == "invis") return BARRENDITION_invis;
-    if (value == "rptstart") return BARRENDITION_rptstart;
-    if (value == "rptboth") return BARRENDITION_rptboth;
-    if (value == "rptend") return BARRENDITION_rptend;
-    if (value == "single") return BARRENDITION_single;
+    static const std::unordered_map<std::string, data_BARRENDITION> values = {
+        { "dashed", BARRENDITION_dashed },
+        { "dotted", BARRENDITION_dotted },
+        { "dbl", BARRENDITION_dbl },
+        { "dbldashed", BARRENDITION_dbldashed },
+        { "dbldotted", BARRENDITION_dbldotted },
+        { "end", BARRENDITION_end },
+        { "invis", BARRENDITION_invis },
+        { "rptstart", BARRENDITION_rptstart },
+        { "rptboth", BARRENDITION_rptboth },
+        { "rptend", BARRENDITION_rptend },
+        { "single", BARRENDITION_single },
+    };
+    std::unordered_map<std::string, data_BARRENDITION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.BARRENDITION", value.c_str());
     return BARRENDITION_NONE;
 }
@@ -305,19 +326,23 @@ std::string AttConverter::BetypeToStr(data_BETYPE data) const
 
 data_BETYPE AttConverter::StrToBetype(std::string value) const
 {
-    if (value == "byte") return BETYPE_byte;
-    if (value == "smil") return BETYPE_smil;
-    if (value == "midi") return BETYPE_midi;
-    if (value == "mmc") return BETYPE_mmc;
-    if (value == "mtc") return BETYPE_mtc;
-    if (value == "smpte-25") return BETYPE_smpte_25;
-    if (value == "smpte-24") return BETYPE_smpte_24;
-    if (value == "smpte-df30") return BETYPE_smpte_df30;
-    if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
-    if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
-    if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
-    if (value == "tcf") return BETYPE_tcf;
-    if (value == "time") return BETYPE_time;
+    static const std::unordered_map<std::string, data_BETYPE> values = {
+        { "byte", BETYPE_byte },
+        { "smil", BETYPE_smil },
+        { "midi", BETYPE_midi },
+        { "mmc", BETYPE_mmc },
+        { "mtc", BETYPE_mtc },
+        { "smpte-25", BETYPE_smpte_25 },
+        { "smpte-24", BETYPE_smpte_24 },
+        { "smpte-df30", BETYPE_smpte_df30 },
+        { "smpte-ndf30", BETYPE_smpte_ndf30 },
+        { "smpte-df29.97", BETYPE_smpte_df29_97 },
+        { "smpte-ndf29.97", BETYPE_smpte_ndf29_97 },
+        { "tcf", BETYPE_tcf },
+        { "time", BETYPE_time },
+    };
+    std::unordered_map<std::string, data_BETYPE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.BETYPE", value.c_str());
     return BETYPE_NONE;
 }
@@ -338,8 +363,12 @@ std::string AttConverter::BooleanToStr(data_BOOLEAN data) const
 
 data_BOOLEAN AttConverter::StrToBoolean(std::string value) const
 {
-    if (value == "true") return BOOLEAN_true;
-    if (value == "false") return BOOLEAN_false;
+    static const std::unordered_map<std::string, data_BOOLEAN> values = {
+        { "true", BOOLEAN_true },
+        { "false", BOOLEAN_false },
+    };
+    std::unordered_map<std::string, data_BOOLEAN>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.BOOLEAN", value.c_str());
     return BOOLEAN_NONE;
 }
@@ -362,10 +391,14 @@ std::string AttConverter::CertaintyToStr(data_CERTAINTY data) const
 
 data_CERTAINTY AttConverter::StrToCertainty(std::string value) const
 {
-    if (value == "high") return CERTAINTY_high;
-    if (value == "medium") return CERTAINTY_medium;
-    if (value == "low") return CERTAINTY_low;
-    if (value == "unknown") return CERTAINTY_unknown;
+    static const std::unordered_map<std::string, data_CERTAINTY> values = {
+        { "high", CERTAINTY_high },
+        { "medium", CERTAINTY_medium },
+        { "low", CERTAINTY_low },
+        { "unknown", CERTAINTY_unknown },
+    };
+    std::unordered_map<std::string, data_CERTAINTY>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.CERTAINTY", value.c_str());
     return CERTAINTY_NONE;
 }
@@ -390,12 +423,16 @@ std::string AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
 
 data_CLEFSHAPE AttConverter::StrToClefshape(std::string value) const
 {
-    if (value == "G") return CLEFSHAPE_G;
-    if (value == "GG") return CLEFSHAPE_GG;
-    if (value == "F") return CLEFSHAPE_F;
-    if (value == "C") return CLEFSHAPE_C;
-    if (value == "perc") return CLEFSHAPE_perc;
-    if (value == "TAB") return CLEFSHAPE_TAB;
+    static const std::unordered_map<std::string, data_CLEFSHAPE> values = {
+        { "G", CLEFSHAPE_G },
+        { "GG", CLEFSHAPE_GG },
+        { "F", CLEFSHAPE_F },
+        { "C", CLEFSHAPE_C },
+        { "perc", CLEFSHAPE_perc },
+        { "TAB", CLEFSHAPE_TAB },
+    };
+    std::unordered_map<std::string, data_CLEFSHAPE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value.c_str());
     return CLEFSHAPE_NONE;
 }
@@ -417,9 +454,13 @@ std::string AttConverter::ClusterToStr(data_CLUSTER data) const
 
 data_CLUSTER AttConverter::StrToCluster(std::string value) const
 {
-    if (value == "white") return CLUSTER_white;
-    if (value == "black") return CLUSTER_black;
-    if (value == "chromatic") return CLUSTER_chromatic;
+    static const std::unordered_map<std::string, data_CLUSTER> values = {
+        { "white", CLUSTER_white },
+        { "black", CLUSTER_black },
+        { "chromatic", CLUSTER_chromatic },
+    };
+    std::unordered_map<std::string, data_CLUSTER>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.CLUSTER", value.c_str());
     return CLUSTER_NONE;
 }
@@ -454,22 +495,26 @@ std::string AttConverter::ColornamesToStr(data_COLORNAMES data) const
 
 data_COLORNAMES AttConverter::StrToColornames(std::string value) const
 {
-    if (value == "aqua") return COLORNAMES_aqua;
-    if (value == "black") return COLORNAMES_black;
-    if (value == "blue") return COLORNAMES_blue;
-    if (value == "fuchsia") return COLORNAMES_fuchsia;
-    if (value == "gray") return COLORNAMES_gray;
-    if (value == "green") return COLORNAMES_green;
-    if (value == "lime") return COLORNAMES_lime;
-    if (value == "maroon") return COLORNAMES_maroon;
-    if (value == "navy") return COLORNAMES_navy;
-    if (value == "olive") return COLORNAMES_olive;
-    if (value == "purple") return COLORNAMES_purple;
-    if (value == "red") return COLORNAMES_red;
-    if (value == "silver") return COLORNAMES_silver;
-    if (value == "teal") return COLORNAMES_teal;
-    if (value == "white") return COLORNAMES_white;
-    if (value == "yellow") return COLORNAMES_yellow;
+    static const std::unordered_map<std::string, data_COLORNAMES> values = {
+        { "aqua", COLORNAMES_aqua },
+        { "black", COLORNAMES_black },
+        { "blue", COLORNAMES_blue },
+        { "fuchsia", COLORNAMES_fuchsia },
+        { "gray", COLORNAMES_gray },
+        { "green", COLORNAMES_green },
+        { "lime", COLORNAMES_lime },
+        { "maroon", COLORNAMES_maroon },
+        { "navy", COLORNAMES_navy },
+        { "olive", COLORNAMES_olive },
+        { "purple", COLORNAMES_purple },
+        { "red", COLORNAMES_red },
+        { "silver", COLORNAMES_silver },
+        { "teal", COLORNAMES_teal },
+        { "white", COLORNAMES_white },
+        { "yellow", COLORNAMES_yellow },
+    };
+    std::unordered_map<std::string, data_COLORNAMES>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.COLORNAMES", value.c_str());
     return COLORNAMES_NONE;
 }
@@ -490,8 +535,12 @@ std::string AttConverter::EnclosureToStr(data_ENCLOSURE data) const
 
 data_ENCLOSURE AttConverter::StrToEnclosure(std::string value) const
 {
-    if (value == "paren") return ENCLOSURE_paren;
-    if (value == "brack") return ENCLOSURE_brack;
+    static const std::unordered_map<std::string, data_ENCLOSURE> values = {
+        { "paren", ENCLOSURE_paren },
+        { "brack", ENCLOSURE_brack },
+    };
+    std::unordered_map<std::string, data_ENCLOSURE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.ENCLOSURE", value.c_str());
     return ENCLOSURE_NONE;
 }
@@ -516,12 +565,16 @@ std::string AttConverter::FillToStr(data_FILL data) const
 
 data_FILL AttConverter::StrToFill(std::string value) const
 {
-    if (value == "void") return FILL_void;
-    if (value == "solid") return FILL_solid;
-    if (value == "top") return FILL_top;
-    if (value == "bottom") return FILL_bottom;
-    if (value == "left") return FILL_left;
-    if (value == "right") return FILL_right;
+    static const std::unordered_map<std::string, data_FILL> values = {
+        { "void", FILL_void },
+        { "solid", FILL_solid },
+        { "top", FILL_top },
+        { "bottom", FILL_bottom },
+        { "left", FILL_left },
+        { "right", FILL_right },
+    };
+    std::unordered_map<std::string, data_FILL>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.FILL", value.c_str());
     return FILL_NONE;
 }
@@ -549,15 +602,19 @@ std::string AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
 
 data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string value) const
 {
-    if (value == "xx-small") return FONTSIZETERM_xx_small;
-    if (value == "x-small") return FONTSIZETERM_x_small;
-    if (value == "small") return FONTSIZETERM_small;
-    if (value == "medium") return FONTSIZETERM_medium;
-    if (value == "large") return FONTSIZETERM_large;
-    if (value == "x-large") return FONTSIZETERM_x_large;
-    if (value == "xx-large") return FONTSIZETERM_xx_large;
-    if (value == "smaller") return FONTSIZETERM_smaller;
-    if (value == "larger") return FONTSIZETERM_larger;
+    static const std::unordered_map<std::string, data_FONTSIZETERM> values = {
+        { "xx-small", FONTSIZETERM_xx_small },
+        { "x-small", FONTSIZETERM_x_small },
+        { "small", FONTSIZETERM_small },
+        { "medium", FONTSIZETERM_medium },
+        { "large", FONTSIZETERM_large },
+        { "x-large", FONTSIZETERM_x_large },
+        { "xx-large", FONTSIZETERM_xx_large },
+        { "smaller", FONTSIZETERM_smaller },
+        { "larger", FONTSIZETERM_larger },
+    };
+    std::unordered_map<std::string, data_FONTSIZETERM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value.c_str());
     return FONTSIZETERM_NONE;
 }
@@ -579,9 +636,13 @@ std::string AttConverter::FontstyleToStr(data_FONTSTYLE data) const
 
 data_FONTSTYLE AttConverter::StrToFontstyle(std::string value) const
 {
-    if (value == "italic") return FONTSTYLE_italic;
-    if (value == "normal") return FONTSTYLE_normal;
-    if (value == "oblique") return FONTSTYLE_oblique;
+    static const std::unordered_map<std::string, data_FONTSTYLE> values = {
+        { "italic", FONTSTYLE_italic },
+        { "normal", FONTSTYLE_normal },
+        { "oblique", FONTSTYLE_oblique },
+    };
+    std::unordered_map<std::string, data_FONTSTYLE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.FONTSTYLE", value.c_str());
     return FONTSTYLE_NONE;
 }
@@ -602,8 +663,12 @@ std::string AttConverter::FontweightToStr(data_FONTWEIGHT data) const
 
 data_FONTWEIGHT AttConverter::StrToFontweight(std::string value) const
 {
-    if (value == "bold") return FONTWEIGHT_bold;
-    if (value == "normal") return FONTWEIGHT_normal;
+    static const std::unordered_map<std::string, data_FONTWEIGHT> values = {
+        { "bold", FONTWEIGHT_bold },
+        { "normal", FONTWEIGHT_normal },
+    };
+    std::unordered_map<std::string, data_FONTWEIGHT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value.c_str());
     return FONTWEIGHT_NONE;
 }
@@ -625,9 +690,13 @@ std::string AttConverter::GlissandoToStr(data_GLISSANDO data) const
 
 data_GLISSANDO AttConverter::StrToGlissando(std::string value) const
 {
-    if (value == "i") return GLISSANDO_i;
-    if (value == "m") return GLISSANDO_m;
-    if (value == "t") return GLISSANDO_t;
+    static const std::unordered_map<std::string, data_GLISSANDO> values = {
+        { "i", GLISSANDO_i },
+        { "m", GLISSANDO_m },
+        { "t", GLISSANDO_t },
+    };
+    std::unordered_map<std::string, data_GLISSANDO>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.GLISSANDO", value.c_str());
     return GLISSANDO_NONE;
 }
@@ -649,9 +718,13 @@ std::string AttConverter::GraceToStr(data_GRACE data) const
 
 data_GRACE AttConverter::StrToGrace(std::string value) const
 {
-    if (value == "acc") return GRACE_acc;
-    if (value == "unacc") return GRACE_unacc;
-    if (value == "unknown") return GRACE_unknown;
+    static const std::unordered_map<std::string, data_GRACE> values = {
+        { "acc", GRACE_acc },
+        { "unacc", GRACE_unacc },
+        { "unknown", GRACE_unknown },
+    };
+    std::unordered_map<std::string, data_GRACE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.GRACE", value.c_str());
     return GRACE_NONE;
 }
@@ -686,22 +759,26 @@ std::string AttConverter::HeadshapeListToStr(data_HEADSHAPE_list data) const
 
 data_HEADSHAPE_list AttConverter::StrToHeadshapeList(std::string value) const
 {
-    if (value == "quarter") return HEADSHAPE_list_quarter;
-    if (value == "half") return HEADSHAPE_list_half;
-    if (value == "whole") return HEADSHAPE_list_whole;
-    if (value == "backslash") return HEADSHAPE_list_backslash;
-    if (value == "circle") return HEADSHAPE_list_circle;
-    if (value == "+") return HEADSHAPE_list_plus;
-    if (value == "diamond") return HEADSHAPE_list_diamond;
-    if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
-    if (value == "oval") return HEADSHAPE_list_oval;
-    if (value == "piewedge") return HEADSHAPE_list_piewedge;
-    if (value == "rectangle") return HEADSHAPE_list_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_list_semicircle;
-    if (value == "slash") return HEADSHAPE_list_slash;
-    if (value == "square") return HEADSHAPE_list_square;
-    if (value == "x") return HEADSHAPE_list_x;
+    static const std::unordered_map<std::string, data_HEADSHAPE_list> values = {
+        { "quarter", HEADSHAPE_list_quarter },
+        { "half", HEADSHAPE_list_half },
+        { "whole", HEADSHAPE_list_whole },
+        { "backslash", HEADSHAPE_list_backslash },
+        { "circle", HEADSHAPE_list_circle },
+        { "+", HEADSHAPE_list_plus },
+        { "diamond", HEADSHAPE_list_diamond },
+        { "isotriangle", HEADSHAPE_list_isotriangle },
+        { "oval", HEADSHAPE_list_oval },
+        { "piewedge", HEADSHAPE_list_piewedge },
+        { "rectangle", HEADSHAPE_list_rectangle },
+        { "rtriangle", HEADSHAPE_list_rtriangle },
+        { "semicircle", HEADSHAPE_list_semicircle },
+        { "slash", HEADSHAPE_list_slash },
+        { "square", HEADSHAPE_list_square },
+        { "x", HEADSHAPE_list_x },
+    };
+    std::unordered_map<std::string, data_HEADSHAPE_list>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value.c_str());
     return HEADSHAPE_list_NONE;
 }
@@ -724,10 +801,14 @@ std::string AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data
 
 data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string value) const
 {
-    if (value == "left") return HORIZONTALALIGNMENT_left;
-    if (value == "right") return HORIZONTALALIGNMENT_right;
-    if (value == "center") return HORIZONTALALIGNMENT_center;
-    if (value == "justify") return HORIZONTALALIGNMENT_justify;
+    static const std::unordered_map<std::string, data_HORIZONTALALIGNMENT> values = {
+        { "left", HORIZONTALALIGNMENT_left },
+        { "right", HORIZONTALALIGNMENT_right },
+        { "center", HORIZONTALALIGNMENT_center },
+        { "justify", HORIZONTALALIGNMENT_justify },
+    };
+    std::unordered_map<std::string, data_HORIZONTALALIGNMENT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value.c_str());
     return HORIZONTALALIGNMENT_NONE;
 }
@@ -751,11 +832,15 @@ std::string AttConverter::IneumeformToStr(data_INEUMEFORM data) const
 
 data_INEUMEFORM AttConverter::StrToIneumeform(std::string value) const
 {
-    if (value == "liquescent1") return INEUMEFORM_liquescent1;
-    if (value == "liquescent2") return INEUMEFORM_liquescent2;
-    if (value == "tied") return INEUMEFORM_tied;
-    if (value == "tiedliquescent1") return INEUMEFORM_tiedliquescent1;
-    if (value == "tiedliquescent2") return INEUMEFORM_tiedliquescent2;
+    static const std::unordered_map<std::string, data_INEUMEFORM> values = {
+        { "liquescent1", INEUMEFORM_liquescent1 },
+        { "liquescent2", INEUMEFORM_liquescent2 },
+        { "tied", INEUMEFORM_tied },
+        { "tiedliquescent1", INEUMEFORM_tiedliquescent1 },
+        { "tiedliquescent2", INEUMEFORM_tiedliquescent2 },
+    };
+    std::unordered_map<std::string, data_INEUMEFORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.INEUMEFORM", value.c_str());
     return INEUMEFORM_NONE;
 }
@@ -781,13 +866,17 @@ std::string AttConverter::IneumenameToStr(data_INEUMENAME data) const
 
 data_INEUMENAME AttConverter::StrToIneumename(std::string value) const
 {
-    if (value == "pessubpunctis") return INEUMENAME_pessubpunctis;
-    if (value == "climacus") return INEUMENAME_climacus;
-    if (value == "scandicus") return INEUMENAME_scandicus;
-    if (value == "bistropha") return INEUMENAME_bistropha;
-    if (value == "tristropha") return INEUMENAME_tristropha;
-    if (value == "pressusminor") return INEUMENAME_pressusminor;
-    if (value == "pressusmaior") return INEUMENAME_pressusmaior;
+    static const std::unordered_map<std::string, data_INEUMENAME> values = {
+        { "pessubpunctis", INEUMENAME_pessubpunctis },
+        { "climacus", INEUMENAME_climacus },
+        { "scandicus", INEUMENAME_scandicus },
+        { "bistropha", INEUMENAME_bistropha },
+        { "tristropha", INEUMENAME_tristropha },
+        { "pressusminor", INEUMENAME_pressusminor },
+        { "pressusmaior", INEUMENAME_pressusmaior },
+    };
+    std::unordered_map<std::string, data_INEUMENAME>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.INEUMENAME", value.c_str());
     return INEUMENAME_NONE;
 }
@@ -811,11 +900,15 @@ std::string AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
 
 data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string value) const
 {
-    if (value == "1") return LAYERSCHEME_1;
-    if (value == "2o") return LAYERSCHEME_2o;
-    if (value == "2f") return LAYERSCHEME_2f;
-    if (value == "3o") return LAYERSCHEME_3o;
-    if (value == "3f") return LAYERSCHEME_3f;
+    static const std::unordered_map<std::string, data_LAYERSCHEME> values = {
+        { "1", LAYERSCHEME_1 },
+        { "2o", LAYERSCHEME_2o },
+        { "2f", LAYERSCHEME_2f },
+        { "3o", LAYERSCHEME_3o },
+        { "3f", LAYERSCHEME_3f },
+    };
+    std::unordered_map<std::string, data_LAYERSCHEME>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value.c_str());
     return LAYERSCHEME_NONE;
 }
@@ -836,8 +929,12 @@ std::string AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
 
 data_LIGATUREFORM AttConverter::StrToLigatureform(std::string value) const
 {
-    if (value == "recta") return LIGATUREFORM_recta;
-    if (value == "obliqua") return LIGATUREFORM_obliqua;
+    static const std::unordered_map<std::string, data_LIGATUREFORM> values = {
+        { "recta", LIGATUREFORM_recta },
+        { "obliqua", LIGATUREFORM_obliqua },
+    };
+    std::unordered_map<std::string, data_LIGATUREFORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value.c_str());
     return LIGATUREFORM_NONE;
 }
@@ -860,10 +957,14 @@ std::string AttConverter::LineformToStr(data_LINEFORM data) const
 
 data_LINEFORM AttConverter::StrToLineform(std::string value) const
 {
-    if (value == "dashed") return LINEFORM_dashed;
-    if (value == "dotted") return LINEFORM_dotted;
-    if (value == "solid") return LINEFORM_solid;
-    if (value == "wavy") return LINEFORM_wavy;
+    static const std::unordered_map<std::string, data_LINEFORM> values = {
+        { "dashed", LINEFORM_dashed },
+        { "dotted", LINEFORM_dotted },
+        { "solid", LINEFORM_solid },
+        { "wavy", LINEFORM_wavy },
+    };
+    std::unordered_map<std::string, data_LINEFORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.LINEFORM", value.c_str());
     return LINEFORM_NONE;
 }
@@ -892,16 +993,20 @@ std::string AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data)
 
 data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string value) const
 {
-    if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
-    if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
-    if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
-    if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
-    if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
-    if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
-    if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
-    if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
-    if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
-    if (value == "none") return LINESTARTENDSYMBOL_none;
+    static const std::unordered_map<std::string, data_LINESTARTENDSYMBOL> values = {
+        { "angledown", LINESTARTENDSYMBOL_angledown },
+        { "angleup", LINESTARTENDSYMBOL_angleup },
+        { "angleright", LINESTARTENDSYMBOL_angleright },
+        { "angleleft", LINESTARTENDSYMBOL_angleleft },
+        { "arrow", LINESTARTENDSYMBOL_arrow },
+        { "arrowopen", LINESTARTENDSYMBOL_arrowopen },
+        { "arrowwhite", LINESTARTENDSYMBOL_arrowwhite },
+        { "harpoonleft", LINESTARTENDSYMBOL_harpoonleft },
+        { "harpoonright", LINESTARTENDSYMBOL_harpoonright },
+        { "none", LINESTARTENDSYMBOL_none },
+    };
+    std::unordered_map<std::string, data_LINESTARTENDSYMBOL>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value.c_str());
     return LINESTARTENDSYMBOL_NONE;
 }
@@ -923,9 +1028,13 @@ std::string AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
 
 data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string value) const
 {
-    if (value == "narrow") return LINEWIDTHTERM_narrow;
-    if (value == "medium") return LINEWIDTHTERM_medium;
-    if (value == "wide") return LINEWIDTHTERM_wide;
+    static const std::unordered_map<std::string, data_LINEWIDTHTERM> values = {
+        { "narrow", LINEWIDTHTERM_narrow },
+        { "medium", LINEWIDTHTERM_medium },
+        { "wide", LINEWIDTHTERM_wide },
+    };
+    std::unordered_map<std::string, data_LINEWIDTHTERM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value.c_str());
     return LINEWIDTHTERM_NONE;
 }
@@ -972,34 +1081,38 @@ std::string AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
 
 data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string value) const
 {
-    if (value == "aln") return MELODICFUNCTION_aln;
-    if (value == "ant") return MELODICFUNCTION_ant;
-    if (value == "app") return MELODICFUNCTION_app;
-    if (value == "apt") return MELODICFUNCTION_apt;
-    if (value == "arp") return MELODICFUNCTION_arp;
-    if (value == "arp7") return MELODICFUNCTION_arp7;
-    if (value == "aun") return MELODICFUNCTION_aun;
-    if (value == "chg") return MELODICFUNCTION_chg;
-    if (value == "cln") return MELODICFUNCTION_cln;
-    if (value == "ct") return MELODICFUNCTION_ct;
-    if (value == "ct7") return MELODICFUNCTION_ct7;
-    if (value == "cun") return MELODICFUNCTION_cun;
-    if (value == "cup") return MELODICFUNCTION_cup;
-    if (value == "et") return MELODICFUNCTION_et;
-    if (value == "ln") return MELODICFUNCTION_ln;
-    if (value == "ped") return MELODICFUNCTION_ped;
-    if (value == "rep") return MELODICFUNCTION_rep;
-    if (value == "ret") return MELODICFUNCTION_ret;
-    if (value == "23ret") return MELODICFUNCTION_23ret;
-    if (value == "78ret") return MELODICFUNCTION_78ret;
-    if (value == "sus") return MELODICFUNCTION_sus;
-    if (value == "43sus") return MELODICFUNCTION_43sus;
-    if (value == "98sus") return MELODICFUNCTION_98sus;
-    if (value == "76sus") return MELODICFUNCTION_76sus;
-    if (value == "un") return MELODICFUNCTION_un;
-    if (value == "un7") return MELODICFUNCTION_un7;
-    if (value == "upt") return MELODICFUNCTION_upt;
-    if (value == "upt7") return MELODICFUNCTION_upt7;
+    static const std::unordered_map<std::string, data_MELODICFUNCTION> values = {
+        { "aln", MELODICFUNCTION_aln },
+        { "ant", MELODICFUNCTION_ant },
+        { "app", MELODICFUNCTION_app },
+        { "apt", MELODICFUNCTION_apt },
+        { "arp", MELODICFUNCTION_arp },
+        { "arp7", MELODICFUNCTION_arp7 },
+        { "aun", MELODICFUNCTION_aun },
+        { "chg", MELODICFUNCTION_chg },
+        { "cln", MELODICFUNCTION_cln },
+        { "ct", MELODICFUNCTION_ct },
+        { "ct7", MELODICFUNCTION_ct7 },
+        { "cun", MELODICFUNCTION_cun },
+        { "cup", MELODICFUNCTION_cup },
+        { "et", MELODICFUNCTION_et },
+        { "ln", MELODICFUNCTION_ln },
+        { "ped", MELODICFUNCTION_ped },
+        { "rep", MELODICFUNCTION_rep },
+        { "ret", MELODICFUNCTION_ret },
+        { "23ret", MELODICFUNCTION_23ret },
+        { "78ret", MELODICFUNCTION_78ret },
+        { "sus", MELODICFUNCTION_sus },
+        { "43sus", MELODICFUNCTION_43sus },
+        { "98sus", MELODICFUNCTION_98sus },
+        { "76sus", MELODICFUNCTION_76sus },
+        { "un", MELODICFUNCTION_un },
+        { "un7", MELODICFUNCTION_un7 },
+        { "upt", MELODICFUNCTION_upt },
+        { "upt7", MELODICFUNCTION_upt7 },
+    };
+    std::unordered_map<std::string, data_MELODICFUNCTION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value.c_str());
     return MELODICFUNCTION_NONE;
 }
@@ -1020,8 +1133,12 @@ std::string AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
 
 data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string value) const
 {
-    if (value == "C") return MENSURATIONSIGN_C;
-    if (value == "O") return MENSURATIONSIGN_O;
+    static const std::unordered_map<std::string, data_MENSURATIONSIGN> values = {
+        { "C", MENSURATIONSIGN_C },
+        { "O", MENSURATIONSIGN_O },
+    };
+    std::unordered_map<std::string, data_MENSURATIONSIGN>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value.c_str());
     return MENSURATIONSIGN_NONE;
 }
@@ -1042,8 +1159,12 @@ std::string AttConverter::MetersignToStr(data_METERSIGN data) const
 
 data_METERSIGN AttConverter::StrToMetersign(std::string value) const
 {
-    if (value == "common") return METERSIGN_common;
-    if (value == "cut") return METERSIGN_cut;
+    static const std::unordered_map<std::string, data_METERSIGN> values = {
+        { "common", METERSIGN_common },
+        { "cut", METERSIGN_cut },
+    };
+    std::unordered_map<std::string, data_METERSIGN>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.METERSIGN", value.c_str());
     return METERSIGN_NONE;
 }
@@ -1237,181 +1358,185 @@ std::string AttConverter::MidinamesToStr(data_MIDINAMES data) const
 
 data_MIDINAMES AttConverter::StrToMidinames(std::string value) const
 {
-    if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
-    if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
-    if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
-    if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
-    if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
-    if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
-    if (value == "Harpsichord") return MIDINAMES_Harpsichord;
-    if (value == "Clavi") return MIDINAMES_Clavi;
-    if (value == "Celesta") return MIDINAMES_Celesta;
-    if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
-    if (value == "Music_Box") return MIDINAMES_Music_Box;
-    if (value == "Vibraphone") return MIDINAMES_Vibraphone;
-    if (value == "Marimba") return MIDINAMES_Marimba;
-    if (value == "Xylophone") return MIDINAMES_Xylophone;
-    if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
-    if (value == "Dulcimer") return MIDINAMES_Dulcimer;
-    if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
-    if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
-    if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
-    if (value == "Church_Organ") return MIDINAMES_Church_Organ;
-    if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
-    if (value == "Accordion") return MIDINAMES_Accordion;
-    if (value == "Harmonica") return MIDINAMES_Harmonica;
-    if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
-    if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
-    if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
-    if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
-    if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
-    if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
-    if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
-    if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
-    if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
-    if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
-    if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
-    if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
-    if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
-    if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
-    if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
-    if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
-    if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
-    if (value == "Violin") return MIDINAMES_Violin;
-    if (value == "Viola") return MIDINAMES_Viola;
-    if (value == "Cello") return MIDINAMES_Cello;
-    if (value == "Contrabass") return MIDINAMES_Contrabass;
-    if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
-    if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
-    if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
-    if (value == "Timpani") return MIDINAMES_Timpani;
-    if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
-    if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
-    if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
-    if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
-    if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
-    if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
-    if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
-    if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
-    if (value == "Trumpet") return MIDINAMES_Trumpet;
-    if (value == "Trombone") return MIDINAMES_Trombone;
-    if (value == "Tuba") return MIDINAMES_Tuba;
-    if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
-    if (value == "French_Horn") return MIDINAMES_French_Horn;
-    if (value == "Brass_Section") return MIDINAMES_Brass_Section;
-    if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
-    if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
-    if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
-    if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
-    if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
-    if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
-    if (value == "Oboe") return MIDINAMES_Oboe;
-    if (value == "English_Horn") return MIDINAMES_English_Horn;
-    if (value == "Bassoon") return MIDINAMES_Bassoon;
-    if (value == "Clarinet") return MIDINAMES_Clarinet;
-    if (value == "Piccolo") return MIDINAMES_Piccolo;
-    if (value == "Flute") return MIDINAMES_Flute;
-    if (value == "Recorder") return MIDINAMES_Recorder;
-    if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
-    if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
-    if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
-    if (value == "Whistle") return MIDINAMES_Whistle;
-    if (value == "Ocarina") return MIDINAMES_Ocarina;
-    if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
-    if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
-    if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
-    if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
-    if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
-    if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
-    if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
-    if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
-    if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
-    if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
-    if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
-    if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
-    if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
-    if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
-    if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
-    if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
-    if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
-    if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
-    if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
-    if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
-    if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
-    if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
-    if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
-    if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
-    if (value == "Sitar") return MIDINAMES_Sitar;
-    if (value == "Banjo") return MIDINAMES_Banjo;
-    if (value == "Shamisen") return MIDINAMES_Shamisen;
-    if (value == "Koto") return MIDINAMES_Koto;
-    if (value == "Kalimba") return MIDINAMES_Kalimba;
-    if (value == "Bagpipe") return MIDINAMES_Bagpipe;
-    if (value == "Fiddle") return MIDINAMES_Fiddle;
-    if (value == "Shanai") return MIDINAMES_Shanai;
-    if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
-    if (value == "Agogo") return MIDINAMES_Agogo;
-    if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
-    if (value == "Woodblock") return MIDINAMES_Woodblock;
-    if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
-    if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
-    if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
-    if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
-    if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
-    if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
-    if (value == "Seashore") return MIDINAMES_Seashore;
-    if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
-    if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
-    if (value == "Helicopter") return MIDINAMES_Helicopter;
-    if (value == "Applause") return MIDINAMES_Applause;
-    if (value == "Gunshot") return MIDINAMES_Gunshot;
-    if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
-    if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
-    if (value == "Side_Stick") return MIDINAMES_Side_Stick;
-    if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
-    if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
-    if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
-    if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
-    if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
-    if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
-    if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
-    if (value == "Low_Tom") return MIDINAMES_Low_Tom;
-    if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
-    if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
-    if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
-    if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
-    if (value == "High_Tom") return MIDINAMES_High_Tom;
-    if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
-    if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
-    if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
-    if (value == "Tambourine") return MIDINAMES_Tambourine;
-    if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
-    if (value == "Cowbell") return MIDINAMES_Cowbell;
-    if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
-    if (value == "Vibraslap") return MIDINAMES_Vibraslap;
-    if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
-    if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
-    if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
-    if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
-    if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
-    if (value == "Low_Conga") return MIDINAMES_Low_Conga;
-    if (value == "High_Timbale") return MIDINAMES_High_Timbale;
-    if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
-    if (value == "High_Agogo") return MIDINAMES_High_Agogo;
-    if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
-    if (value == "Cabasa") return MIDINAMES_Cabasa;
-    if (value == "Maracas") return MIDINAMES_Maracas;
-    if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
-    if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
-    if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
-    if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
-    if (value == "Claves") return MIDINAMES_Claves;
-    if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
-    if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
-    if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
-    if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
-    if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
-    if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
+    static const std::unordered_map<std::string, data_MIDINAMES> values = {
+        { "Acoustic_Grand_Piano", MIDINAMES_Acoustic_Grand_Piano },
+        { "Bright_Acoustic_Piano", MIDINAMES_Bright_Acoustic_Piano },
+        { "Electric_Grand_Piano", MIDINAMES_Electric_Grand_Piano },
+        { "Honky-tonk_Piano", MIDINAMES_Honky_tonk_Piano },
+        { "Electric_Piano_1", MIDINAMES_Electric_Piano_1 },
+        { "Electric_Piano_2", MIDINAMES_Electric_Piano_2 },
+        { "Harpsichord", MIDINAMES_Harpsichord },
+        { "Clavi", MIDINAMES_Clavi },
+        { "Celesta", MIDINAMES_Celesta },
+        { "Glockenspiel", MIDINAMES_Glockenspiel },
+        { "Music_Box", MIDINAMES_Music_Box },
+        { "Vibraphone", MIDINAMES_Vibraphone },
+        { "Marimba", MIDINAMES_Marimba },
+        { "Xylophone", MIDINAMES_Xylophone },
+        { "Tubular_Bells", MIDINAMES_Tubular_Bells },
+        { "Dulcimer", MIDINAMES_Dulcimer },
+        { "Drawbar_Organ", MIDINAMES_Drawbar_Organ },
+        { "Percussive_Organ", MIDINAMES_Percussive_Organ },
+        { "Rock_Organ", MIDINAMES_Rock_Organ },
+        { "Church_Organ", MIDINAMES_Church_Organ },
+        { "Reed_Organ", MIDINAMES_Reed_Organ },
+        { "Accordion", MIDINAMES_Accordion },
+        { "Harmonica", MIDINAMES_Harmonica },
+        { "Tango_Accordion", MIDINAMES_Tango_Accordion },
+        { "Acoustic_Guitar_nylon", MIDINAMES_Acoustic_Guitar_nylon },
+        { "Acoustic_Guitar_steel", MIDINAMES_Acoustic_Guitar_steel },
+        { "Electric_Guitar_jazz", MIDINAMES_Electric_Guitar_jazz },
+        { "Electric_Guitar_clean", MIDINAMES_Electric_Guitar_clean },
+        { "Electric_Guitar_muted", MIDINAMES_Electric_Guitar_muted },
+        { "Overdriven_Guitar", MIDINAMES_Overdriven_Guitar },
+        { "Distortion_Guitar", MIDINAMES_Distortion_Guitar },
+        { "Guitar_harmonics", MIDINAMES_Guitar_harmonics },
+        { "Acoustic_Bass", MIDINAMES_Acoustic_Bass },
+        { "Electric_Bass_finger", MIDINAMES_Electric_Bass_finger },
+        { "Electric_Bass_pick", MIDINAMES_Electric_Bass_pick },
+        { "Fretless_Bass", MIDINAMES_Fretless_Bass },
+        { "Slap_Bass_1", MIDINAMES_Slap_Bass_1 },
+        { "Slap_Bass_2", MIDINAMES_Slap_Bass_2 },
+        { "Synth_Bass_1", MIDINAMES_Synth_Bass_1 },
+        { "Synth_Bass_2", MIDINAMES_Synth_Bass_2 },
+        { "Violin", MIDINAMES_Violin },
+        { "Viola", MIDINAMES_Viola },
+        { "Cello", MIDINAMES_Cello },
+        { "Contrabass", MIDINAMES_Contrabass },
+        { "Tremolo_Strings", MIDINAMES_Tremolo_Strings },
+        { "Pizzicato_Strings", MIDINAMES_Pizzicato_Strings },
+        { "Orchestral_Harp", MIDINAMES_Orchestral_Harp },
+        { "Timpani", MIDINAMES_Timpani },
+        { "String_Ensemble_1", MIDINAMES_String_Ensemble_1 },
+        { "String_Ensemble_2", MIDINAMES_String_Ensemble_2 },
+        { "SynthStrings_1", MIDINAMES_SynthStrings_1 },
+        { "SynthStrings_2", MIDINAMES_SynthStrings_2 },
+        { "Choir_Aahs", MIDINAMES_Choir_Aahs },
+        { "Voice_Oohs", MIDINAMES_Voice_Oohs },
+        { "Synth_Voice", MIDINAMES_Synth_Voice },
+        { "Orchestra_Hit", MIDINAMES_Orchestra_Hit },
+        { "Trumpet", MIDINAMES_Trumpet },
+        { "Trombone", MIDINAMES_Trombone },
+        { "Tuba", MIDINAMES_Tuba },
+        { "Muted_Trumpet", MIDINAMES_Muted_Trumpet },
+        { "French_Horn", MIDINAMES_French_Horn },
+        { "Brass_Section", MIDINAMES_Brass_Section },
+        { "SynthBrass_1", MIDINAMES_SynthBrass_1 },
+        { "SynthBrass_2", MIDINAMES_SynthBrass_2 },
+        { "Soprano_Sax", MIDINAMES_Soprano_Sax },
+        { "Alto_Sax", MIDINAMES_Alto_Sax },
+        { "Tenor_Sax", MIDINAMES_Tenor_Sax },
+        { "Baritone_Sax", MIDINAMES_Baritone_Sax },
+        { "Oboe", MIDINAMES_Oboe },
+        { "English_Horn", MIDINAMES_English_Horn },
+        { "Bassoon", MIDINAMES_Bassoon },
+        { "Clarinet", MIDINAMES_Clarinet },
+        { "Piccolo", MIDINAMES_Piccolo },
+        { "Flute", MIDINAMES_Flute },
+        { "Recorder", MIDINAMES_Recorder },
+        { "Pan_Flute", MIDINAMES_Pan_Flute },
+        { "Blown_Bottle", MIDINAMES_Blown_Bottle },
+        { "Shakuhachi", MIDINAMES_Shakuhachi },
+        { "Whistle", MIDINAMES_Whistle },
+        { "Ocarina", MIDINAMES_Ocarina },
+        { "Lead_1_square", MIDINAMES_Lead_1_square },
+        { "Lead_2_sawtooth", MIDINAMES_Lead_2_sawtooth },
+        { "Lead_3_calliope", MIDINAMES_Lead_3_calliope },
+        { "Lead_4_chiff", MIDINAMES_Lead_4_chiff },
+        { "Lead_5_charang", MIDINAMES_Lead_5_charang },
+        { "Lead_6_voice", MIDINAMES_Lead_6_voice },
+        { "Lead_7_fifths", MIDINAMES_Lead_7_fifths },
+        { "Lead_8_bass_and_lead", MIDINAMES_Lead_8_bass_and_lead },
+        { "Pad_1_new_age", MIDINAMES_Pad_1_new_age },
+        { "Pad_2_warm", MIDINAMES_Pad_2_warm },
+        { "Pad_3_polysynth", MIDINAMES_Pad_3_polysynth },
+        { "Pad_4_choir", MIDINAMES_Pad_4_choir },
+        { "Pad_5_bowed", MIDINAMES_Pad_5_bowed },
+        { "Pad_6_metallic", MIDINAMES_Pad_6_metallic },
+        { "Pad_7_halo", MIDINAMES_Pad_7_halo },
+        { "Pad_8_sweep", MIDINAMES_Pad_8_sweep },
+        { "FX_1_rain", MIDINAMES_FX_1_rain },
+        { "FX_2_soundtrack", MIDINAMES_FX_2_soundtrack },
+        { "FX_3_crystal", MIDINAMES_FX_3_crystal },
+        { "FX_4_atmosphere", MIDINAMES_FX_4_atmosphere },
+        { "FX_5_brightness", MIDINAMES_FX_5_brightness },
+        { "FX_6_goblins", MIDINAMES_FX_6_goblins },
+        { "FX_7_echoes", MIDINAMES_FX_7_echoes },
+        { "FX_8_sci-fi", MIDINAMES_FX_8_sci_fi },
+        { "Sitar", MIDINAMES_Sitar },
+        { "Banjo", MIDINAMES_Banjo },
+        { "Shamisen", MIDINAMES_Shamisen },
+        { "Koto", MIDINAMES_Koto },
+        { "Kalimba", MIDINAMES_Kalimba },
+        { "Bagpipe", MIDINAMES_Bagpipe },
+        { "Fiddle", MIDINAMES_Fiddle },
+        { "Shanai", MIDINAMES_Shanai },
+        { "Tinkle_Bell", MIDINAMES_Tinkle_Bell },
+        { "Agogo", MIDINAMES_Agogo },
+        { "Steel_Drums", MIDINAMES_Steel_Drums },
+        { "Woodblock", MIDINAMES_Woodblock },
+        { "Taiko_Drum", MIDINAMES_Taiko_Drum },
+        { "Melodic_Tom", MIDINAMES_Melodic_Tom },
+        { "Synth_Drum", MIDINAMES_Synth_Drum },
+        { "Reverse_Cymbal", MIDINAMES_Reverse_Cymbal },
+        { "Guitar_Fret_Noise", MIDINAMES_Guitar_Fret_Noise },
+        { "Breath_Noise", MIDINAMES_Breath_Noise },
+        { "Seashore", MIDINAMES_Seashore },
+        { "Bird_Tweet", MIDINAMES_Bird_Tweet },
+        { "Telephone_Ring", MIDINAMES_Telephone_Ring },
+        { "Helicopter", MIDINAMES_Helicopter },
+        { "Applause", MIDINAMES_Applause },
+        { "Gunshot", MIDINAMES_Gunshot },
+        { "Acoustic_Bass_Drum", MIDINAMES_Acoustic_Bass_Drum },
+        { "Bass_Drum_1", MIDINAMES_Bass_Drum_1 },
+        { "Side_Stick", MIDINAMES_Side_Stick },
+        { "Acoustic_Snare", MIDINAMES_Acoustic_Snare },
+        { "Hand_Clap", MIDINAMES_Hand_Clap },
+        { "Electric_Snare", MIDINAMES_Electric_Snare },
+        { "Low_Floor_Tom", MIDINAMES_Low_Floor_Tom },
+        { "Closed_Hi_Hat", MIDINAMES_Closed_Hi_Hat },
+        { "High_Floor_Tom", MIDINAMES_High_Floor_Tom },
+        { "Pedal_Hi-Hat", MIDINAMES_Pedal_Hi_Hat },
+        { "Low_Tom", MIDINAMES_Low_Tom },
+        { "Open_Hi-Hat", MIDINAMES_Open_Hi_Hat },
+        { "Low-Mid_Tom", MIDINAMES_Low_Mid_Tom },
+        { "Hi-Mid_Tom", MIDINAMES_Hi_Mid_Tom },
+        { "Crash_Cymbal_1", MIDINAMES_Crash_Cymbal_1 },
+        { "High_Tom", MIDINAMES_High_Tom },
+        { "Ride_Cymbal_1", MIDINAMES_Ride_Cymbal_1 },
+        { "Chinese_Cymbal", MIDINAMES_Chinese_Cymbal },
+        { "Ride_Bell", MIDINAMES_Ride_Bell },
+        { "Tambourine", MIDINAMES_Tambourine },
+        { "Splash_Cymbal", MIDINAMES_Splash_Cymbal },
+        { "Cowbell", MIDINAMES_Cowbell },
+        { "Crash_Cymbal_2", MIDINAMES_Crash_Cymbal_2 },
+        { "Vibraslap", MIDINAMES_Vibraslap },
+        { "Ride_Cymbal_2", MIDINAMES_Ride_Cymbal_2 },
+        { "Hi_Bongo", MIDINAMES_Hi_Bongo },
+        { "Low_Bongo", MIDINAMES_Low_Bongo },
+        { "Mute_Hi_Conga", MIDINAMES_Mute_Hi_Conga },
+        { "Open_Hi_Conga", MIDINAMES_Open_Hi_Conga },
+        { "Low_Conga", MIDINAMES_Low_Conga },
+        { "High_Timbale", MIDINAMES_High_Timbale },
+        { "Low_Timbale", MIDINAMES_Low_Timbale },
+        { "High_Agogo", MIDINAMES_High_Agogo },
+        { "Low_Agogo", MIDINAMES_Low_Agogo },
+        { "Cabasa", MIDINAMES_Cabasa },
+        { "Maracas", MIDINAMES_Maracas },
+        { "Short_Whistle", MIDINAMES_Short_Whistle },
+        { "Long_Whistle", MIDINAMES_Long_Whistle },
+        { "Short_Guiro", MIDINAMES_Short_Guiro },
+        { "Long_Guiro", MIDINAMES_Long_Guiro },
+        { "Claves", MIDINAMES_Claves },
+        { "Hi_Wood_Block", MIDINAMES_Hi_Wood_Block },
+        { "Low_Wood_Block", MIDINAMES_Low_Wood_Block },
+        { "Mute_Cuica", MIDINAMES_Mute_Cuica },
+        { "Open_Cuica", MIDINAMES_Open_Cuica },
+        { "Mute_Triangle", MIDINAMES_Mute_Triangle },
+        { "Open_Triangle", MIDINAMES_Open_Triangle },
+    };
+    std::unordered_map<std::string, data_MIDINAMES>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.MIDINAMES", value.c_str());
     return MIDINAMES_NONE;
 }
@@ -1438,14 +1563,18 @@ std::string AttConverter::ModeToStr(data_MODE data) const
 
 data_MODE AttConverter::StrToMode(std::string value) const
 {
-    if (value == "major") return MODE_major;
-    if (value == "minor") return MODE_minor;
-    if (value == "dorian") return MODE_dorian;
-    if (value == "phrygian") return MODE_phrygian;
-    if (value == "lydian") return MODE_lydian;
-    if (value == "mixolydian") return MODE_mixolydian;
-    if (value == "aeolian") return MODE_aeolian;
-    if (value == "locrian") return MODE_locrian;
+    static const std::unordered_map<std::string, data_MODE> values = {
+        { "major", MODE_major },
+        { "minor", MODE_minor },
+        { "dorian", MODE_dorian },
+        { "phrygian", MODE_phrygian },
+        { "lydian", MODE_lydian },
+        { "mixolydian", MODE_mixolydian },
+        { "aeolian", MODE_aeolian },
+        { "locrian", MODE_locrian },
+    };
+    std::unordered_map<std::string, data_MODE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.MODE", value.c_str());
     return MODE_NONE;
 }
@@ -1470,12 +1599,16 @@ std::string AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
 
 data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string value) const
 {
-    if (value == "cmn") return NOTATIONTYPE_cmn;
-    if (value == "mensural") return NOTATIONTYPE_mensural;
-    if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
-    if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
-    if (value == "neume") return NOTATIONTYPE_neume;
-    if (value == "tab") return NOTATIONTYPE_tab;
+    static const std::unordered_map<std::string, data_NOTATIONTYPE> values = {
+        { "cmn", NOTATIONTYPE_cmn },
+        { "mensural", NOTATIONTYPE_mensural },
+        { "mensural.black", NOTATIONTYPE_mensural_black },
+        { "mensural.white", NOTATIONTYPE_mensural_white },
+        { "neume", NOTATIONTYPE_neume },
+        { "tab", NOTATIONTYPE_tab },
+    };
+    std::unordered_map<std::string, data_NOTATIONTYPE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value.c_str());
     return NOTATIONTYPE_NONE;
 }
@@ -1504,16 +1637,20 @@ std::string AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list d
 
 data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string value) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_list_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_list_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_list_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_list_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_list_brack;
-    if (value == "box") return NOTEHEADMODIFIER_list_box;
-    if (value == "circle") return NOTEHEADMODIFIER_list_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_list_dblwhole;
+    static const std::unordered_map<std::string, data_NOTEHEADMODIFIER_list> values = {
+        { "slash", NOTEHEADMODIFIER_list_slash },
+        { "backslash", NOTEHEADMODIFIER_list_backslash },
+        { "vline", NOTEHEADMODIFIER_list_vline },
+        { "hline", NOTEHEADMODIFIER_list_hline },
+        { "centerdot", NOTEHEADMODIFIER_list_centerdot },
+        { "paren", NOTEHEADMODIFIER_list_paren },
+        { "brack", NOTEHEADMODIFIER_list_brack },
+        { "box", NOTEHEADMODIFIER_list_box },
+        { "circle", NOTEHEADMODIFIER_list_circle },
+        { "dblwhole", NOTEHEADMODIFIER_list_dblwhole },
+    };
+    std::unordered_map<std::string, data_NOTEHEADMODIFIER_list>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value.c_str());
     return NOTEHEADMODIFIER_list_NONE;
 }
@@ -1534,8 +1671,12 @@ std::string AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
 
 data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string value) const
 {
-    if (value == "above") return OTHERSTAFF_above;
-    if (value == "below") return OTHERSTAFF_below;
+    static const std::unordered_map<std::string, data_OTHERSTAFF> values = {
+        { "above", OTHERSTAFF_above },
+        { "below", OTHERSTAFF_below },
+    };
+    std::unordered_map<std::string, data_OTHERSTAFF>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value.c_str());
     return OTHERSTAFF_NONE;
 }
@@ -1556,8 +1697,12 @@ std::string AttConverter::PlaceToStr(data_PLACE data) const
 
 data_PLACE AttConverter::StrToPlace(std::string value) const
 {
-    if (value == "above") return PLACE_above;
-    if (value == "below") return PLACE_below;
+    static const std::unordered_map<std::string, data_PLACE> values = {
+        { "above", PLACE_above },
+        { "below", PLACE_below },
+    };
+    std::unordered_map<std::string, data_PLACE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.PLACE", value.c_str());
     return PLACE_NONE;
 }
@@ -1583,13 +1728,17 @@ std::string AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) co
 
 data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string value) const
 {
-    if (value == "none") return ROTATIONDIRECTION_none;
-    if (value == "down") return ROTATIONDIRECTION_down;
-    if (value == "left") return ROTATIONDIRECTION_left;
-    if (value == "ne") return ROTATIONDIRECTION_ne;
-    if (value == "nw") return ROTATIONDIRECTION_nw;
-    if (value == "se") return ROTATIONDIRECTION_se;
-    if (value == "sw") return ROTATIONDIRECTION_sw;
+    static const std::unordered_map<std::string, data_ROTATIONDIRECTION> values = {
+        { "none", ROTATIONDIRECTION_none },
+        { "down", ROTATIONDIRECTION_down },
+        { "left", ROTATIONDIRECTION_left },
+        { "ne", ROTATIONDIRECTION_ne },
+        { "nw", ROTATIONDIRECTION_nw },
+        { "se", ROTATIONDIRECTION_se },
+        { "sw", ROTATIONDIRECTION_sw },
+    };
+    std::unordered_map<std::string, data_ROTATIONDIRECTION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value.c_str());
     return ROTATIONDIRECTION_NONE;
 }
@@ -1610,8 +1759,12 @@ std::string AttConverter::SizeToStr(data_SIZE data) const
 
 data_SIZE AttConverter::StrToSize(std::string value) const
 {
-    if (value == "normal") return SIZE_normal;
-    if (value == "cue") return SIZE_cue;
+    static const std::unordered_map<std::string, data_SIZE> values = {
+        { "normal", SIZE_normal },
+        { "cue", SIZE_cue },
+    };
+    std::unordered_map<std::string, data_SIZE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.SIZE", value.c_str());
     return SIZE_NONE;
 }
@@ -1633,9 +1786,13 @@ std::string AttConverter::StaffrelToStr(data_STAFFREL data) const
 
 data_STAFFREL AttConverter::StrToStaffrel(std::string value) const
 {
-    if (value == "above") return STAFFREL_above;
-    if (value == "below") return STAFFREL_below;
-    if (value == "within") return STAFFREL_within;
+    static const std::unordered_map<std::string, data_STAFFREL> values = {
+        { "above", STAFFREL_above },
+        { "below", STAFFREL_below },
+        { "within", STAFFREL_within },
+    };
+    std::unordered_map<std::string, data_STAFFREL>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.STAFFREL", value.c_str());
     return STAFFREL_NONE;
 }
@@ -1663,15 +1820,19 @@ std::string AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
 
 data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string value) const
 {
-    if (value == "none") return STEMMODIFIER_none;
-    if (value == "1slash") return STEMMODIFIER_1slash;
-    if (value == "2slash") return STEMMODIFIER_2slash;
-    if (value == "3slash") return STEMMODIFIER_3slash;
-    if (value == "4slash") return STEMMODIFIER_4slash;
-    if (value == "5slash") return STEMMODIFIER_5slash;
-    if (value == "6slash") return STEMMODIFIER_6slash;
-    if (value == "sprech") return STEMMODIFIER_sprech;
-    if (value == "z") return STEMMODIFIER_z;
+    static const std::unordered_map<std::string, data_STEMMODIFIER> values = {
+        { "none", STEMMODIFIER_none },
+        { "1slash", STEMMODIFIER_1slash },
+        { "2slash", STEMMODIFIER_2slash },
+        { "3slash", STEMMODIFIER_3slash },
+        { "4slash", STEMMODIFIER_4slash },
+        { "5slash", STEMMODIFIER_5slash },
+        { "6slash", STEMMODIFIER_6slash },
+        { "sprech", STEMMODIFIER_sprech },
+        { "z", STEMMODIFIER_z },
+    };
+    std::unordered_map<std::string, data_STEMMODIFIER>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value.c_str());
     return STEMMODIFIER_NONE;
 }
@@ -1693,9 +1854,13 @@ std::string AttConverter::StempositionToStr(data_STEMPOSITION data) const
 
 data_STEMPOSITION AttConverter::StrToStemposition(std::string value) const
 {
-    if (value == "left") return STEMPOSITION_left;
-    if (value == "right") return STEMPOSITION_right;
-    if (value == "center") return STEMPOSITION_center;
+    static const std::unordered_map<std::string, data_STEMPOSITION> values = {
+        { "left", STEMPOSITION_left },
+        { "right", STEMPOSITION_right },
+        { "center", STEMPOSITION_center },
+    };
+    std::unordered_map<std::string, data_STEMPOSITION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.STEMPOSITION", value.c_str());
     return STEMPOSITION_NONE;
 }
@@ -1718,10 +1883,14 @@ std::string AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
 
 data_TEMPERAMENT AttConverter::StrToTemperament(std::string value) const
 {
-    if (value == "equal") return TEMPERAMENT_equal;
-    if (value == "just") return TEMPERAMENT_just;
-    if (value == "mean") return TEMPERAMENT_mean;
-    if (value == "pythagorean") return TEMPERAMENT_pythagorean;
+    static const std::unordered_map<std::string, data_TEMPERAMENT> values = {
+        { "equal", TEMPERAMENT_equal },
+        { "just", TEMPERAMENT_just },
+        { "mean", TEMPERAMENT_mean },
+        { "pythagorean", TEMPERAMENT_pythagorean },
+    };
+    std::unordered_map<std::string, data_TEMPERAMENT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value.c_str());
     return TEMPERAMENT_NONE;
 }
@@ -1764,30 +1933,34 @@ std::string AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) co
 
 data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string value) const
 {
-    if (value == "italic") return TEXTRENDITIONLIST_italic;
-    if (value == "oblique") return TEXTRENDITIONLIST_oblique;
-    if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
-    if (value == "bold") return TEXTRENDITIONLIST_bold;
-    if (value == "bolder") return TEXTRENDITIONLIST_bolder;
-    if (value == "lighter") return TEXTRENDITIONLIST_lighter;
-    if (value == "box") return TEXTRENDITIONLIST_box;
-    if (value == "circle") return TEXTRENDITIONLIST_circle;
-    if (value == "dbox") return TEXTRENDITIONLIST_dbox;
-    if (value == "tbox") return TEXTRENDITIONLIST_tbox;
-    if (value == "bslash") return TEXTRENDITIONLIST_bslash;
-    if (value == "fslash") return TEXTRENDITIONLIST_fslash;
-    if (value == "line-through") return TEXTRENDITIONLIST_line_through;
-    if (value == "none") return TEXTRENDITIONLIST_none;
-    if (value == "overline") return TEXTRENDITIONLIST_overline;
-    if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
-    if (value == "strike") return TEXTRENDITIONLIST_strike;
-    if (value == "sub") return TEXTRENDITIONLIST_sub;
-    if (value == "sup") return TEXTRENDITIONLIST_sup;
-    if (value == "underline") return TEXTRENDITIONLIST_underline;
-    if (value == "ltr") return TEXTRENDITIONLIST_ltr;
-    if (value == "rtl") return TEXTRENDITIONLIST_rtl;
-    if (value == "lro") return TEXTRENDITIONLIST_lro;
-    if (value == "rlo") return TEXTRENDITIONLIST_rlo;
+    static const std::unordered_map<std::string, data_TEXTRENDITIONLIST> values = {
+        { "italic", TEXTRENDITIONLIST_italic },
+        { "oblique", TEXTRENDITIONLIST_oblique },
+        { "smcaps", TEXTRENDITIONLIST_smcaps },
+        { "bold", TEXTRENDITIONLIST_bold },
+        { "bolder", TEXTRENDITIONLIST_bolder },
+        { "lighter", TEXTRENDITIONLIST_lighter },
+        { "box", TEXTRENDITIONLIST_box },
+        { "circle", TEXTRENDITIONLIST_circle },
+        { "dbox", TEXTRENDITIONLIST_dbox },
+        { "tbox", TEXTRENDITIONLIST_tbox },
+        { "bslash", TEXTRENDITIONLIST_bslash },
+        { "fslash", TEXTRENDITIONLIST_fslash },
+        { "line-through", TEXTRENDITIONLIST_line_through },
+        { "none", TEXTRENDITIONLIST_none },
+        { "overline", TEXTRENDITIONLIST_overline },
+        { "overstrike", TEXTRENDITIONLIST_overstrike },
+        { "strike", TEXTRENDITIONLIST_strike },
+        { "sub", TEXTRENDITIONLIST_sub },
+        { "sup", TEXTRENDITIONLIST_sup },
+        { "underline", TEXTRENDITIONLIST_underline },
+        { "ltr", TEXTRENDITIONLIST_ltr },
+        { "rtl", TEXTRENDITIONLIST_rtl },
+        { "lro", TEXTRENDITIONLIST_lro },
+        { "rlo", TEXTRENDITIONLIST_rlo },
+    };
+    std::unordered_map<std::string, data_TEXTRENDITIONLIST>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value.c_str());
     return TEXTRENDITIONLIST_NONE;
 }
@@ -1813,13 +1986,17 @@ std::string AttConverter::UneumeformToStr(data_UNEUMEFORM data) const
 
 data_UNEUMEFORM AttConverter::StrToUneumeform(std::string value) const
 {
-    if (value == "liquescent1") return UNEUMEFORM_liquescent1;
-    if (value == "liquescent2") return UNEUMEFORM_liquescent2;
-    if (value == "liquescent3") return UNEUMEFORM_liquescent3;
-    if (value == "quilismatic") return UNEUMEFORM_quilismatic;
-    if (value == "rectangular") return UNEUMEFORM_rectangular;
-    if (value == "rhombic") return UNEUMEFORM_rhombic;
-    if (value == "tied") return UNEUMEFORM_tied;
+    static const std::unordered_map<std::string, data_UNEUMEFORM> values = {
+        { "liquescent1", UNEUMEFORM_liquescent1 },
+        { "liquescent2", UNEUMEFORM_liquescent2 },
+        { "liquescent3", UNEUMEFORM_liquescent3 },
+        { "quilismatic", UNEUMEFORM_quilismatic },
+        { "rectangular", UNEUMEFORM_rectangular },
+        { "rhombic", UNEUMEFORM_rhombic },
+        { "tied", UNEUMEFORM_tied },
+    };
+    std::unordered_map<std::string, data_UNEUMEFORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.UNEUMEFORM", value.c_str());
     return UNEUMEFORM_NONE;
 }
@@ -1851,19 +2028,23 @@ std::string AttConverter::UneumenameToStr(data_UNEUMENAME data) const
 
 data_UNEUMENAME AttConverter::StrToUneumename(std::string value) const
 {
-    if (value == "punctum") return UNEUMENAME_punctum;
-    if (value == "virga") return UNEUMENAME_virga;
-    if (value == "pes") return UNEUMENAME_pes;
-    if (value == "clivis") return UNEUMENAME_clivis;
-    if (value == "torculus") return UNEUMENAME_torculus;
-    if (value == "torculusresupinus") return UNEUMENAME_torculusresupinus;
-    if (value == "porrectus") return UNEUMENAME_porrectus;
-    if (value == "porrectusflexus") return UNEUMENAME_porrectusflexus;
-    if (value == "apostropha") return UNEUMENAME_apostropha;
-    if (value == "oriscus") return UNEUMENAME_oriscus;
-    if (value == "pressusmaior") return UNEUMENAME_pressusmaior;
-    if (value == "pressusminor") return UNEUMENAME_pressusminor;
-    if (value == "virgastrata") return UNEUMENAME_virgastrata;
+    static const std::unordered_map<std::string, data_UNEUMENAME> values = {
+        { "punctum", UNEUMENAME_punctum },
+        { "virga", UNEUMENAME_virga },
+        { "pes", UNEUMENAME_pes },
+        { "clivis", UNEUMENAME_clivis },
+        { "torculus", UNEUMENAME_torculus },
+        { "torculusresupinus", UNEUMENAME_torculusresupinus },
+        { "porrectus", UNEUMENAME_porrectus },
+        { "porrectusflexus", UNEUMENAME_porrectusflexus },
+        { "apostropha", UNEUMENAME_apostropha },
+        { "oriscus", UNEUMENAME_oriscus },
+        { "pressusmaior", UNEUMENAME_pressusmaior },
+        { "pressusminor", UNEUMENAME_pressusminor },
+        { "virgastrata", UNEUMENAME_virgastrata },
+    };
+    std::unordered_map<std::string, data_UNEUMENAME>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for data.UNEUMENAME", value.c_str());
     return UNEUMENAME_NONE;
 }
@@ -1884,8 +2065,12 @@ std::string AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
 
 accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string value) const
 {
-    if (value == "caution") return accidLog_FUNC_caution;
-    if (value == "edit") return accidLog_FUNC_edit;
+    static const std::unordered_map<std::string, accidLog_FUNC> values = {
+        { "caution", accidLog_FUNC_caution },
+        { "edit", accidLog_FUNC_edit },
+    };
+    std::unordered_map<std::string, accidLog_FUNC>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.accid.log@func", value.c_str());
     return accidLog_FUNC_NONE;
 }
@@ -1907,9 +2092,13 @@ std::string AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
 
 arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string value) const
 {
-    if (value == "up") return arpegLog_ORDER_up;
-    if (value == "down") return arpegLog_ORDER_down;
-    if (value == "nonarp") return arpegLog_ORDER_nonarp;
+    static const std::unordered_map<std::string, arpegLog_ORDER> values = {
+        { "up", arpegLog_ORDER_up },
+        { "down", arpegLog_ORDER_down },
+        { "nonarp", arpegLog_ORDER_nonarp },
+    };
+    std::unordered_map<std::string, arpegLog_ORDER>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.arpeg.log@order", value.c_str());
     return arpegLog_ORDER_NONE;
 }
@@ -1930,8 +2119,12 @@ std::string AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
 
 bTremLog_FORM AttConverter::StrToBTremLogForm(std::string value) const
 {
-    if (value == "meas") return bTremLog_FORM_meas;
-    if (value == "unmeas") return bTremLog_FORM_unmeas;
+    static const std::unordered_map<std::string, bTremLog_FORM> values = {
+        { "meas", bTremLog_FORM_meas },
+        { "unmeas", bTremLog_FORM_unmeas },
+    };
+    std::unordered_map<std::string, bTremLog_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.bTrem.log@form", value.c_str());
     return bTremLog_FORM_NONE;
 }
@@ -1953,9 +2146,13 @@ std::string AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) cons
 
 beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string value) const
 {
-    if (value == "acc") return beamingVis_BEAMREND_acc;
-    if (value == "rit") return beamingVis_BEAMREND_rit;
-    if (value == "norm") return beamingVis_BEAMREND_norm;
+    static const std::unordered_map<std::string, beamingVis_BEAMREND> values = {
+        { "acc", beamingVis_BEAMREND_acc },
+        { "rit", beamingVis_BEAMREND_rit },
+        { "norm", beamingVis_BEAMREND_norm },
+    };
+    std::unordered_map<std::string, beamingVis_BEAMREND>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value.c_str());
     return beamingVis_BEAMREND_NONE;
 }
@@ -1978,10 +2175,14 @@ std::string AttConverter::BeamrendFormToStr(beamrend_FORM data) const
 
 beamrend_FORM AttConverter::StrToBeamrendForm(std::string value) const
 {
-    if (value == "acc") return beamrend_FORM_acc;
-    if (value == "mixed") return beamrend_FORM_mixed;
-    if (value == "rit") return beamrend_FORM_rit;
-    if (value == "norm") return beamrend_FORM_norm;
+    static const std::unordered_map<std::string, beamrend_FORM> values = {
+        { "acc", beamrend_FORM_acc },
+        { "mixed", beamrend_FORM_mixed },
+        { "rit", beamrend_FORM_rit },
+        { "norm", beamrend_FORM_norm },
+    };
+    std::unordered_map<std::string, beamrend_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.beamrend@form", value.c_str());
     return beamrend_FORM_NONE;
 }
@@ -2003,9 +2204,13 @@ std::string AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
 
 curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string value) const
 {
-    if (value == "above") return curvature_CURVEDIR_above;
-    if (value == "below") return curvature_CURVEDIR_below;
-    if (value == "mixed") return curvature_CURVEDIR_mixed;
+    static const std::unordered_map<std::string, curvature_CURVEDIR> values = {
+        { "above", curvature_CURVEDIR_above },
+        { "below", curvature_CURVEDIR_below },
+        { "mixed", curvature_CURVEDIR_mixed },
+    };
+    std::unordered_map<std::string, curvature_CURVEDIR>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.curvature@curvedir", value.c_str());
     return curvature_CURVEDIR_NONE;
 }
@@ -2025,7 +2230,11 @@ std::string AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
 
 cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string value) const
 {
-    if (value == "cutout") return cutout_CUTOUT_cutout;
+    static const std::unordered_map<std::string, cutout_CUTOUT> values = {
+        { "cutout", cutout_CUTOUT_cutout },
+    };
+    std::unordered_map<std::string, cutout_CUTOUT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.cutout@cutout", value.c_str());
     return cutout_CUTOUT_NONE;
 }
@@ -2046,8 +2255,12 @@ std::string AttConverter::DotLogFormToStr(dotLog_FORM data) const
 
 dotLog_FORM AttConverter::StrToDotLogForm(std::string value) const
 {
-    if (value == "aug") return dotLog_FORM_aug;
-    if (value == "div") return dotLog_FORM_div;
+    static const std::unordered_map<std::string, dotLog_FORM> values = {
+        { "aug", dotLog_FORM_aug },
+        { "div", dotLog_FORM_div },
+    };
+    std::unordered_map<std::string, dotLog_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.dot.log@form", value.c_str());
     return dotLog_FORM_NONE;
 }
@@ -2069,9 +2282,13 @@ std::string AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
 
 endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string value) const
 {
-    if (value == "top") return endings_ENDINGREND_top;
-    if (value == "barred") return endings_ENDINGREND_barred;
-    if (value == "grouped") return endings_ENDINGREND_grouped;
+    static const std::unordered_map<std::string, endings_ENDINGREND> values = {
+        { "top", endings_ENDINGREND_top },
+        { "barred", endings_ENDINGREND_barred },
+        { "grouped", endings_ENDINGREND_grouped },
+    };
+    std::unordered_map<std::string, endings_ENDINGREND>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.endings@ending.rend", value.c_str());
     return endings_ENDINGREND_NONE;
 }
@@ -2092,8 +2309,12 @@ std::string AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
 
 fTremLog_FORM AttConverter::StrToFTremLogForm(std::string value) const
 {
-    if (value == "meas") return fTremLog_FORM_meas;
-    if (value == "unmeas") return fTremLog_FORM_unmeas;
+    static const std::unordered_map<std::string, fTremLog_FORM> values = {
+        { "meas", fTremLog_FORM_meas },
+        { "unmeas", fTremLog_FORM_unmeas },
+    };
+    std::unordered_map<std::string, fTremLog_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.fTrem.log@form", value.c_str());
     return fTremLog_FORM_NONE;
 }
@@ -2114,8 +2335,12 @@ std::string AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
 
 fermataVis_FORM AttConverter::StrToFermataVisForm(std::string value) const
 {
-    if (value == "inv") return fermataVis_FORM_inv;
-    if (value == "norm") return fermataVis_FORM_norm;
+    static const std::unordered_map<std::string, fermataVis_FORM> values = {
+        { "inv", fermataVis_FORM_inv },
+        { "norm", fermataVis_FORM_norm },
+    };
+    std::unordered_map<std::string, fermataVis_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.fermata.vis@form", value.c_str());
     return fermataVis_FORM_NONE;
 }
@@ -2137,9 +2362,13 @@ std::string AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
 
 fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string value) const
 {
-    if (value == "curved") return fermataVis_SHAPE_curved;
-    if (value == "square") return fermataVis_SHAPE_square;
-    if (value == "angular") return fermataVis_SHAPE_angular;
+    static const std::unordered_map<std::string, fermataVis_SHAPE> values = {
+        { "curved", fermataVis_SHAPE_curved },
+        { "square", fermataVis_SHAPE_square },
+        { "angular", fermataVis_SHAPE_angular },
+    };
+    std::unordered_map<std::string, fermataVis_SHAPE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value.c_str());
     return fermataVis_SHAPE_NONE;
 }
@@ -2160,8 +2389,12 @@ std::string AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
 
 hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string value) const
 {
-    if (value == "cres") return hairpinLog_FORM_cres;
-    if (value == "dim") return hairpinLog_FORM_dim;
+    static const std::unordered_map<std::string, hairpinLog_FORM> values = {
+        { "cres", hairpinLog_FORM_cres },
+        { "dim", hairpinLog_FORM_dim },
+    };
+    std::unordered_map<std::string, hairpinLog_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.hairpin.log@form", value.c_str());
     return hairpinLog_FORM_NONE;
 }
@@ -2183,9 +2416,13 @@ std::string AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
 
 harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string value) const
 {
-    if (value == "grid") return harmVis_RENDGRID_grid;
-    if (value == "gridtext") return harmVis_RENDGRID_gridtext;
-    if (value == "text") return harmVis_RENDGRID_text;
+    static const std::unordered_map<std::string, harmVis_RENDGRID> values = {
+        { "grid", harmVis_RENDGRID_grid },
+        { "gridtext", harmVis_RENDGRID_gridtext },
+        { "text", harmVis_RENDGRID_text },
+    };
+    std::unordered_map<std::string, harmVis_RENDGRID>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value.c_str());
     return harmVis_RENDGRID_NONE;
 }
@@ -2207,9 +2444,13 @@ std::string AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
 
 harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string value) const
 {
-    if (value == "f") return harpPedalLog_A_f;
-    if (value == "n") return harpPedalLog_A_n;
-    if (value == "s") return harpPedalLog_A_s;
+    static const std::unordered_map<std::string, harpPedalLog_A> values = {
+        { "f", harpPedalLog_A_f },
+        { "n", harpPedalLog_A_n },
+        { "s", harpPedalLog_A_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_A>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value.c_str());
     return harpPedalLog_A_NONE;
 }
@@ -2231,9 +2472,13 @@ std::string AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
 
 harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string value) const
 {
-    if (value == "f") return harpPedalLog_B_f;
-    if (value == "n") return harpPedalLog_B_n;
-    if (value == "s") return harpPedalLog_B_s;
+    static const std::unordered_map<std::string, harpPedalLog_B> values = {
+        { "f", harpPedalLog_B_f },
+        { "n", harpPedalLog_B_n },
+        { "s", harpPedalLog_B_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_B>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value.c_str());
     return harpPedalLog_B_NONE;
 }
@@ -2255,9 +2500,13 @@ std::string AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
 
 harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string value) const
 {
-    if (value == "f") return harpPedalLog_C_f;
-    if (value == "n") return harpPedalLog_C_n;
-    if (value == "s") return harpPedalLog_C_s;
+    static const std::unordered_map<std::string, harpPedalLog_C> values = {
+        { "f", harpPedalLog_C_f },
+        { "n", harpPedalLog_C_n },
+        { "s", harpPedalLog_C_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_C>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value.c_str());
     return harpPedalLog_C_NONE;
 }
@@ -2279,9 +2528,13 @@ std::string AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
 
 harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string value) const
 {
-    if (value == "f") return harpPedalLog_D_f;
-    if (value == "n") return harpPedalLog_D_n;
-    if (value == "s") return harpPedalLog_D_s;
+    static const std::unordered_map<std::string, harpPedalLog_D> values = {
+        { "f", harpPedalLog_D_f },
+        { "n", harpPedalLog_D_n },
+        { "s", harpPedalLog_D_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_D>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value.c_str());
     return harpPedalLog_D_NONE;
 }
@@ -2303,9 +2556,13 @@ std::string AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
 
 harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string value) const
 {
-    if (value == "f") return harpPedalLog_E_f;
-    if (value == "n") return harpPedalLog_E_n;
-    if (value == "s") return harpPedalLog_E_s;
+    static const std::unordered_map<std::string, harpPedalLog_E> values = {
+        { "f", harpPedalLog_E_f },
+        { "n", harpPedalLog_E_n },
+        { "s", harpPedalLog_E_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_E>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value.c_str());
     return harpPedalLog_E_NONE;
 }
@@ -2327,9 +2584,13 @@ std::string AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
 
 harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string value) const
 {
-    if (value == "f") return harpPedalLog_F_f;
-    if (value == "n") return harpPedalLog_F_n;
-    if (value == "s") return harpPedalLog_F_s;
+    static const std::unordered_map<std::string, harpPedalLog_F> values = {
+        { "f", harpPedalLog_F_f },
+        { "n", harpPedalLog_F_n },
+        { "s", harpPedalLog_F_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_F>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value.c_str());
     return harpPedalLog_F_NONE;
 }
@@ -2351,9 +2612,13 @@ std::string AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
 
 harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string value) const
 {
-    if (value == "f") return harpPedalLog_G_f;
-    if (value == "n") return harpPedalLog_G_n;
-    if (value == "s") return harpPedalLog_G_s;
+    static const std::unordered_map<std::string, harpPedalLog_G> values = {
+        { "f", harpPedalLog_G_f },
+        { "n", harpPedalLog_G_n },
+        { "s", harpPedalLog_G_s },
+    };
+    std::unordered_map<std::string, harpPedalLog_G>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value.c_str());
     return harpPedalLog_G_NONE;
 }
@@ -2373,7 +2638,11 @@ std::string AttConverter::MeiversionMeiversionToStr(meiversion_MEIVERSION data)
 
 meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(std::string value) const
 {
-    if (value == "3.0.0") return meiversion_MEIVERSION_3_0_0;
+    static const std::unordered_map<std::string, meiversion_MEIVERSION> values = {
+        { "3.0.0", meiversion_MEIVERSION_3_0_0 },
+    };
+    std::unordered_map<std::string, meiversion_MEIVERSION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.meiversion@meiversion", value.c_str());
     return meiversion_MEIVERSION_NONE;
 }
@@ -2394,8 +2663,12 @@ std::string AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
 
 mensurVis_FORM AttConverter::StrToMensurVisForm(std::string value) const
 {
-    if (value == "horizontal") return mensurVis_FORM_horizontal;
-    if (value == "vertical") return mensurVis_FORM_vertical;
+    static const std::unordered_map<std::string, mensurVis_FORM> values = {
+        { "horizontal", mensurVis_FORM_horizontal },
+        { "vertical", mensurVis_FORM_vertical },
+    };
+    std::unordered_map<std::string, mensurVis_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.mensur.vis@form", value.c_str());
     return mensurVis_FORM_NONE;
 }
@@ -2416,8 +2689,12 @@ std::string AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data
 
 mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string value) const
 {
-    if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
-    if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
+    static const std::unordered_map<std::string, mensuralVis_MENSURFORM> values = {
+        { "horizontal", mensuralVis_MENSURFORM_horizontal },
+        { "vertical", mensuralVis_MENSURFORM_vertical },
+    };
+    std::unordered_map<std::string, mensuralVis_MENSURFORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value.c_str());
     return mensuralVis_MENSURFORM_NONE;
 }
@@ -2440,10 +2717,14 @@ std::string AttConverter::MeterSigVisFormToStr(meterSigVis_FORM data) const
 
 meterSigVis_FORM AttConverter::StrToMeterSigVisForm(std::string value) const
 {
-    if (value == "num") return meterSigVis_FORM_num;
-    if (value == "denomsym") return meterSigVis_FORM_denomsym;
-    if (value == "norm") return meterSigVis_FORM_norm;
-    if (value == "invis") return meterSigVis_FORM_invis;
+    static const std::unordered_map<std::string, meterSigVis_FORM> values = {
+        { "num", meterSigVis_FORM_num },
+        { "denomsym", meterSigVis_FORM_denomsym },
+        { "norm", meterSigVis_FORM_norm },
+        { "invis", meterSigVis_FORM_invis },
+    };
+    std::unordered_map<std::string, meterSigVis_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.meterSig.vis@form", value.c_str());
     return meterSigVis_FORM_NONE;
 }
@@ -2466,10 +2747,14 @@ std::string AttConverter::MeterSigDefaultVisMeterrendToStr(meterSigDefaultVis_ME
 
 meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(std::string value) const
 {
-    if (value == "num") return meterSigDefaultVis_METERREND_num;
-    if (value == "denomsym") return meterSigDefaultVis_METERREND_denomsym;
-    if (value == "norm") return meterSigDefaultVis_METERREND_norm;
-    if (value == "invis") return meterSigDefaultVis_METERREND_invis;
+    static const std::unordered_map<std::string, meterSigDefaultVis_METERREND> values = {
+        { "num", meterSigDefaultVis_METERREND_num },
+        { "denomsym", meterSigDefaultVis_METERREND_denomsym },
+        { "norm", meterSigDefaultVis_METERREND_norm },
+        { "invis", meterSigDefaultVis_METERREND_invis },
+    };
+    std::unordered_map<std::string, meterSigDefaultVis_METERREND>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.meterSigDefault.vis@meter.rend", value.c_str());
     return meterSigDefaultVis_METERREND_NONE;
 }
@@ -2491,9 +2776,13 @@ std::string AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) cons
 
 meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string value) const
 {
-    if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
-    if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
-    if (value == "mixed") return meterSigGrpLog_FUNC_mixed;
+    static const std::unordered_map<std::string, meterSigGrpLog_FUNC> values = {
+        { "alternating", meterSigGrpLog_FUNC_alternating },
+        { "interchanging", meterSigGrpLog_FUNC_interchanging },
+        { "mixed", meterSigGrpLog_FUNC_mixed },
+    };
+    std::unordered_map<std::string, meterSigGrpLog_FUNC>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value.c_str());
     return meterSigGrpLog_FUNC_NONE;
 }
@@ -2515,9 +2804,13 @@ std::string AttConverter::MeterconformanceMetconToStr(meterconformance_METCON da
 
 meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(std::string value) const
 {
-    if (value == "c") return meterconformance_METCON_c;
-    if (value == "i") return meterconformance_METCON_i;
-    if (value == "o") return meterconformance_METCON_o;
+    static const std::unordered_map<std::string, meterconformance_METCON> values = {
+        { "c", meterconformance_METCON_c },
+        { "i", meterconformance_METCON_i },
+        { "o", meterconformance_METCON_o },
+    };
+    std::unordered_map<std::string, meterconformance_METCON>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.meterconformance@metcon", value.c_str());
     return meterconformance_METCON_NONE;
 }
@@ -2538,8 +2831,12 @@ std::string AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
 
 mordentLog_FORM AttConverter::StrToMordentLogForm(std::string value) const
 {
-    if (value == "inv") return mordentLog_FORM_inv;
-    if (value == "norm") return mordentLog_FORM_norm;
+    static const std::unordered_map<std::string, mordentLog_FORM> values = {
+        { "inv", mordentLog_FORM_inv },
+        { "norm", mordentLog_FORM_norm },
+    };
+    std::unordered_map<std::string, mordentLog_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.mordent.log@form", value.c_str());
     return mordentLog_FORM_NONE;
 }
@@ -2560,8 +2857,12 @@ std::string AttConverter::NoteLogMensuralLigToStr(noteLogMensural_LIG data) cons
 
 noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(std::string value) const
 {
-    if (value == "recta") return noteLogMensural_LIG_recta;
-    if (value == "obliqua") return noteLogMensural_LIG_obliqua;
+    static const std::unordered_map<std::string, noteLogMensural_LIG> values = {
+        { "recta", noteLogMensural_LIG_recta },
+        { "obliqua", noteLogMensural_LIG_obliqua },
+    };
+    std::unordered_map<std::string, noteLogMensural_LIG>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.note.log.mensural@lig", value.c_str());
     return noteLogMensural_LIG_NONE;
 }
@@ -2581,7 +2882,11 @@ std::string AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
 
 octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string value) const
 {
-    if (value == "coll") return octaveLog_COLL_coll;
+    static const std::unordered_map<std::string, octaveLog_COLL> values = {
+        { "coll", octaveLog_COLL_coll },
+    };
+    std::unordered_map<std::string, octaveLog_COLL>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.octave.log@coll", value.c_str());
     return octaveLog_COLL_NONE;
 }
@@ -2602,8 +2907,12 @@ std::string AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
 
 pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string value) const
 {
-    if (value == "verso") return pbVis_FOLIUM_verso;
-    if (value == "recto") return pbVis_FOLIUM_recto;
+    static const std::unordered_map<std::string, pbVis_FOLIUM> values = {
+        { "verso", pbVis_FOLIUM_verso },
+        { "recto", pbVis_FOLIUM_recto },
+    };
+    std::unordered_map<std::string, pbVis_FOLIUM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.pb.vis@folium", value.c_str());
     return pbVis_FOLIUM_NONE;
 }
@@ -2626,10 +2935,14 @@ std::string AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
 
 pedalLog_DIR AttConverter::StrToPedalLogDir(std::string value) const
 {
-    if (value == "down") return pedalLog_DIR_down;
-    if (value == "up") return pedalLog_DIR_up;
-    if (value == "half") return pedalLog_DIR_half;
-    if (value == "bounce") return pedalLog_DIR_bounce;
+    static const std::unordered_map<std::string, pedalLog_DIR> values = {
+        { "down", pedalLog_DIR_down },
+        { "up", pedalLog_DIR_up },
+        { "half", pedalLog_DIR_half },
+        { "bounce", pedalLog_DIR_bounce },
+    };
+    std::unordered_map<std::string, pedalLog_DIR>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.pedal.log@dir", value.c_str());
     return pedalLog_DIR_NONE;
 }
@@ -2651,9 +2964,13 @@ std::string AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
 
 pedalVis_FORM AttConverter::StrToPedalVisForm(std::string value) const
 {
-    if (value == "line") return pedalVis_FORM_line;
-    if (value == "pedstar") return pedalVis_FORM_pedstar;
-    if (value == "altpedstar") return pedalVis_FORM_altpedstar;
+    static const std::unordered_map<std::string, pedalVis_FORM> values = {
+        { "line", pedalVis_FORM_line },
+        { "pedstar", pedalVis_FORM_pedstar },
+        { "altpedstar", pedalVis_FORM_altpedstar },
+    };
+    std::unordered_map<std::string, pedalVis_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.pedal.vis@form", value.c_str());
     return pedalVis_FORM_NONE;
 }
@@ -2675,9 +2992,13 @@ std::string AttConverter::PianopedalsPedalstyleToStr(pianopedals_PEDALSTYLE data
 
 pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(std::string value) const
 {
-    if (value == "line") return pianopedals_PEDALSTYLE_line;
-    if (value == "pedstar") return pianopedals_PEDALSTYLE_pedstar;
-    if (value == "altpedstar") return pianopedals_PEDALSTYLE_altpedstar;
+    static const std::unordered_map<std::string, pianopedals_PEDALSTYLE> values = {
+        { "line", pianopedals_PEDALSTYLE_line },
+        { "pedstar", pianopedals_PEDALSTYLE_pedstar },
+        { "altpedstar", pianopedals_PEDALSTYLE_altpedstar },
+    };
+    std::unordered_map<std::string, pianopedals_PEDALSTYLE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.pianopedals@pedal.style", value.c_str());
     return pianopedals_PEDALSTYLE_NONE;
 }
@@ -2700,10 +3021,14 @@ std::string AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data)
 
 pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string value) const
 {
-    if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
-    if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
-    if (value == "none") return pointing_XLINKACTUATE_none;
-    if (value == "other") return pointing_XLINKACTUATE_other;
+    static const std::unordered_map<std::string, pointing_XLINKACTUATE> values = {
+        { "onLoad", pointing_XLINKACTUATE_onLoad },
+        { "onRequest", pointing_XLINKACTUATE_onRequest },
+        { "none", pointing_XLINKACTUATE_none },
+        { "other", pointing_XLINKACTUATE_other },
+    };
+    std::unordered_map<std::string, pointing_XLINKACTUATE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value.c_str());
     return pointing_XLINKACTUATE_NONE;
 }
@@ -2727,11 +3052,15 @@ std::string AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
 
 pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string value) const
 {
-    if (value == "new") return pointing_XLINKSHOW_new;
-    if (value == "replace") return pointing_XLINKSHOW_replace;
-    if (value == "embed") return pointing_XLINKSHOW_embed;
-    if (value == "none") return pointing_XLINKSHOW_none;
-    if (value == "other") return pointing_XLINKSHOW_other;
+    static const std::unordered_map<std::string, pointing_XLINKSHOW> values = {
+        { "new", pointing_XLINKSHOW_new },
+        { "replace", pointing_XLINKSHOW_replace },
+        { "embed", pointing_XLINKSHOW_embed },
+        { "none", pointing_XLINKSHOW_none },
+        { "other", pointing_XLINKSHOW_other },
+    };
+    std::unordered_map<std::string, pointing_XLINKSHOW>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value.c_str());
     return pointing_XLINKSHOW_NONE;
 }
@@ -2752,8 +3081,12 @@ std::string AttConverter::RegularmethodMethodToStr(regularmethod_METHOD data) co
 
 regularmethod_METHOD AttConverter::StrToRegularmethodMethod(std::string value) const
 {
-    if (value == "silent") return regularmethod_METHOD_silent;
-    if (value == "tags") return regularmethod_METHOD_tags;
+    static const std::unordered_map<std::string, regularmethod_METHOD> values = {
+        { "silent", regularmethod_METHOD_silent },
+        { "tags", regularmethod_METHOD_tags },
+    };
+    std::unordered_map<std::string, regularmethod_METHOD>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.regularmethod@method", value.c_str());
     return regularmethod_METHOD_NONE;
 }
@@ -2775,9 +3108,13 @@ std::string AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) co
 
 rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string value) const
 {
-    if (value == "box") return rehearsal_REHENCLOSE_box;
-    if (value == "circle") return rehearsal_REHENCLOSE_circle;
-    if (value == "none") return rehearsal_REHENCLOSE_none;
+    static const std::unordered_map<std::string, rehearsal_REHENCLOSE> values = {
+        { "box", rehearsal_REHENCLOSE_box },
+        { "circle", rehearsal_REHENCLOSE_circle },
+        { "none", rehearsal_REHENCLOSE_none },
+    };
+    std::unordered_map<std::string, rehearsal_REHENCLOSE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value.c_str());
     return rehearsal_REHENCLOSE_NONE;
 }
@@ -2797,7 +3134,11 @@ std::string AttConverter::SbVisFormToStr(sbVis_FORM data) const
 
 sbVis_FORM AttConverter::StrToSbVisForm(std::string value) const
 {
-    if (value == "hash") return sbVis_FORM_hash;
+    static const std::unordered_map<std::string, sbVis_FORM> values = {
+        { "hash", sbVis_FORM_hash },
+    };
+    std::unordered_map<std::string, sbVis_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.sb.vis@form", value.c_str());
     return sbVis_FORM_NONE;
 }
@@ -2821,11 +3162,15 @@ std::string AttConverter::StaffgroupingsymSymbolToStr(staffgroupingsym_SYMBOL da
 
 staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(std::string value) const
 {
-    if (value == "brace") return staffgroupingsym_SYMBOL_brace;
-    if (value == "bracket") return staffgroupingsym_SYMBOL_bracket;
-    if (value == "bracketsq") return staffgroupingsym_SYMBOL_bracketsq;
-    if (value == "line") return staffgroupingsym_SYMBOL_line;
-    if (value == "none") return staffgroupingsym_SYMBOL_none;
+    static const std::unordered_map<std::string, staffgroupingsym_SYMBOL> values = {
+        { "brace", staffgroupingsym_SYMBOL_brace },
+        { "bracket", staffgroupingsym_SYMBOL_bracket },
+        { "bracketsq", staffgroupingsym_SYMBOL_bracketsq },
+        { "line", staffgroupingsym_SYMBOL_line },
+        { "none", staffgroupingsym_SYMBOL_none },
+    };
+    std::unordered_map<std::string, staffgroupingsym_SYMBOL>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.staffgroupingsym@symbol", value.c_str());
     return staffgroupingsym_SYMBOL_NONE;
 }
@@ -2852,14 +3197,18 @@ std::string AttConverter::SylLogConToStr(sylLog_CON data) const
 
 sylLog_CON AttConverter::StrToSylLogCon(std::string value) const
 {
-    if (value == "s") return sylLog_CON_s;
-    if (value == "d") return sylLog_CON_d;
-    if (value == "u") return sylLog_CON_u;
-    if (value == "t") return sylLog_CON_t;
-    if (value == "c") return sylLog_CON_c;
-    if (value == "v") return sylLog_CON_v;
-    if (value == "i") return sylLog_CON_i;
-    if (value == "b") return sylLog_CON_b;
+    static const std::unordered_map<std::string, sylLog_CON> values = {
+        { "s", sylLog_CON_s },
+        { "d", sylLog_CON_d },
+        { "u", sylLog_CON_u },
+        { "t", sylLog_CON_t },
+        { "c", sylLog_CON_c },
+        { "v", sylLog_CON_v },
+        { "i", sylLog_CON_i },
+        { "b", sylLog_CON_b },
+    };
+    std::unordered_map<std::string, sylLog_CON>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.syl.log@con", value.c_str());
     return sylLog_CON_NONE;
 }
@@ -2881,9 +3230,13 @@ std::string AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
 
 sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string value) const
 {
-    if (value == "i") return sylLog_WORDPOS_i;
-    if (value == "m") return sylLog_WORDPOS_m;
-    if (value == "t") return sylLog_WORDPOS_t;
+    static const std::unordered_map<std::string, sylLog_WORDPOS> values = {
+        { "i", sylLog_WORDPOS_i },
+        { "m", sylLog_WORDPOS_m },
+        { "t", sylLog_WORDPOS_t },
+    };
+    std::unordered_map<std::string, sylLog_WORDPOS>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value.c_str());
     return sylLog_WORDPOS_NONE;
 }
@@ -2905,9 +3258,13 @@ std::string AttConverter::TargetevalEvaluateToStr(targeteval_EVALUATE data) cons
 
 targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(std::string value) const
 {
-    if (value == "all") return targeteval_EVALUATE_all;
-    if (value == "one") return targeteval_EVALUATE_one;
-    if (value == "none") return targeteval_EVALUATE_none;
+    static const std::unordered_map<std::string, targeteval_EVALUATE> values = {
+        { "all", targeteval_EVALUATE_all },
+        { "one", targeteval_EVALUATE_one },
+        { "none", targeteval_EVALUATE_none },
+    };
+    std::unordered_map<std::string, targeteval_EVALUATE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.targeteval@evaluate", value.c_str());
     return targeteval_EVALUATE_NONE;
 }
@@ -2930,10 +3287,14 @@ std::string AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
 
 tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string value) const
 {
-    if (value == "continuous") return tempoLog_FUNC_continuous;
-    if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
-    if (value == "metricmod") return tempoLog_FUNC_metricmod;
-    if (value == "precedente") return tempoLog_FUNC_precedente;
+    static const std::unordered_map<std::string, tempoLog_FUNC> values = {
+        { "continuous", tempoLog_FUNC_continuous },
+        { "instantaneous", tempoLog_FUNC_instantaneous },
+        { "metricmod", tempoLog_FUNC_metricmod },
+        { "precedente", tempoLog_FUNC_precedente },
+    };
+    std::unordered_map<std::string, tempoLog_FUNC>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.tempo.log@func", value.c_str());
     return tempoLog_FUNC_NONE;
 }
@@ -2954,8 +3315,12 @@ std::string AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) cons
 
 tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string value) const
 {
-    if (value == "count") return tupletVis_NUMFORMAT_count;
-    if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
+    static const std::unordered_map<std::string, tupletVis_NUMFORMAT> values = {
+        { "count", tupletVis_NUMFORMAT_count },
+        { "ratio", tupletVis_NUMFORMAT_ratio },
+    };
+    std::unordered_map<std::string, tupletVis_NUMFORMAT>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value.c_str());
     return tupletVis_NUMFORMAT_NONE;
 }
@@ -2976,8 +3341,12 @@ std::string AttConverter::TurnLogFormToStr(turnLog_FORM data) const
 
 turnLog_FORM AttConverter::StrToTurnLogForm(std::string value) const
 {
-    if (value == "inv") return turnLog_FORM_inv;
-    if (value == "norm") return turnLog_FORM_norm;
+    static const std::unordered_map<std::string, turnLog_FORM> values = {
+        { "inv", turnLog_FORM_inv },
+        { "norm", turnLog_FORM_norm },
+    };
+    std::unordered_map<std::string, turnLog_FORM>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.turn.log@form", value.c_str());
     return turnLog_FORM_NONE;
 }
@@ -2998,8 +3367,12 @@ std::string AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) cons
 
 whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string value) const
 {
-    if (value == "default") return whitespace_XMLSPACE_default;
-    if (value == "preserve") return whitespace_XMLSPACE_preserve;
+    static const std::unordered_map<std::string, whitespace_XMLSPACE> values = {
+        { "default", whitespace_XMLSPACE_default },
+        { "preserve", whitespace_XMLSPACE_preserve },
+    };
+    std::unordered_map<std::string, whitespace_XMLSPACE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value.c_str());
     return whitespace_XMLSPACE_NONE;
 }
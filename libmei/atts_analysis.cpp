@@ -52,34 +52,34 @@ void AttCommonAnl::ResetCommonAnl()
 bool AttCommonAnl::ReadCommonAnl(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        element.remove_attribute("copyof");
+    if (pugi::xml_attribute attribute = element.attribute("copyof")) {
+        this->SetCopyof(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        element.remove_attribute("corresp");
+    if (pugi::xml_attribute attribute = element.attribute("corresp")) {
+        this->SetCorresp(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        element.remove_attribute("next");
+    if (pugi::xml_attribute attribute = element.attribute("next")) {
+        this->SetNext(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        element.remove_attribute("prev");
+    if (pugi::xml_attribute attribute = element.attribute("prev")) {
+        this->SetPrev(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        element.remove_attribute("sameas");
+    if (pugi::xml_attribute attribute = element.attribute("sameas")) {
+        this->SetSameas(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        element.remove_attribute("synch");
+    if (pugi::xml_attribute attribute = element.attribute("synch")) {
+        this->SetSynch(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -168,9 +168,9 @@ void AttHarmonicfunction::ResetHarmonicfunction()
 bool AttHarmonicfunction::ReadHarmonicfunction(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToScaledegree(element.attribute("deg").value()));
-        element.remove_attribute("deg");
+    if (pugi::xml_attribute attribute = element.attribute("deg")) {
+        this->SetDeg(StrToScaledegree(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -214,9 +214,9 @@ void AttIntervalharmonic::ResetIntervalharmonic()
 bool AttIntervalharmonic::ReadIntervalharmonic(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToIntervalHarmonic(element.attribute("inth").value()));
-        element.remove_attribute("inth");
+    if (pugi::xml_attribute attribute = element.attribute("inth")) {
+        this->SetInth(StrToIntervalHarmonic(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -260,9 +260,9 @@ void AttIntervalmelodic::ResetIntervalmelodic()
 bool AttIntervalmelodic::ReadIntervalmelodic(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToIntervalMelodic(element.attribute("intm").value()));
-        element.remove_attribute("intm");
+    if (pugi::xml_attribute attribute = element.attribute("intm")) {
+        this->SetIntm(StrToIntervalMelodic(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -306,9 +306,9 @@ void AttMelodicfunction::ResetMelodicfunction()
 bool AttMelodicfunction::ReadMelodicfunction(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        element.remove_attribute("mfunc");
+    if (pugi::xml_attribute attribute = element.attribute("mfunc")) {
+        this->SetMfunc(StrToMelodicfunction(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -352,9 +352,9 @@ void AttPitchclass::ResetPitchclass()
 bool AttPitchclass::ReadPitchclass(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToPitchclass(element.attribute("pclass").value()));
-        element.remove_attribute("pclass");
+    if (pugi::xml_attribute attribute = element.attribute("pclass")) {
+        this->SetPclass(StrToPitchclass(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -398,9 +398,9 @@ void AttSolfa::ResetSolfa()
 bool AttSolfa::ReadSolfa(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        element.remove_attribute("psolfa");
+    if (pugi::xml_attribute attribute = element.attribute("psolfa")) {
+        this->SetPsolfa(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -47,9 +47,9 @@ void AttArpegLog::ResetArpegLog()
 bool AttArpegLog::ReadArpegLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        element.remove_attribute("order");
+    if (pugi::xml_attribute attribute = element.attribute("order")) {
+        this->SetOrder(StrToArpegLogOrder(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -93,9 +93,9 @@ void AttArpegVis::ResetArpegVis()
 bool AttArpegVis::ReadArpegVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        element.remove_attribute("arrow");
+    if (pugi::xml_attribute attribute = element.attribute("arrow")) {
+        this->SetArrow(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -139,9 +139,9 @@ void AttBTremLog::ResetBTremLog()
 bool AttBTremLog::ReadBTremLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBTremLogForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -185,9 +185,9 @@ void AttBeamed::ResetBeamed()
 bool AttBeamed::ReadBeamed(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        element.remove_attribute("beam");
+    if (pugi::xml_attribute attribute = element.attribute("beam")) {
+        this->SetBeam(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -231,9 +231,9 @@ void AttBeamedwith::ResetBeamedwith()
 bool AttBeamedwith::ReadBeamedwith(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToOtherstaff(element.attribute("beam.with").value()));
-        element.remove_attribute("beam.with");
+    if (pugi::xml_attribute attribute = element.attribute("beam.with")) {
+        this->SetBeamWith(StrToOtherstaff(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -278,14 +278,14 @@ void AttBeamingLog::ResetBeamingLog()
 bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        element.remove_attribute("beam.group");
+    if (pugi::xml_attribute attribute = element.attribute("beam.group")) {
+        this->SetBeamGroup(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        element.remove_attribute("beam.rests");
+    if (pugi::xml_attribute attribute = element.attribute("beam.rests")) {
+        this->SetBeamRests(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -339,14 +339,14 @@ void AttBeamrend::ResetBeamrend()
 bool AttBeamrend::ReadBeamrend(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamrendForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBeamrendForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        element.remove_attribute("slope");
+    if (pugi::xml_attribute attribute = element.attribute("slope")) {
+        this->SetSlope(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -399,9 +399,9 @@ void AttBeamsecondary::ResetBeamsecondary()
 bool AttBeamsecondary::ReadBeamsecondary(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        element.remove_attribute("breaksec");
+    if (pugi::xml_attribute attribute = element.attribute("breaksec")) {
+        this->SetBreaksec(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -445,9 +445,9 @@ void AttBeatRptLog::ResetBeatRptLog()
 bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("beatDef")) {
-        this->SetBeatDef(StrToDuration(element.attribute("beatDef").value()));
-        element.remove_attribute("beatDef");
+    if (pugi::xml_attribute attribute = element.attribute("beatDef")) {
+        this->SetBeatDef(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -491,9 +491,9 @@ void AttBeatRptVis::ResetBeatRptVis()
 bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeatrptRend(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBeatrptRend(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -537,9 +537,9 @@ void AttBendGes::ResetBendGes()
 bool AttBendGes::ReadBendGes(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        element.remove_attribute("amount");
+    if (pugi::xml_attribute attribute = element.attribute("amount")) {
+        this->SetAmount(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -583,9 +583,9 @@ void AttCutout::ResetCutout()
 bool AttCutout::ReadCutout(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        element.remove_attribute("cutout");
+    if (pugi::xml_attribute attribute = element.attribute("cutout")) {
+        this->SetCutout(StrToCutoutCutout(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -629,9 +629,9 @@ void AttExpandable::ResetExpandable()
 bool AttExpandable::ReadExpandable(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        element.remove_attribute("expand");
+    if (pugi::xml_attribute attribute = element.attribute("expand")) {
+        this->SetExpand(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -675,9 +675,9 @@ void AttFTremLog::ResetFTremLog()
 bool AttFTremLog::ReadFTremLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToFTremLogForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -722,14 +722,14 @@ void AttFermataVis::ResetFermataVis()
 bool AttFermataVis::ReadFermataVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToFermataVisForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    if (pugi::xml_attribute attribute = element.attribute("shape")) {
+        this->SetShape(StrToFermataVisShape(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -783,14 +783,14 @@ void AttGraced::ResetGraced()
 bool AttGraced::ReadGraced(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        element.remove_attribute("grace");
+    if (pugi::xml_attribute attribute = element.attribute("grace")) {
+        this->SetGrace(StrToGrace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        element.remove_attribute("grace.time");
+    if (pugi::xml_attribute attribute = element.attribute("grace.time")) {
+        this->SetGraceTime(StrToPercent(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -844,14 +844,14 @@ void AttHairpinLog::ResetHairpinLog()
 bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToHairpinLogForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        element.remove_attribute("niente");
+    if (pugi::xml_attribute attribute = element.attribute("niente")) {
+        this->SetNiente(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -904,9 +904,9 @@ void AttHairpinVis::ResetHairpinVis()
 bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToStr(element.attribute("opening").value()));
-        element.remove_attribute("opening");
+    if (pugi::xml_attribute attribute = element.attribute("opening")) {
+        this->SetOpening(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -956,39 +956,39 @@ void AttHarpPedalLog::ResetHarpPedalLog()
 bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarpPedalLogC(element.attribute("c").value()));
-        element.remove_attribute("c");
+    if (pugi::xml_attribute attribute = element.attribute("c")) {
+        this->SetC(StrToHarpPedalLogC(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarpPedalLogD(element.attribute("d").value()));
-        element.remove_attribute("d");
+    if (pugi::xml_attribute attribute = element.attribute("d")) {
+        this->SetD(StrToHarpPedalLogD(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarpPedalLogE(element.attribute("e").value()));
-        element.remove_attribute("e");
+    if (pugi::xml_attribute attribute = element.attribute("e")) {
+        this->SetE(StrToHarpPedalLogE(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarpPedalLogF(element.attribute("f").value()));
-        element.remove_attribute("f");
+    if (pugi::xml_attribute attribute = element.attribute("f")) {
+        this->SetF(StrToHarpPedalLogF(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarpPedalLogG(element.attribute("g").value()));
-        element.remove_attribute("g");
+    if (pugi::xml_attribute attribute = element.attribute("g")) {
+        this->SetG(StrToHarpPedalLogG(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarpPedalLogA(element.attribute("a").value()));
-        element.remove_attribute("a");
+    if (pugi::xml_attribute attribute = element.attribute("a")) {
+        this->SetA(StrToHarpPedalLogA(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarpPedalLogB(element.attribute("b").value()));
-        element.remove_attribute("b");
+    if (pugi::xml_attribute attribute = element.attribute("b")) {
+        this->SetB(StrToHarpPedalLogB(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1086,9 +1086,9 @@ void AttLvpresent::ResetLvpresent()
 bool AttLvpresent::ReadLvpresent(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        element.remove_attribute("lv");
+    if (pugi::xml_attribute attribute = element.attribute("lv")) {
+        this->SetLv(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1132,9 +1132,9 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
 bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToMeterSigGrpLogFunc(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1178,9 +1178,9 @@ void AttMultiRestVis::ResetMultiRestVis()
 bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        element.remove_attribute("block");
+    if (pugi::xml_attribute attribute = element.attribute("block")) {
+        this->SetBlock(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1224,9 +1224,9 @@ void AttNoteGesCmn::ResetNoteGesCmn()
 bool AttNoteGesCmn::ReadNoteGesCmn(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        element.remove_attribute("gliss");
+    if (pugi::xml_attribute attribute = element.attribute("gliss")) {
+        this->SetGliss(StrToGlissando(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1270,9 +1270,9 @@ void AttNumbered::ResetNumbered()
 bool AttNumbered::ReadNumbered(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1317,14 +1317,14 @@ void AttNumberplacement::ResetNumberplacement()
 bool AttNumberplacement::ReadNumberplacement(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToPlace(element.attribute("num.place").value()));
-        element.remove_attribute("num.place");
+    if (pugi::xml_attribute attribute = element.attribute("num.place")) {
+        this->SetNumPlace(StrToPlace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        element.remove_attribute("num.visible");
+    if (pugi::xml_attribute attribute = element.attribute("num.visible")) {
+        this->SetNumVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1377,9 +1377,9 @@ void AttOctaveLog::ResetOctaveLog()
 bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        element.remove_attribute("coll");
+    if (pugi::xml_attribute attribute = element.attribute("coll")) {
+        this->SetColl(StrToOctaveLogColl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1423,9 +1423,9 @@ void AttPedalLog::ResetPedalLog()
 bool AttPedalLog::ReadPedalLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        element.remove_attribute("dir");
+    if (pugi::xml_attribute attribute = element.attribute("dir")) {
+        this->SetDir(StrToPedalLogDir(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1469,9 +1469,9 @@ void AttPedalVis::ResetPedalVis()
 bool AttPedalVis::ReadPedalVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToPedalVisForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1515,9 +1515,9 @@ void AttPianopedals::ResetPianopedals()
 bool AttPianopedals::ReadPianopedals(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPianopedalsPedalstyle(element.attribute("pedal.style").value()));
-        element.remove_attribute("pedal.style");
+    if (pugi::xml_attribute attribute = element.attribute("pedal.style")) {
+        this->SetPedalStyle(StrToPianopedalsPedalstyle(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1561,9 +1561,9 @@ void AttRehearsal::ResetRehearsal()
 bool AttRehearsal::ReadRehearsal(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        element.remove_attribute("reh.enclose");
+    if (pugi::xml_attribute attribute = element.attribute("reh.enclose")) {
+        this->SetRehEnclose(StrToRehearsalRehenclose(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1607,9 +1607,9 @@ void AttScoreDefVisCmn::ResetScoreDefVisCmn()
 bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    if (pugi::xml_attribute attribute = element.attribute("grid.show")) {
+        this->SetGridShow(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1654,14 +1654,14 @@ void AttSlurrend::ResetSlurrend()
 bool AttSlurrend::ReadSlurrend(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        element.remove_attribute("slur.lform");
+    if (pugi::xml_attribute attribute = element.attribute("slur.lform")) {
+        this->SetSlurLform(StrToLineform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToStr(element.attribute("slur.lwidth").value()));
-        element.remove_attribute("slur.lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("slur.lwidth")) {
+        this->SetSlurLwidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1714,9 +1714,9 @@ void AttStemsCmn::ResetStemsCmn()
 bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToOtherstaff(element.attribute("stem.with").value()));
-        element.remove_attribute("stem.with");
+    if (pugi::xml_attribute attribute = element.attribute("stem.with")) {
+        this->SetStemWith(StrToOtherstaff(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1761,14 +1761,14 @@ void AttTierend::ResetTierend()
 bool AttTierend::ReadTierend(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        element.remove_attribute("tie.lform");
+    if (pugi::xml_attribute attribute = element.attribute("tie.lform")) {
+        this->SetTieLform(StrToLineform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToStr(element.attribute("tie.lwidth").value()));
-        element.remove_attribute("tie.lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("tie.lwidth")) {
+        this->SetTieLwidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1821,9 +1821,9 @@ void AttTremmeasured::ResetTremmeasured()
 bool AttTremmeasured::ReadTremmeasured(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("measperf")) {
-        this->SetMeasperf(StrToDuration(element.attribute("measperf").value()));
-        element.remove_attribute("measperf");
+    if (pugi::xml_attribute attribute = element.attribute("measperf")) {
+        this->SetMeasperf(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1870,24 +1870,24 @@ void AttTupletVis::ResetTupletVis()
 bool AttTupletVis::ReadTupletVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToPlace(element.attribute("bracket.place").value()));
-        element.remove_attribute("bracket.place");
+    if (pugi::xml_attribute attribute = element.attribute("bracket.place")) {
+        this->SetBracketPlace(StrToPlace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        element.remove_attribute("bracket.visible");
+    if (pugi::xml_attribute attribute = element.attribute("bracket.visible")) {
+        this->SetBracketVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        element.remove_attribute("dur.visible");
+    if (pugi::xml_attribute attribute = element.attribute("dur.visible")) {
+        this->SetDurVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        element.remove_attribute("num.format");
+    if (pugi::xml_attribute attribute = element.attribute("num.format")) {
+        this->SetNumFormat(StrToTupletVisNumformat(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
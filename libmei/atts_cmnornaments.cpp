@@ -48,14 +48,14 @@ void AttMordentLog::ResetMordentLog()
 bool AttMordentLog::ReadMordentLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToMordentLogForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        element.remove_attribute("long");
+    if (pugi::xml_attribute attribute = element.attribute("long")) {
+        this->SetLong(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -108,9 +108,9 @@ void AttOrnam::ResetOrnam()
 bool AttOrnam::ReadOrnam(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        element.remove_attribute("ornam");
+    if (pugi::xml_attribute attribute = element.attribute("ornam")) {
+        this->SetOrnam(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -155,14 +155,14 @@ void AttOrnamentaccid::ResetOrnamentaccid()
 bool AttOrnamentaccid::ReadOrnamentaccid(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalExplicit(element.attribute("accidupper").value()));
-        element.remove_attribute("accidupper");
+    if (pugi::xml_attribute attribute = element.attribute("accidupper")) {
+        this->SetAccidupper(StrToAccidentalExplicit(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalExplicit(element.attribute("accidlower").value()));
-        element.remove_attribute("accidlower");
+    if (pugi::xml_attribute attribute = element.attribute("accidlower")) {
+        this->SetAccidlower(StrToAccidentalExplicit(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -216,14 +216,14 @@ void AttTurnLog::ResetTurnLog()
 bool AttTurnLog::ReadTurnLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        element.remove_attribute("delayed");
+    if (pugi::xml_attribute attribute = element.attribute("delayed")) {
+        this->SetDelayed(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToTurnLogForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -47,9 +47,9 @@ void AttCrit::ResetCrit()
 bool AttCrit::ReadCrit(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        element.remove_attribute("cause");
+    if (pugi::xml_attribute attribute = element.attribute("cause")) {
+        this->SetCause(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -93,9 +93,9 @@ void AttSource::ResetSource()
 bool AttSource::ReadSource(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        element.remove_attribute("source");
+    if (pugi::xml_attribute attribute = element.attribute("source")) {
+        this->SetSource(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
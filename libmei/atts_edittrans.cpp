@@ -47,9 +47,9 @@ void AttAgentident::ResetAgentident()
 bool AttAgentident::ReadAgentident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        element.remove_attribute("agent");
+    if (pugi::xml_attribute attribute = element.attribute("agent")) {
+        this->SetAgent(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -94,14 +94,14 @@ void AttEvidence::ResetEvidence()
 bool AttEvidence::ReadEvidence(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        element.remove_attribute("cert");
+    if (pugi::xml_attribute attribute = element.attribute("cert")) {
+        this->SetCert(StrToCertainty(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        element.remove_attribute("evidence");
+    if (pugi::xml_attribute attribute = element.attribute("evidence")) {
+        this->SetEvidence(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -154,9 +154,9 @@ void AttExtent::ResetExtent()
 bool AttExtent::ReadExtent(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        element.remove_attribute("extent");
+    if (pugi::xml_attribute attribute = element.attribute("extent")) {
+        this->SetExtent(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -200,9 +200,9 @@ void AttReasonident::ResetReasonident()
 bool AttReasonident::ReadReasonident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        element.remove_attribute("reason");
+    if (pugi::xml_attribute attribute = element.attribute("reason")) {
+        this->SetReason(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
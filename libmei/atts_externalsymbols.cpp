@@ -48,14 +48,14 @@ void AttExtsym::ResetExtsym()
 bool AttExtsym::ReadExtsym(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyphname")) {
-        this->SetGlyphname(StrToStr(element.attribute("glyphname").value()));
-        element.remove_attribute("glyphname");
+    if (pugi::xml_attribute attribute = element.attribute("glyphname")) {
+        this->SetGlyphname(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("glyphnum")) {
-        this->SetGlyphnum(StrToWcharT(element.attribute("glyphnum").value()));
-        element.remove_attribute("glyphnum");
+    if (pugi::xml_attribute attribute = element.attribute("glyphnum")) {
+        this->SetGlyphnum(StrToWcharT(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
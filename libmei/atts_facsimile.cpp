@@ -47,9 +47,9 @@ void AttFacsimile::ResetFacsimile()
 bool AttFacsimile::ReadFacsimile(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("facs")) {
-        this->SetFacs(StrToUris(element.attribute("facs").value()));
-        element.remove_attribute("facs");
+    if (pugi::xml_attribute attribute = element.attribute("facs")) {
+        this->SetFacs(StrToUris(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -47,9 +47,9 @@ void AttFretlocation::ResetFretlocation()
 bool AttFretlocation::ReadFretlocation(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("fret")) {
-        this->SetFret(StrToFret(element.attribute("fret").value()));
-        element.remove_attribute("fret");
+    if (pugi::xml_attribute attribute = element.attribute("fret")) {
+        this->SetFret(StrToFret(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -93,9 +93,9 @@ void AttHarmLog::ResetHarmLog()
 bool AttHarmLog::ReadHarmLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("chordref")) {
-        this->SetChordref(StrToStr(element.attribute("chordref").value()));
-        element.remove_attribute("chordref");
+    if (pugi::xml_attribute attribute = element.attribute("chordref")) {
+        this->SetChordref(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -139,9 +139,9 @@ void AttHarmVis::ResetHarmVis()
 bool AttHarmVis::ReadHarmVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        element.remove_attribute("rendgrid");
+    if (pugi::xml_attribute attribute = element.attribute("rendgrid")) {
+        this->SetRendgrid(StrToHarmVisRendgrid(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -47,9 +47,9 @@ void AttRegularmethod::ResetRegularmethod()
 bool AttRegularmethod::ReadRegularmethod(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularmethodMethod(element.attribute("method").value()));
-        element.remove_attribute("method");
+    if (pugi::xml_attribute attribute = element.attribute("method")) {
+        this->SetMethod(StrToRegularmethodMethod(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
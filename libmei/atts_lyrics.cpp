@@ -48,14 +48,14 @@ void AttVerseLog::ResetVerseLog()
 bool AttVerseLog::ReadVerseLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("refrain")) {
-        this->SetRefrain(StrToBoolean(element.attribute("refrain").value()));
-        element.remove_attribute("refrain");
+    if (pugi::xml_attribute attribute = element.attribute("refrain")) {
+        this->SetRefrain(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("rhythm")) {
-        this->SetRhythm(StrToStr(element.attribute("rhythm").value()));
-        element.remove_attribute("rhythm");
+    if (pugi::xml_attribute attribute = element.attribute("rhythm")) {
+        this->SetRhythm(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -48,14 +48,14 @@ void AttNotationtype::ResetNotationtype()
 bool AttNotationtype::ReadNotationtype(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        element.remove_attribute("notationtype");
+    if (pugi::xml_attribute attribute = element.attribute("notationtype")) {
+        this->SetNotationtype(StrToNotationtype(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        element.remove_attribute("notationsubtype");
+    if (pugi::xml_attribute attribute = element.attribute("notationsubtype")) {
+        this->SetNotationsubtype(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
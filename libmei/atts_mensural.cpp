@@ -47,9 +47,9 @@ void AttLigatureLog::ResetLigatureLog()
 bool AttLigatureLog::ReadLigatureLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToLigatureform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -94,14 +94,14 @@ void AttMensurVis::ResetMensurVis()
 bool AttMensurVis::ReadMensurVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToMensurVisForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        element.remove_attribute("orient");
+    if (pugi::xml_attribute attribute = element.attribute("orient")) {
+        this->SetOrient(StrToOrientation(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -158,29 +158,29 @@ void AttMensuralLog::ResetMensuralLog()
 bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        element.remove_attribute("mensur.dot");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.dot")) {
+        this->SetMensurDot(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        element.remove_attribute("mensur.sign");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.sign")) {
+        this->SetMensurSign(StrToMensurationsign(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        element.remove_attribute("mensur.slash");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.slash")) {
+        this->SetMensurSlash(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        element.remove_attribute("proport.num");
+    if (pugi::xml_attribute attribute = element.attribute("proport.num")) {
+        this->SetProportNum(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        element.remove_attribute("proport.numbase");
+    if (pugi::xml_attribute attribute = element.attribute("proport.numbase")) {
+        this->SetProportNumbase(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -263,24 +263,24 @@ void AttMensuralShared::ResetMensuralShared()
 bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        element.remove_attribute("modusmaior");
+    if (pugi::xml_attribute attribute = element.attribute("modusmaior")) {
+        this->SetModusmaior(StrToModusmaior(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        element.remove_attribute("modusminor");
+    if (pugi::xml_attribute attribute = element.attribute("modusminor")) {
+        this->SetModusminor(StrToModusminor(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        element.remove_attribute("prolatio");
+    if (pugi::xml_attribute attribute = element.attribute("prolatio")) {
+        this->SetProlatio(StrToProlatio(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        element.remove_attribute("tempus");
+    if (pugi::xml_attribute attribute = element.attribute("tempus")) {
+        this->SetTempus(StrToTempus(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -355,29 +355,29 @@ void AttMensuralVis::ResetMensuralVis()
 bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        element.remove_attribute("mensur.color");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.color")) {
+        this->SetMensurColor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        element.remove_attribute("mensur.form");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.form")) {
+        this->SetMensurForm(StrToMensuralVisMensurform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        element.remove_attribute("mensur.loc");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.loc")) {
+        this->SetMensurLoc(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        element.remove_attribute("mensur.orient");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.orient")) {
+        this->SetMensurOrient(StrToOrientation(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToSize(element.attribute("mensur.size").value()));
-        element.remove_attribute("mensur.size");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.size")) {
+        this->SetMensurSize(StrToSize(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -457,9 +457,9 @@ void AttNoteLogMensural::ResetNoteLogMensural()
 bool AttNoteLogMensural::ReadNoteLogMensural(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToNoteLogMensuralLig(element.attribute("lig").value()));
-        element.remove_attribute("lig");
+    if (pugi::xml_attribute attribute = element.attribute("lig")) {
+        this->SetLig(StrToNoteLogMensuralLig(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -503,9 +503,9 @@ void AttRestVisMensural::ResetRestVisMensural()
 bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        element.remove_attribute("spaces");
+    if (pugi::xml_attribute attribute = element.attribute("spaces")) {
+        this->SetSpaces(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
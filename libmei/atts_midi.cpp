@@ -50,24 +50,24 @@ void AttChannelized::ResetChannelized()
 bool AttChannelized::ReadChannelized(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        element.remove_attribute("midi.channel");
+    if (pugi::xml_attribute attribute = element.attribute("midi.channel")) {
+        this->SetMidiChannel(StrToMidichannel(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercent(element.attribute("midi.duty").value()));
-        element.remove_attribute("midi.duty");
+    if (pugi::xml_attribute attribute = element.attribute("midi.duty")) {
+        this->SetMidiDuty(StrToPercent(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalue(element.attribute("midi.port").value()));
-        element.remove_attribute("midi.port");
+    if (pugi::xml_attribute attribute = element.attribute("midi.port")) {
+        this->SetMidiPort(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        element.remove_attribute("midi.track");
+    if (pugi::xml_attribute attribute = element.attribute("midi.track")) {
+        this->SetMidiTrack(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -141,24 +141,24 @@ void AttMidiinstrument::ResetMidiinstrument()
 bool AttMidiinstrument::ReadMidiinstrument(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        element.remove_attribute("midi.instrnum");
+    if (pugi::xml_attribute attribute = element.attribute("midi.instrnum")) {
+        this->SetMidiInstrnum(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.instrname")) {
-        this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        element.remove_attribute("midi.instrname");
+    if (pugi::xml_attribute attribute = element.attribute("midi.instrname")) {
+        this->SetMidiInstrname(StrToMidinames(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivalue(element.attribute("midi.pan").value()));
-        element.remove_attribute("midi.pan");
+    if (pugi::xml_attribute attribute = element.attribute("midi.pan")) {
+        this->SetMidiPan(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToMidivalue(element.attribute("midi.volume").value()));
-        element.remove_attribute("midi.volume");
+    if (pugi::xml_attribute attribute = element.attribute("midi.volume")) {
+        this->SetMidiVolume(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -229,9 +229,9 @@ void AttMidinumber::ResetMidinumber()
 bool AttMidinumber::ReadMidinumber(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -276,14 +276,14 @@ void AttMiditempo::ResetMiditempo()
 bool AttMiditempo::ReadMiditempo(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToMidibpm(element.attribute("midi.bpm").value()));
-        element.remove_attribute("midi.bpm");
+    if (pugi::xml_attribute attribute = element.attribute("midi.bpm")) {
+        this->SetMidiBpm(StrToMidibpm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        element.remove_attribute("midi.mspb");
+    if (pugi::xml_attribute attribute = element.attribute("midi.mspb")) {
+        this->SetMidiMspb(StrToMidimspb(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -336,9 +336,9 @@ void AttMidivalue::ResetMidivalue()
 bool AttMidivalue::ReadMidivalue(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        element.remove_attribute("val");
+    if (pugi::xml_attribute attribute = element.attribute("val")) {
+        this->SetVal(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -382,9 +382,9 @@ void AttMidivalue2::ResetMidivalue2()
 bool AttMidivalue2::ReadMidivalue2(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        element.remove_attribute("val2");
+    if (pugi::xml_attribute attribute = element.attribute("val2")) {
+        this->SetVal2(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -428,9 +428,9 @@ void AttMidivelocity::ResetMidivelocity()
 bool AttMidivelocity::ReadMidivelocity(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        element.remove_attribute("vel");
+    if (pugi::xml_attribute attribute = element.attribute("vel")) {
+        this->SetVel(StrToMidivalue(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -474,9 +474,9 @@ void AttTimebase::ResetTimebase()
 bool AttTimebase::ReadTimebase(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        element.remove_attribute("ppq");
+    if (pugi::xml_attribute attribute = element.attribute("ppq")) {
+        this->SetPpq(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
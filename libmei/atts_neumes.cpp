@@ -48,14 +48,14 @@ void AttIneumeLog::ResetIneumeLog()
 bool AttIneumeLog::ReadIneumeLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToIneumeform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToIneumeform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("name")) {
-        this->SetName(StrToIneumename(element.attribute("name").value()));
-        element.remove_attribute("name");
+    if (pugi::xml_attribute attribute = element.attribute("name")) {
+        this->SetName(StrToIneumename(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -109,14 +109,14 @@ void AttUneumeLog::ResetUneumeLog()
 bool AttUneumeLog::ReadUneumeLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToUneumeform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToUneumeform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("name")) {
-        this->SetName(StrToUneumename(element.attribute("name").value()));
-        element.remove_attribute("name");
+    if (pugi::xml_attribute attribute = element.attribute("name")) {
+        this->SetName(StrToUneumename(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
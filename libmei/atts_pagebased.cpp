@@ -47,9 +47,9 @@ void AttSurface::ResetSurface()
 bool AttSurface::ReadSurface(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("surface")) {
-        this->SetSurface(StrToStr(element.attribute("surface").value()));
-        element.remove_attribute("surface");
+    if (pugi::xml_attribute attribute = element.attribute("surface")) {
+        this->SetSurface(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
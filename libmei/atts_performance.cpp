@@ -47,9 +47,9 @@ void AttAlignment::ResetAlignment()
 bool AttAlignment::ReadAlignment(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("when")) {
-        this->SetWhen(StrToStr(element.attribute("when").value()));
-        element.remove_attribute("when");
+    if (pugi::xml_attribute attribute = element.attribute("when")) {
+        this->SetWhen(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -47,9 +47,9 @@ void AttAccidLog::ResetAccidLog()
 bool AttAccidLog::ReadAccidLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToAccidLogFunc(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -93,9 +93,9 @@ void AttAccidental::ResetAccidental()
 bool AttAccidental::ReadAccidental(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalExplicit(element.attribute("accid").value()));
-        element.remove_attribute("accid");
+    if (pugi::xml_attribute attribute = element.attribute("accid")) {
+        this->SetAccid(StrToAccidentalExplicit(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -139,9 +139,9 @@ void AttAccidentalPerformed::ResetAccidentalPerformed()
 bool AttAccidentalPerformed::ReadAccidentalPerformed(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalImplicit(element.attribute("accid.ges").value()));
-        element.remove_attribute("accid.ges");
+    if (pugi::xml_attribute attribute = element.attribute("accid.ges")) {
+        this->SetAccidGes(StrToAccidentalImplicit(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -185,9 +185,9 @@ void AttArticulation::ResetArticulation()
 bool AttArticulation::ReadArticulation(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        element.remove_attribute("artic");
+    if (pugi::xml_attribute attribute = element.attribute("artic")) {
+        this->SetArtic(StrToArticulationList(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -231,9 +231,9 @@ void AttArticulationPerformed::ResetArticulationPerformed()
 bool AttArticulationPerformed::ReadArticulationPerformed(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulation(element.attribute("artic.ges").value()));
-        element.remove_attribute("artic.ges");
+    if (pugi::xml_attribute attribute = element.attribute("artic.ges")) {
+        this->SetArticGes(StrToArticulation(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -277,9 +277,9 @@ void AttAugmentdots::ResetAugmentdots()
 bool AttAugmentdots::ReadAugmentdots(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        element.remove_attribute("dots");
+    if (pugi::xml_attribute attribute = element.attribute("dots")) {
+        this->SetDots(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -324,14 +324,14 @@ void AttAuthorized::ResetAuthorized()
 bool AttAuthorized::ReadAuthorized(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("authority")) {
-        this->SetAuthority(StrToStr(element.attribute("authority").value()));
-        element.remove_attribute("authority");
+    if (pugi::xml_attribute attribute = element.attribute("authority")) {
+        this->SetAuthority(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("authURI")) {
-        this->SetAuthURI(StrToStr(element.attribute("authURI").value()));
-        element.remove_attribute("authURI");
+    if (pugi::xml_attribute attribute = element.attribute("authURI")) {
+        this->SetAuthURI(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -384,9 +384,9 @@ void AttBarLineLog::ResetBarLineLog()
 bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBarrendition(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -431,14 +431,14 @@ void AttBarplacement::ResetBarplacement()
 bool AttBarplacement::ReadBarplacement(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("barplace")) {
-        this->SetBarplace(StrToBarplace(element.attribute("barplace").value()));
-        element.remove_attribute("barplace");
+    if (pugi::xml_attribute attribute = element.attribute("barplace")) {
+        this->SetBarplace(StrToBarplace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("taktplace")) {
-        this->SetTaktplace(StrToInt(element.attribute("taktplace").value()));
-        element.remove_attribute("taktplace");
+    if (pugi::xml_attribute attribute = element.attribute("taktplace")) {
+        this->SetTaktplace(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -493,19 +493,19 @@ void AttBeamingVis::ResetBeamingVis()
 bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        element.remove_attribute("beam.color");
+    if (pugi::xml_attribute attribute = element.attribute("beam.color")) {
+        this->SetBeamColor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        element.remove_attribute("beam.rend");
+    if (pugi::xml_attribute attribute = element.attribute("beam.rend")) {
+        this->SetBeamRend(StrToBeamingVisBeamrend(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        element.remove_attribute("beam.slope");
+    if (pugi::xml_attribute attribute = element.attribute("beam.slope")) {
+        this->SetBeamSlope(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -567,9 +567,9 @@ void AttBibl::ResetBibl()
 bool AttBibl::ReadBibl(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        element.remove_attribute("analog");
+    if (pugi::xml_attribute attribute = element.attribute("analog")) {
+        this->SetAnalog(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -613,9 +613,9 @@ void AttCalendared::ResetCalendared()
 bool AttCalendared::ReadCalendared(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        element.remove_attribute("calendar");
+    if (pugi::xml_attribute attribute = element.attribute("calendar")) {
+        this->SetCalendar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -659,9 +659,9 @@ void AttCanonical::ResetCanonical()
 bool AttCanonical::ReadCanonical(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        element.remove_attribute("codedval");
+    if (pugi::xml_attribute attribute = element.attribute("codedval")) {
+        this->SetCodedval(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -705,9 +705,9 @@ void AttChordVis::ResetChordVis()
 bool AttChordVis::ReadChordVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        element.remove_attribute("cluster");
+    if (pugi::xml_attribute attribute = element.attribute("cluster")) {
+        this->SetCluster(StrToCluster(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -751,9 +751,9 @@ void AttClasscodeident::ResetClasscodeident()
 bool AttClasscodeident::ReadClasscodeident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("classcode")) {
-        this->SetClasscode(StrToStr(element.attribute("classcode").value()));
-        element.remove_attribute("classcode");
+    if (pugi::xml_attribute attribute = element.attribute("classcode")) {
+        this->SetClasscode(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -797,9 +797,9 @@ void AttClefLog::ResetClefLog()
 bool AttClefLog::ReadClefLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        element.remove_attribute("cautionary");
+    if (pugi::xml_attribute attribute = element.attribute("cautionary")) {
+        this->SetCautionary(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -846,24 +846,24 @@ void AttCleffingLog::ResetCleffingLog()
 bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        element.remove_attribute("clef.shape");
+    if (pugi::xml_attribute attribute = element.attribute("clef.shape")) {
+        this->SetClefShape(StrToClefshape(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        element.remove_attribute("clef.line");
+    if (pugi::xml_attribute attribute = element.attribute("clef.line")) {
+        this->SetClefLine(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        element.remove_attribute("clef.dis");
+    if (pugi::xml_attribute attribute = element.attribute("clef.dis")) {
+        this->SetClefDis(StrToOctaveDis(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToPlace(element.attribute("clef.dis.place").value()));
-        element.remove_attribute("clef.dis.place");
+    if (pugi::xml_attribute attribute = element.attribute("clef.dis.place")) {
+        this->SetClefDisPlace(StrToPlace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -935,14 +935,14 @@ void AttCleffingVis::ResetCleffingVis()
 bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        element.remove_attribute("clef.color");
+    if (pugi::xml_attribute attribute = element.attribute("clef.color")) {
+        this->SetClefColor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        element.remove_attribute("clef.visible");
+    if (pugi::xml_attribute attribute = element.attribute("clef.visible")) {
+        this->SetClefVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -995,9 +995,9 @@ void AttClefshape::ResetClefshape()
 bool AttClefshape::ReadClefshape(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    if (pugi::xml_attribute attribute = element.attribute("shape")) {
+        this->SetShape(StrToClefshape(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1041,9 +1041,9 @@ void AttColor::ResetColor()
 bool AttColor::ReadColor(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        element.remove_attribute("color");
+    if (pugi::xml_attribute attribute = element.attribute("color")) {
+        this->SetColor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1087,9 +1087,9 @@ void AttColoration::ResetColoration()
 bool AttColoration::ReadColoration(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        element.remove_attribute("colored");
+    if (pugi::xml_attribute attribute = element.attribute("colored")) {
+        this->SetColored(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1133,9 +1133,9 @@ void AttCommon::ResetCommon()
 bool AttCommon::ReadCommon(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        element.remove_attribute("n");
+    if (pugi::xml_attribute attribute = element.attribute("n")) {
+        this->SetN(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1180,14 +1180,14 @@ void AttCommonPart::ResetCommonPart()
 bool AttCommonPart::ReadCommonPart(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        element.remove_attribute("label");
+    if (pugi::xml_attribute attribute = element.attribute("label")) {
+        this->SetLabel(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        element.remove_attribute("xml:base");
+    if (pugi::xml_attribute attribute = element.attribute("xml:base")) {
+        this->SetBase(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1243,24 +1243,24 @@ void AttCoordinated::ResetCoordinated()
 bool AttCoordinated::ReadCoordinated(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        element.remove_attribute("ulx");
+    if (pugi::xml_attribute attribute = element.attribute("ulx")) {
+        this->SetUlx(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        element.remove_attribute("uly");
+    if (pugi::xml_attribute attribute = element.attribute("uly")) {
+        this->SetUly(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        element.remove_attribute("lrx");
+    if (pugi::xml_attribute attribute = element.attribute("lrx")) {
+        this->SetLrx(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        element.remove_attribute("lry");
+    if (pugi::xml_attribute attribute = element.attribute("lry")) {
+        this->SetLry(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1333,19 +1333,19 @@ void AttCurvature::ResetCurvature()
 bool AttCurvature::ReadCurvature(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        element.remove_attribute("bezier");
+    if (pugi::xml_attribute attribute = element.attribute("bezier")) {
+        this->SetBezier(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToDbl(element.attribute("bulge").value()));
-        element.remove_attribute("bulge");
+    if (pugi::xml_attribute attribute = element.attribute("bulge")) {
+        this->SetBulge(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        element.remove_attribute("curvedir");
+    if (pugi::xml_attribute attribute = element.attribute("curvedir")) {
+        this->SetCurvedir(StrToCurvatureCurvedir(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1408,14 +1408,14 @@ void AttCurverend::ResetCurverend()
 bool AttCurverend::ReadCurverend(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
+    if (pugi::xml_attribute attribute = element.attribute("lform")) {
+        this->SetLform(StrToLineform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToStr(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("lwidth")) {
+        this->SetLwidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1468,9 +1468,9 @@ void AttCustosLog::ResetCustosLog()
 bool AttCustosLog::ReadCustosLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        element.remove_attribute("target");
+    if (pugi::xml_attribute attribute = element.attribute("target")) {
+        this->SetTarget(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1518,29 +1518,29 @@ void AttDatable::ResetDatable()
 bool AttDatable::ReadDatable(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        element.remove_attribute("enddate");
+    if (pugi::xml_attribute attribute = element.attribute("enddate")) {
+        this->SetEnddate(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        element.remove_attribute("isodate");
+    if (pugi::xml_attribute attribute = element.attribute("isodate")) {
+        this->SetIsodate(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        element.remove_attribute("notafter");
+    if (pugi::xml_attribute attribute = element.attribute("notafter")) {
+        this->SetNotafter(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        element.remove_attribute("notbefore");
+    if (pugi::xml_attribute attribute = element.attribute("notbefore")) {
+        this->SetNotbefore(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        element.remove_attribute("startdate");
+    if (pugi::xml_attribute attribute = element.attribute("startdate")) {
+        this->SetStartdate(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1620,9 +1620,9 @@ void AttDatapointing::ResetDatapointing()
 bool AttDatapointing::ReadDatapointing(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        element.remove_attribute("data");
+    if (pugi::xml_attribute attribute = element.attribute("data")) {
+        this->SetData(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1666,9 +1666,9 @@ void AttDeclaring::ResetDeclaring()
 bool AttDeclaring::ReadDeclaring(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        element.remove_attribute("decls");
+    if (pugi::xml_attribute attribute = element.attribute("decls")) {
+        this->SetDecls(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1714,19 +1714,19 @@ void AttDistances::ResetDistances()
 bool AttDistances::ReadDistances(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToStr(element.attribute("dynam.dist").value()));
-        element.remove_attribute("dynam.dist");
+    if (pugi::xml_attribute attribute = element.attribute("dynam.dist")) {
+        this->SetDynamDist(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToStr(element.attribute("harm.dist").value()));
-        element.remove_attribute("harm.dist");
+    if (pugi::xml_attribute attribute = element.attribute("harm.dist")) {
+        this->SetHarmDist(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.dist")) {
-        this->SetTextDist(StrToStr(element.attribute("text.dist").value()));
-        element.remove_attribute("text.dist");
+    if (pugi::xml_attribute attribute = element.attribute("text.dist")) {
+        this->SetTextDist(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1788,9 +1788,9 @@ void AttDotLog::ResetDotLog()
 bool AttDotLog::ReadDotLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToDotLogForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1834,9 +1834,9 @@ void AttDurationAdditive::ResetDurationAdditive()
 bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    if (pugi::xml_attribute attribute = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1882,19 +1882,19 @@ void AttDurationDefault::ResetDurationDefault()
 bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        element.remove_attribute("dur.default");
+    if (pugi::xml_attribute attribute = element.attribute("dur.default")) {
+        this->SetDurDefault(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        element.remove_attribute("num.default");
+    if (pugi::xml_attribute attribute = element.attribute("num.default")) {
+        this->SetNumDefault(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        element.remove_attribute("numbase.default");
+    if (pugi::xml_attribute attribute = element.attribute("numbase.default")) {
+        this->SetNumbaseDefault(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1956,9 +1956,9 @@ void AttDurationMusical::ResetDurationMusical()
 bool AttDurationMusical::ReadDurationMusical(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    if (pugi::xml_attribute attribute = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2002,9 +2002,9 @@ void AttDurationPerformed::ResetDurationPerformed()
 bool AttDurationPerformed::ReadDurationPerformed(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        element.remove_attribute("dur.ges");
+    if (pugi::xml_attribute attribute = element.attribute("dur.ges")) {
+        this->SetDurGes(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2049,14 +2049,14 @@ void AttDurationRatio::ResetDurationRatio()
 bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        element.remove_attribute("numbase");
+    if (pugi::xml_attribute attribute = element.attribute("numbase")) {
+        this->SetNumbase(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2109,9 +2109,9 @@ void AttEnclosingchars::ResetEnclosingchars()
 bool AttEnclosingchars::ReadEnclosingchars(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        element.remove_attribute("enclose");
+    if (pugi::xml_attribute attribute = element.attribute("enclose")) {
+        this->SetEnclose(StrToEnclosure(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2155,9 +2155,9 @@ void AttEndings::ResetEndings()
 bool AttEndings::ReadEndings(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        element.remove_attribute("ending.rend");
+    if (pugi::xml_attribute attribute = element.attribute("ending.rend")) {
+        this->SetEndingRend(StrToEndingsEndingrend(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2201,9 +2201,9 @@ void AttExtender::ResetExtender()
 bool AttExtender::ReadExtender(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        element.remove_attribute("extender");
+    if (pugi::xml_attribute attribute = element.attribute("extender")) {
+        this->SetExtender(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2247,9 +2247,9 @@ void AttFermatapresent::ResetFermatapresent()
 bool AttFermatapresent::ReadFermatapresent(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToPlace(element.attribute("fermata").value()));
-        element.remove_attribute("fermata");
+    if (pugi::xml_attribute attribute = element.attribute("fermata")) {
+        this->SetFermata(StrToPlace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2293,9 +2293,9 @@ void AttFiling::ResetFiling()
 bool AttFiling::ReadFiling(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        element.remove_attribute("nonfiling");
+    if (pugi::xml_attribute attribute = element.attribute("nonfiling")) {
+        this->SetNonfiling(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2339,9 +2339,9 @@ void AttGrpSymLog::ResetGrpSymLog()
 bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        element.remove_attribute("level");
+    if (pugi::xml_attribute attribute = element.attribute("level")) {
+        this->SetLevel(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2385,9 +2385,9 @@ void AttHandident::ResetHandident()
 bool AttHandident::ReadHandident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        element.remove_attribute("hand");
+    if (pugi::xml_attribute attribute = element.attribute("hand")) {
+        this->SetHand(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2431,9 +2431,9 @@ void AttHeight::ResetHeight()
 bool AttHeight::ReadHeight(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToStr(element.attribute("height").value()));
-        element.remove_attribute("height");
+    if (pugi::xml_attribute attribute = element.attribute("height")) {
+        this->SetHeight(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2477,9 +2477,9 @@ void AttHorizontalalign::ResetHorizontalalign()
 bool AttHorizontalalign::ReadHorizontalalign(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        element.remove_attribute("halign");
+    if (pugi::xml_attribute attribute = element.attribute("halign")) {
+        this->SetHalign(StrToHorizontalalignment(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2523,9 +2523,9 @@ void AttInstrumentident::ResetInstrumentident()
 bool AttInstrumentident::ReadInstrumentident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        element.remove_attribute("instr");
+    if (pugi::xml_attribute attribute = element.attribute("instr")) {
+        this->SetInstr(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2569,9 +2569,9 @@ void AttInternetmedia::ResetInternetmedia()
 bool AttInternetmedia::ReadInternetmedia(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        element.remove_attribute("mimetype");
+    if (pugi::xml_attribute attribute = element.attribute("mimetype")) {
+        this->SetMimetype(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2615,9 +2615,9 @@ void AttJoined::ResetJoined()
 bool AttJoined::ReadJoined(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        element.remove_attribute("join");
+    if (pugi::xml_attribute attribute = element.attribute("join")) {
+        this->SetJoin(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2663,19 +2663,19 @@ void AttKeySigLog::ResetKeySigLog()
 bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        element.remove_attribute("sig");
+    if (pugi::xml_attribute attribute = element.attribute("sig")) {
+        this->SetSig(StrToKeysignature(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sig.mixed")) {
-        this->SetSigMixed(StrToStr(element.attribute("sig.mixed").value()));
-        element.remove_attribute("sig.mixed");
+    if (pugi::xml_attribute attribute = element.attribute("sig.mixed")) {
+        this->SetSigMixed(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        element.remove_attribute("mode");
+    if (pugi::xml_attribute attribute = element.attribute("mode")) {
+        this->SetMode(StrToMode(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2737,9 +2737,9 @@ void AttKeySigVis::ResetKeySigVis()
 bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig.showchange")) {
-        this->SetSigShowchange(StrToBoolean(element.attribute("sig.showchange").value()));
-        element.remove_attribute("sig.showchange");
+    if (pugi::xml_attribute attribute = element.attribute("sig.showchange")) {
+        this->SetSigShowchange(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2787,29 +2787,29 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
 bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalImplicit(element.attribute("key.accid").value()));
-        element.remove_attribute("key.accid");
+    if (pugi::xml_attribute attribute = element.attribute("key.accid")) {
+        this->SetKeyAccid(StrToAccidentalImplicit(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        element.remove_attribute("key.mode");
+    if (pugi::xml_attribute attribute = element.attribute("key.mode")) {
+        this->SetKeyMode(StrToMode(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        element.remove_attribute("key.pname");
+    if (pugi::xml_attribute attribute = element.attribute("key.pname")) {
+        this->SetKeyPname(StrToPitchname(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.sig")) {
-        this->SetKeySig(StrToKeysignature(element.attribute("key.sig").value()));
-        element.remove_attribute("key.sig");
+    if (pugi::xml_attribute attribute = element.attribute("key.sig")) {
+        this->SetKeySig(StrToKeysignature(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.sig.mixed")) {
-        this->SetKeySigMixed(StrToStr(element.attribute("key.sig.mixed").value()));
-        element.remove_attribute("key.sig.mixed");
+    if (pugi::xml_attribute attribute = element.attribute("key.sig.mixed")) {
+        this->SetKeySigMixed(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2890,14 +2890,14 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
 bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.sig.show")) {
-        this->SetKeySigShow(StrToBoolean(element.attribute("key.sig.show").value()));
-        element.remove_attribute("key.sig.show");
+    if (pugi::xml_attribute attribute = element.attribute("key.sig.show")) {
+        this->SetKeySigShow(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.sig.showchange")) {
-        this->SetKeySigShowchange(StrToBoolean(element.attribute("key.sig.showchange").value()));
-        element.remove_attribute("key.sig.showchange");
+    if (pugi::xml_attribute attribute = element.attribute("key.sig.showchange")) {
+        this->SetKeySigShowchange(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2950,9 +2950,9 @@ void AttLabelsAddl::ResetLabelsAddl()
 bool AttLabelsAddl::ReadLabelsAddl(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("label.abbr")) {
-        this->SetLabelAbbr(StrToStr(element.attribute("label.abbr").value()));
-        element.remove_attribute("label.abbr");
+    if (pugi::xml_attribute attribute = element.attribute("label.abbr")) {
+        this->SetLabelAbbr(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2997,14 +2997,14 @@ void AttLang::ResetLang()
 bool AttLang::ReadLang(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        element.remove_attribute("xml:lang");
+    if (pugi::xml_attribute attribute = element.attribute("xml:lang")) {
+        this->SetLang(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xml:translit")) {
-        this->SetTranslit(StrToStr(element.attribute("xml:translit").value()));
-        element.remove_attribute("xml:translit");
+    if (pugi::xml_attribute attribute = element.attribute("xml:translit")) {
+        this->SetTranslit(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3057,9 +3057,9 @@ void AttLayerLog::ResetLayerLog()
 bool AttLayerLog::ReadLayerLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    if (pugi::xml_attribute attribute = element.attribute("def")) {
+        this->SetDef(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3103,9 +3103,9 @@ void AttLayerident::ResetLayerident()
 bool AttLayerident::ReadLayerident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        element.remove_attribute("layer");
+    if (pugi::xml_attribute attribute = element.attribute("layer")) {
+        this->SetLayer(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3154,34 +3154,34 @@ void AttLineVis::ResetLineVis()
 bool AttLineVis::ReadLineVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToLineform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToStr(element.attribute("width").value()));
-        element.remove_attribute("width");
+    if (pugi::xml_attribute attribute = element.attribute("width")) {
+        this->SetWidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        element.remove_attribute("endsym");
+    if (pugi::xml_attribute attribute = element.attribute("endsym")) {
+        this->SetEndsym(StrToLinestartendsymbol(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endsymsize")) {
-        this->SetEndsymsize(StrToStr(element.attribute("endsymsize").value()));
-        element.remove_attribute("endsymsize");
+    if (pugi::xml_attribute attribute = element.attribute("endsymsize")) {
+        this->SetEndsymsize(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        element.remove_attribute("startsym");
+    if (pugi::xml_attribute attribute = element.attribute("startsym")) {
+        this->SetStartsym(StrToLinestartendsymbol(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("startsymsize")) {
-        this->SetStartsymsize(StrToStr(element.attribute("startsymsize").value()));
-        element.remove_attribute("startsymsize");
+    if (pugi::xml_attribute attribute = element.attribute("startsymsize")) {
+        this->SetStartsymsize(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3270,9 +3270,9 @@ void AttLineloc::ResetLineloc()
 bool AttLineloc::ReadLineloc(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        element.remove_attribute("line");
+    if (pugi::xml_attribute attribute = element.attribute("line")) {
+        this->SetLine(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3319,24 +3319,24 @@ void AttLinerend::ResetLinerend()
 bool AttLinerend::ReadLinerend(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        element.remove_attribute("lendsym");
+    if (pugi::xml_attribute attribute = element.attribute("lendsym")) {
+        this->SetLendsym(StrToLinestartendsymbol(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lendsymsize")) {
-        this->SetLendsymsize(StrToStr(element.attribute("lendsymsize").value()));
-        element.remove_attribute("lendsymsize");
+    if (pugi::xml_attribute attribute = element.attribute("lendsymsize")) {
+        this->SetLendsymsize(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        element.remove_attribute("lstartsym");
+    if (pugi::xml_attribute attribute = element.attribute("lstartsym")) {
+        this->SetLstartsym(StrToLinestartendsymbol(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsymsize")) {
-        this->SetLstartsymsize(StrToStr(element.attribute("lstartsymsize").value()));
-        element.remove_attribute("lstartsymsize");
+    if (pugi::xml_attribute attribute = element.attribute("lstartsymsize")) {
+        this->SetLstartsymsize(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3408,14 +3408,14 @@ void AttLinerendBase::ResetLinerendBase()
 bool AttLinerendBase::ReadLinerendBase(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
+    if (pugi::xml_attribute attribute = element.attribute("lform")) {
+        this->SetLform(StrToLineform(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToStr(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("lwidth")) {
+        this->SetLwidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3473,34 +3473,34 @@ void AttLyricstyle::ResetLyricstyle()
 bool AttLyricstyle::ReadLyricstyle(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToStr(element.attribute("lyric.align").value()));
-        element.remove_attribute("lyric.align");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.align")) {
+        this->SetLyricAlign(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        element.remove_attribute("lyric.fam");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.fam")) {
+        this->SetLyricFam(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        element.remove_attribute("lyric.name");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.name")) {
+        this->SetLyricName(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToInt(element.attribute("lyric.size").value()));
-        element.remove_attribute("lyric.size");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.size")) {
+        this->SetLyricSize(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        element.remove_attribute("lyric.style");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.style")) {
+        this->SetLyricStyle(StrToFontstyle(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        element.remove_attribute("lyric.weight");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.weight")) {
+        this->SetLyricWeight(StrToFontweight(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3590,14 +3590,14 @@ void AttMeasureLog::ResetMeasureLog()
 bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        element.remove_attribute("left");
+    if (pugi::xml_attribute attribute = element.attribute("left")) {
+        this->SetLeft(StrToBarrendition(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        element.remove_attribute("right");
+    if (pugi::xml_attribute attribute = element.attribute("right")) {
+        this->SetRight(StrToBarrendition(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3650,9 +3650,9 @@ void AttMeasurement::ResetMeasurement()
 bool AttMeasurement::ReadMeasurement(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    if (pugi::xml_attribute attribute = element.attribute("unit")) {
+        this->SetUnit(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3696,9 +3696,9 @@ void AttMeasurenumbers::ResetMeasurenumbers()
 bool AttMeasurenumbers::ReadMeasurenumbers(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        element.remove_attribute("mnum.visible");
+    if (pugi::xml_attribute attribute = element.attribute("mnum.visible")) {
+        this->SetMnumVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3744,19 +3744,19 @@ void AttMediabounds::ResetMediabounds()
 bool AttMediabounds::ReadMediabounds(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        element.remove_attribute("begin");
+    if (pugi::xml_attribute attribute = element.attribute("begin")) {
+        this->SetBegin(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        element.remove_attribute("end");
+    if (pugi::xml_attribute attribute = element.attribute("end")) {
+        this->SetEnd(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        element.remove_attribute("betype");
+    if (pugi::xml_attribute attribute = element.attribute("betype")) {
+        this->SetBetype(StrToBetype(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3818,9 +3818,9 @@ void AttMedium::ResetMedium()
 bool AttMedium::ReadMedium(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        element.remove_attribute("medium");
+    if (pugi::xml_attribute attribute = element.attribute("medium")) {
+        this->SetMedium(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3864,9 +3864,9 @@ void AttMeiversion::ResetMeiversion()
 bool AttMeiversion::ReadMeiversion(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiversionMeiversion(element.attribute("meiversion").value()));
-        element.remove_attribute("meiversion");
+    if (pugi::xml_attribute attribute = element.attribute("meiversion")) {
+        this->SetMeiversion(StrToMeiversionMeiversion(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3911,14 +3911,14 @@ void AttMensurLog::ResetMensurLog()
 bool AttMensurLog::ReadMensurLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        element.remove_attribute("dot");
+    if (pugi::xml_attribute attribute = element.attribute("dot")) {
+        this->SetDot(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        element.remove_attribute("sign");
+    if (pugi::xml_attribute attribute = element.attribute("sign")) {
+        this->SetSign(StrToMensurationsign(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3973,19 +3973,19 @@ void AttMeterSigLog::ResetMeterSigLog()
 bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        element.remove_attribute("count");
+    if (pugi::xml_attribute attribute = element.attribute("count")) {
+        this->SetCount(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        element.remove_attribute("sym");
+    if (pugi::xml_attribute attribute = element.attribute("sym")) {
+        this->SetSym(StrToMetersign(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    if (pugi::xml_attribute attribute = element.attribute("unit")) {
+        this->SetUnit(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4047,9 +4047,9 @@ void AttMeterSigVis::ResetMeterSigVis()
 bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterSigVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToMeterSigVisForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4094,14 +4094,14 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
 bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToInt(element.attribute("meter.count").value()));
-        element.remove_attribute("meter.count");
+    if (pugi::xml_attribute attribute = element.attribute("meter.count")) {
+        this->SetMeterCount(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        element.remove_attribute("meter.unit");
+    if (pugi::xml_attribute attribute = element.attribute("meter.unit")) {
+        this->SetMeterUnit(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4156,19 +4156,19 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
 bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.rend")) {
-        this->SetMeterRend(StrToMeterSigDefaultVisMeterrend(element.attribute("meter.rend").value()));
-        element.remove_attribute("meter.rend");
+    if (pugi::xml_attribute attribute = element.attribute("meter.rend")) {
+        this->SetMeterRend(StrToMeterSigDefaultVisMeterrend(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        element.remove_attribute("meter.showchange");
+    if (pugi::xml_attribute attribute = element.attribute("meter.showchange")) {
+        this->SetMeterShowchange(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        element.remove_attribute("meter.sym");
+    if (pugi::xml_attribute attribute = element.attribute("meter.sym")) {
+        this->SetMeterSym(StrToMetersign(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4230,9 +4230,9 @@ void AttMeterconformance::ResetMeterconformance()
 bool AttMeterconformance::ReadMeterconformance(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterconformanceMetcon(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    if (pugi::xml_attribute attribute = element.attribute("metcon")) {
+        this->SetMetcon(StrToMeterconformanceMetcon(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4277,14 +4277,14 @@ void AttMeterconformanceBar::ResetMeterconformanceBar()
 bool AttMeterconformanceBar::ReadMeterconformanceBar(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    if (pugi::xml_attribute attribute = element.attribute("metcon")) {
+        this->SetMetcon(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        element.remove_attribute("control");
+    if (pugi::xml_attribute attribute = element.attribute("control")) {
+        this->SetControl(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4339,19 +4339,19 @@ void AttMmtempo::ResetMmtempo()
 bool AttMmtempo::ReadMmtempo(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToStr(element.attribute("mm").value()));
-        element.remove_attribute("mm");
+    if (pugi::xml_attribute attribute = element.attribute("mm")) {
+        this->SetMm(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        element.remove_attribute("mm.unit");
+    if (pugi::xml_attribute attribute = element.attribute("mm.unit")) {
+        this->SetMmUnit(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        element.remove_attribute("mm.dots");
+    if (pugi::xml_attribute attribute = element.attribute("mm.dots")) {
+        this->SetMmDots(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4413,9 +4413,9 @@ void AttMultinummeasures::ResetMultinummeasures()
 bool AttMultinummeasures::ReadMultinummeasures(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        element.remove_attribute("multi.number");
+    if (pugi::xml_attribute attribute = element.attribute("multi.number")) {
+        this->SetMultiNumber(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4460,14 +4460,14 @@ void AttName::ResetName()
 bool AttName::ReadName(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        element.remove_attribute("nymref");
+    if (pugi::xml_attribute attribute = element.attribute("nymref")) {
+        this->SetNymref(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        element.remove_attribute("role");
+    if (pugi::xml_attribute attribute = element.attribute("role")) {
+        this->SetRole(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4521,14 +4521,14 @@ void AttNotationstyle::ResetNotationstyle()
 bool AttNotationstyle::ReadNotationstyle(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        element.remove_attribute("music.name");
+    if (pugi::xml_attribute attribute = element.attribute("music.name")) {
+        this->SetMusicName(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToInt(element.attribute("music.size").value()));
-        element.remove_attribute("music.size");
+    if (pugi::xml_attribute attribute = element.attribute("music.size")) {
+        this->SetMusicSize(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4583,19 +4583,19 @@ void AttNoteGes::ResetNoteGes()
 bool AttNoteGes::ReadNoteGes(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToInt(element.attribute("oct.ges").value()));
-        element.remove_attribute("oct.ges");
+    if (pugi::xml_attribute attribute = element.attribute("oct.ges")) {
+        this->SetOctGes(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        element.remove_attribute("pname.ges");
+    if (pugi::xml_attribute attribute = element.attribute("pname.ges")) {
+        this->SetPnameGes(StrToPitchname(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        element.remove_attribute("pnum");
+    if (pugi::xml_attribute attribute = element.attribute("pnum")) {
+        this->SetPnum(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4663,39 +4663,39 @@ void AttNoteheads::ResetNoteheads()
 bool AttNoteheads::ReadNoteheads(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        element.remove_attribute("head.color");
+    if (pugi::xml_attribute attribute = element.attribute("head.color")) {
+        this->SetHeadColor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        element.remove_attribute("head.fill");
+    if (pugi::xml_attribute attribute = element.attribute("head.fill")) {
+        this->SetHeadFill(StrToFill(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        element.remove_attribute("head.fillcolor");
+    if (pugi::xml_attribute attribute = element.attribute("head.fillcolor")) {
+        this->SetHeadFillcolor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToStr(element.attribute("head.mod").value()));
-        element.remove_attribute("head.mod");
+    if (pugi::xml_attribute attribute = element.attribute("head.mod")) {
+        this->SetHeadMod(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToStr(element.attribute("head.rotation").value()));
-        element.remove_attribute("head.rotation");
+    if (pugi::xml_attribute attribute = element.attribute("head.rotation")) {
+        this->SetHeadRotation(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshapeList(element.attribute("head.shape").value()));
-        element.remove_attribute("head.shape");
+    if (pugi::xml_attribute attribute = element.attribute("head.shape")) {
+        this->SetHeadShape(StrToHeadshapeList(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        element.remove_attribute("head.visible");
+    if (pugi::xml_attribute attribute = element.attribute("head.visible")) {
+        this->SetHeadVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4793,9 +4793,9 @@ void AttOctave::ResetOctave()
 bool AttOctave::ReadOctave(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToInt(element.attribute("oct").value()));
-        element.remove_attribute("oct");
+    if (pugi::xml_attribute attribute = element.attribute("oct")) {
+        this->SetOct(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4839,9 +4839,9 @@ void AttOctavedefault::ResetOctavedefault()
 bool AttOctavedefault::ReadOctavedefault(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("octave.default")) {
-        this->SetOctaveDefault(StrToInt(element.attribute("octave.default").value()));
-        element.remove_attribute("octave.default");
+    if (pugi::xml_attribute attribute = element.attribute("octave.default")) {
+        this->SetOctaveDefault(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4886,14 +4886,14 @@ void AttOctavedisplacement::ResetOctavedisplacement()
 bool AttOctavedisplacement::ReadOctavedisplacement(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        element.remove_attribute("dis");
+    if (pugi::xml_attribute attribute = element.attribute("dis")) {
+        this->SetDis(StrToOctaveDis(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToPlace(element.attribute("dis.place").value()));
-        element.remove_attribute("dis.place");
+    if (pugi::xml_attribute attribute = element.attribute("dis.place")) {
+        this->SetDisPlace(StrToPlace(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4946,9 +4946,9 @@ void AttOnelinestaff::ResetOnelinestaff()
 bool AttOnelinestaff::ReadOnelinestaff(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        element.remove_attribute("ontheline");
+    if (pugi::xml_attribute attribute = element.attribute("ontheline")) {
+        this->SetOntheline(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4992,9 +4992,9 @@ void AttOptimization::ResetOptimization()
 bool AttOptimization::ReadOptimization(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        element.remove_attribute("optimize");
+    if (pugi::xml_attribute attribute = element.attribute("optimize")) {
+        this->SetOptimize(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5038,9 +5038,9 @@ void AttOriginLayerident::ResetOriginLayerident()
 bool AttOriginLayerident::ReadOriginLayerident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        element.remove_attribute("origin.layer");
+    if (pugi::xml_attribute attribute = element.attribute("origin.layer")) {
+        this->SetOriginLayer(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5084,9 +5084,9 @@ void AttOriginStaffident::ResetOriginStaffident()
 bool AttOriginStaffident::ReadOriginStaffident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        element.remove_attribute("origin.staff");
+    if (pugi::xml_attribute attribute = element.attribute("origin.staff")) {
+        this->SetOriginStaff(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5131,14 +5131,14 @@ void AttOriginStartendid::ResetOriginStartendid()
 bool AttOriginStartendid::ReadOriginStartendid(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        element.remove_attribute("origin.startid");
+    if (pugi::xml_attribute attribute = element.attribute("origin.startid")) {
+        this->SetOriginStartid(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        element.remove_attribute("origin.endid");
+    if (pugi::xml_attribute attribute = element.attribute("origin.endid")) {
+        this->SetOriginEndid(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5192,14 +5192,14 @@ void AttOriginTimestampMusical::ResetOriginTimestampMusical()
 bool AttOriginTimestampMusical::ReadOriginTimestampMusical(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        element.remove_attribute("origin.tstamp");
+    if (pugi::xml_attribute attribute = element.attribute("origin.tstamp")) {
+        this->SetOriginTstamp(StrToMeasurebeat(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        element.remove_attribute("origin.tstamp2");
+    if (pugi::xml_attribute attribute = element.attribute("origin.tstamp2")) {
+        this->SetOriginTstamp2(StrToMeasurebeat(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5252,9 +5252,9 @@ void AttPadLog::ResetPadLog()
 bool AttPadLog::ReadPadLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5305,44 +5305,44 @@ void AttPages::ResetPages()
 bool AttPages::ReadPages(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToStr(element.attribute("page.height").value()));
-        element.remove_attribute("page.height");
+    if (pugi::xml_attribute attribute = element.attribute("page.height")) {
+        this->SetPageHeight(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToStr(element.attribute("page.width").value()));
-        element.remove_attribute("page.width");
+    if (pugi::xml_attribute attribute = element.attribute("page.width")) {
+        this->SetPageWidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToStr(element.attribute("page.topmar").value()));
-        element.remove_attribute("page.topmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.topmar")) {
+        this->SetPageTopmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToStr(element.attribute("page.botmar").value()));
-        element.remove_attribute("page.botmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.botmar")) {
+        this->SetPageBotmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToStr(element.attribute("page.leftmar").value()));
-        element.remove_attribute("page.leftmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.leftmar")) {
+        this->SetPageLeftmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToStr(element.attribute("page.rightmar").value()));
-        element.remove_attribute("page.rightmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.rightmar")) {
+        this->SetPageRightmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        element.remove_attribute("page.panels");
+    if (pugi::xml_attribute attribute = element.attribute("page.panels")) {
+        this->SetPagePanels(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        element.remove_attribute("page.scale");
+    if (pugi::xml_attribute attribute = element.attribute("page.scale")) {
+        this->SetPageScale(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5449,9 +5449,9 @@ void AttPbVis::ResetPbVis()
 bool AttPbVis::ReadPbVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        element.remove_attribute("folium");
+    if (pugi::xml_attribute attribute = element.attribute("folium")) {
+        this->SetFolium(StrToPbVisFolium(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5495,9 +5495,9 @@ void AttPitch::ResetPitch()
 bool AttPitch::ReadPitch(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        element.remove_attribute("pname");
+    if (pugi::xml_attribute attribute = element.attribute("pname")) {
+        this->SetPname(StrToPitchname(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5541,9 +5541,9 @@ void AttPlacement::ResetPlacement()
 bool AttPlacement::ReadPlacement(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToStaffrel(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5587,9 +5587,9 @@ void AttPlist::ResetPlist()
 bool AttPlist::ReadPlist(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToStr(element.attribute("plist").value()));
-        element.remove_attribute("plist");
+    if (pugi::xml_attribute attribute = element.attribute("plist")) {
+        this->SetPlist(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5637,29 +5637,29 @@ void AttPointing::ResetPointing()
 bool AttPointing::ReadPointing(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        element.remove_attribute("xlink:actuate");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:actuate")) {
+        this->SetActuate(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        element.remove_attribute("xlink:role");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:role")) {
+        this->SetRole(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        element.remove_attribute("xlink:show");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:show")) {
+        this->SetShow(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:target")) {
-        this->SetTarget(StrToStr(element.attribute("xlink:target").value()));
-        element.remove_attribute("xlink:target");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:target")) {
+        this->SetTarget(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("xlink:targettype").value()));
-        element.remove_attribute("xlink:targettype");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:targettype")) {
+        this->SetTargettype(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5739,9 +5739,9 @@ void AttQuantity::ResetQuantity()
 bool AttQuantity::ReadQuantity(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        element.remove_attribute("quantity");
+    if (pugi::xml_attribute attribute = element.attribute("quantity")) {
+        this->SetQuantity(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5785,9 +5785,9 @@ void AttRelativesize::ResetRelativesize()
 bool AttRelativesize::ReadRelativesize(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("size")) {
-        this->SetSize(StrToSize(element.attribute("size").value()));
-        element.remove_attribute("size");
+    if (pugi::xml_attribute attribute = element.attribute("size")) {
+        this->SetSize(StrToSize(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5831,9 +5831,9 @@ void AttResponsibility::ResetResponsibility()
 bool AttResponsibility::ReadResponsibility(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        element.remove_attribute("resp");
+    if (pugi::xml_attribute attribute = element.attribute("resp")) {
+        this->SetResp(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5877,9 +5877,9 @@ void AttSbVis::ResetSbVis()
 bool AttSbVis::ReadSbVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToSbVisForm(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5923,9 +5923,9 @@ void AttScalable::ResetScalable()
 bool AttScalable::ReadScalable(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        element.remove_attribute("scale");
+    if (pugi::xml_attribute attribute = element.attribute("scale")) {
+        this->SetScale(StrToPercent(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5971,19 +5971,19 @@ void AttScoreDefGes::ResetScoreDefGes()
 bool AttScoreDefGes::ReadScoreDefGes(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        element.remove_attribute("tune.pname");
+    if (pugi::xml_attribute attribute = element.attribute("tune.pname")) {
+        this->SetTunePname(StrToPitchname(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        element.remove_attribute("tune.Hz");
+    if (pugi::xml_attribute attribute = element.attribute("tune.Hz")) {
+        this->SetTuneHz(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        element.remove_attribute("tune.temper");
+    if (pugi::xml_attribute attribute = element.attribute("tune.temper")) {
+        this->SetTuneTemper(StrToTemperament(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6045,9 +6045,9 @@ void AttScoreDefVis::ResetScoreDefVis()
 bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        element.remove_attribute("vu.height");
+    if (pugi::xml_attribute attribute = element.attribute("vu.height")) {
+        this->SetVuHeight(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6091,9 +6091,9 @@ void AttSectionVis::ResetSectionVis()
 bool AttSectionVis::ReadSectionVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        element.remove_attribute("restart");
+    if (pugi::xml_attribute attribute = element.attribute("restart")) {
+        this->SetRestart(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6137,9 +6137,9 @@ void AttSequence::ResetSequence()
 bool AttSequence::ReadSequence(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        element.remove_attribute("seq");
+    if (pugi::xml_attribute attribute = element.attribute("seq")) {
+        this->SetSeq(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6183,9 +6183,9 @@ void AttSlashcount::ResetSlashcount()
 bool AttSlashcount::ReadSlashcount(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    if (pugi::xml_attribute attribute = element.attribute("slash")) {
+        this->SetSlash(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6229,9 +6229,9 @@ void AttSlurpresent::ResetSlurpresent()
 bool AttSlurpresent::ReadSlurpresent(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        element.remove_attribute("slur");
+    if (pugi::xml_attribute attribute = element.attribute("slur")) {
+        this->SetSlur(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6275,9 +6275,9 @@ void AttSpaceVis::ResetSpaceVis()
 bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        element.remove_attribute("compressable");
+    if (pugi::xml_attribute attribute = element.attribute("compressable")) {
+        this->SetCompressable(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6324,24 +6324,24 @@ void AttSpacing::ResetSpacing()
 bool AttSpacing::ReadSpacing(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        element.remove_attribute("spacing.packexp");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.packexp")) {
+        this->SetSpacingPackexp(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        element.remove_attribute("spacing.packfact");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.packfact")) {
+        this->SetSpacingPackfact(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToStr(element.attribute("spacing.staff").value()));
-        element.remove_attribute("spacing.staff");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.staff")) {
+        this->SetSpacingStaff(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToStr(element.attribute("spacing.system").value()));
-        element.remove_attribute("spacing.system");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.system")) {
+        this->SetSpacingSystem(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6412,9 +6412,9 @@ void AttStaffLog::ResetStaffLog()
 bool AttStaffLog::ReadStaffLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    if (pugi::xml_attribute attribute = element.attribute("def")) {
+        this->SetDef(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6463,34 +6463,34 @@ void AttStaffDefVis::ResetStaffDefVis()
 bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    if (pugi::xml_attribute attribute = element.attribute("grid.show")) {
+        this->SetGridShow(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        element.remove_attribute("layerscheme");
+    if (pugi::xml_attribute attribute = element.attribute("layerscheme")) {
+        this->SetLayerscheme(StrToLayerscheme(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        element.remove_attribute("lines");
+    if (pugi::xml_attribute attribute = element.attribute("lines")) {
+        this->SetLines(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        element.remove_attribute("lines.color");
+    if (pugi::xml_attribute attribute = element.attribute("lines.color")) {
+        this->SetLinesColor(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        element.remove_attribute("lines.visible");
+    if (pugi::xml_attribute attribute = element.attribute("lines.visible")) {
+        this->SetLinesVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToStr(element.attribute("spacing").value()));
-        element.remove_attribute("spacing");
+    if (pugi::xml_attribute attribute = element.attribute("spacing")) {
+        this->SetSpacing(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6579,9 +6579,9 @@ void AttStaffGrpVis::ResetStaffGrpVis()
 bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("barthru")) {
-        this->SetBarthru(StrToBoolean(element.attribute("barthru").value()));
-        element.remove_attribute("barthru");
+    if (pugi::xml_attribute attribute = element.attribute("barthru")) {
+        this->SetBarthru(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6625,9 +6625,9 @@ void AttStaffgroupingsym::ResetStaffgroupingsym()
 bool AttStaffgroupingsym::ReadStaffgroupingsym(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffgroupingsymSymbol(element.attribute("symbol").value()));
-        element.remove_attribute("symbol");
+    if (pugi::xml_attribute attribute = element.attribute("symbol")) {
+        this->SetSymbol(StrToStaffgroupingsymSymbol(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6671,9 +6671,9 @@ void AttStaffident::ResetStaffident()
 bool AttStaffident::ReadStaffident(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        element.remove_attribute("staff");
+    if (pugi::xml_attribute attribute = element.attribute("staff")) {
+        this->SetStaff(StrToXsdPositiveIntegerList(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6717,9 +6717,9 @@ void AttStaffloc::ResetStaffloc()
 bool AttStaffloc::ReadStaffloc(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        element.remove_attribute("loc");
+    if (pugi::xml_attribute attribute = element.attribute("loc")) {
+        this->SetLoc(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6764,14 +6764,14 @@ void AttStafflocPitched::ResetStafflocPitched()
 bool AttStafflocPitched::ReadStafflocPitched(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        element.remove_attribute("ploc");
+    if (pugi::xml_attribute attribute = element.attribute("ploc")) {
+        this->SetPloc(StrToPitchname(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToInt(element.attribute("oloc").value()));
-        element.remove_attribute("oloc");
+    if (pugi::xml_attribute attribute = element.attribute("oloc")) {
+        this->SetOloc(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6824,9 +6824,9 @@ void AttStartendid::ResetStartendid()
 bool AttStartendid::ReadStartendid(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        element.remove_attribute("endid");
+    if (pugi::xml_attribute attribute = element.attribute("endid")) {
+        this->SetEndid(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6870,9 +6870,9 @@ void AttStartid::ResetStartid()
 bool AttStartid::ReadStartid(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        element.remove_attribute("startid");
+    if (pugi::xml_attribute attribute = element.attribute("startid")) {
+        this->SetStartid(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6921,34 +6921,34 @@ void AttStems::ResetStems()
 bool AttStems::ReadStems(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        element.remove_attribute("stem.dir");
+    if (pugi::xml_attribute attribute = element.attribute("stem.dir")) {
+        this->SetStemDir(StrToStemdirection(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToInt(element.attribute("stem.len").value()));
-        element.remove_attribute("stem.len");
+    if (pugi::xml_attribute attribute = element.attribute("stem.len")) {
+        this->SetStemLen(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        element.remove_attribute("stem.mod");
+    if (pugi::xml_attribute attribute = element.attribute("stem.mod")) {
+        this->SetStemMod(StrToStemmodifier(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        element.remove_attribute("stem.pos");
+    if (pugi::xml_attribute attribute = element.attribute("stem.pos")) {
+        this->SetStemPos(StrToStemposition(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        element.remove_attribute("stem.x");
+    if (pugi::xml_attribute attribute = element.attribute("stem.x")) {
+        this->SetStemX(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        element.remove_attribute("stem.y");
+    if (pugi::xml_attribute attribute = element.attribute("stem.y")) {
+        this->SetStemY(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7038,14 +7038,14 @@ void AttSylLog::ResetSylLog()
 bool AttSylLog::ReadSylLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        element.remove_attribute("con");
+    if (pugi::xml_attribute attribute = element.attribute("con")) {
+        this->SetCon(StrToSylLogCon(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        element.remove_attribute("wordpos");
+    if (pugi::xml_attribute attribute = element.attribute("wordpos")) {
+        this->SetWordpos(StrToSylLogWordpos(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7098,9 +7098,9 @@ void AttSyltext::ResetSyltext()
 bool AttSyltext::ReadSyltext(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        element.remove_attribute("syl");
+    if (pugi::xml_attribute attribute = element.attribute("syl")) {
+        this->SetSyl(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7147,24 +7147,24 @@ void AttSystems::ResetSystems()
 bool AttSystems::ReadSystems(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        element.remove_attribute("system.leftline");
+    if (pugi::xml_attribute attribute = element.attribute("system.leftline")) {
+        this->SetSystemLeftline(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToStr(element.attribute("system.leftmar").value()));
-        element.remove_attribute("system.leftmar");
+    if (pugi::xml_attribute attribute = element.attribute("system.leftmar")) {
+        this->SetSystemLeftmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToStr(element.attribute("system.rightmar").value()));
-        element.remove_attribute("system.rightmar");
+    if (pugi::xml_attribute attribute = element.attribute("system.rightmar")) {
+        this->SetSystemRightmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToStr(element.attribute("system.topmar").value()));
-        element.remove_attribute("system.topmar");
+    if (pugi::xml_attribute attribute = element.attribute("system.topmar")) {
+        this->SetSystemTopmar(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7235,9 +7235,9 @@ void AttTargeteval::ResetTargeteval()
 bool AttTargeteval::ReadTargeteval(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetevalEvaluate(element.attribute("evaluate").value()));
-        element.remove_attribute("evaluate");
+    if (pugi::xml_attribute attribute = element.attribute("evaluate")) {
+        this->SetEvaluate(StrToTargetevalEvaluate(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7281,9 +7281,9 @@ void AttTempoLog::ResetTempoLog()
 bool AttTempoLog::ReadTempoLog(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToTempoLogFunc(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7331,29 +7331,29 @@ void AttTextstyle::ResetTextstyle()
 bool AttTextstyle::ReadTextstyle(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        element.remove_attribute("text.fam");
+    if (pugi::xml_attribute attribute = element.attribute("text.fam")) {
+        this->SetTextFam(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        element.remove_attribute("text.name");
+    if (pugi::xml_attribute attribute = element.attribute("text.name")) {
+        this->SetTextName(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToInt(element.attribute("text.size").value()));
-        element.remove_attribute("text.size");
+    if (pugi::xml_attribute attribute = element.attribute("text.size")) {
+        this->SetTextSize(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        element.remove_attribute("text.style");
+    if (pugi::xml_attribute attribute = element.attribute("text.style")) {
+        this->SetTextStyle(StrToFontstyle(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        element.remove_attribute("text.weight");
+    if (pugi::xml_attribute attribute = element.attribute("text.weight")) {
+        this->SetTextWeight(StrToFontweight(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7433,9 +7433,9 @@ void AttTiepresent::ResetTiepresent()
 bool AttTiepresent::ReadTiepresent(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        element.remove_attribute("tie");
+    if (pugi::xml_attribute attribute = element.attribute("tie")) {
+        this->SetTie(StrToTie(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7479,9 +7479,9 @@ void AttTimestampMusical::ResetTimestampMusical()
 bool AttTimestampMusical::ReadTimestampMusical(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        element.remove_attribute("tstamp");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp")) {
+        this->SetTstamp(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7526,14 +7526,14 @@ void AttTimestampPerformed::ResetTimestampPerformed()
 bool AttTimestampPerformed::ReadTimestampPerformed(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDuration(element.attribute("tstamp.ges").value()));
-        element.remove_attribute("tstamp.ges");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp.ges")) {
+        this->SetTstampGes(StrToDuration(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        element.remove_attribute("tstamp.real");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp.real")) {
+        this->SetTstampReal(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7586,9 +7586,9 @@ void AttTimestamp2Musical::ResetTimestamp2Musical()
 bool AttTimestamp2Musical::ReadTimestamp2Musical(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        element.remove_attribute("tstamp2");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp2")) {
+        this->SetTstamp2(StrToMeasurebeat(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7633,14 +7633,14 @@ void AttTransposition::ResetTransposition()
 bool AttTransposition::ReadTransposition(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToDbl(element.attribute("trans.diat").value()));
-        element.remove_attribute("trans.diat");
+    if (pugi::xml_attribute attribute = element.attribute("trans.diat")) {
+        this->SetTransDiat(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToDbl(element.attribute("trans.semi").value()));
-        element.remove_attribute("trans.semi");
+    if (pugi::xml_attribute attribute = element.attribute("trans.semi")) {
+        this->SetTransSemi(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7693,9 +7693,9 @@ void AttTupletpresent::ResetTupletpresent()
 bool AttTupletpresent::ReadTupletpresent(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        element.remove_attribute("tuplet");
+    if (pugi::xml_attribute attribute = element.attribute("tuplet")) {
+        this->SetTuplet(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7740,14 +7740,14 @@ void AttTyped::ResetTyped()
 bool AttTyped::ReadTyped(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        element.remove_attribute("type");
+    if (pugi::xml_attribute attribute = element.attribute("type")) {
+        this->SetType(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("subtype")) {
-        this->SetSubtype(StrToStr(element.attribute("subtype").value()));
-        element.remove_attribute("subtype");
+    if (pugi::xml_attribute attribute = element.attribute("subtype")) {
+        this->SetSubtype(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7804,29 +7804,29 @@ void AttTypography::ResetTypography()
 bool AttTypography::ReadTypography(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        element.remove_attribute("fontfam");
+    if (pugi::xml_attribute attribute = element.attribute("fontfam")) {
+        this->SetFontfam(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        element.remove_attribute("fontname");
+    if (pugi::xml_attribute attribute = element.attribute("fontname")) {
+        this->SetFontname(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToInt(element.attribute("fontsize").value()));
-        element.remove_attribute("fontsize");
+    if (pugi::xml_attribute attribute = element.attribute("fontsize")) {
+        this->SetFontsize(StrToInt(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        element.remove_attribute("fontstyle");
+    if (pugi::xml_attribute attribute = element.attribute("fontstyle")) {
+        this->SetFontstyle(StrToFontstyle(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        element.remove_attribute("fontweight");
+    if (pugi::xml_attribute attribute = element.attribute("fontweight")) {
+        this->SetFontweight(StrToFontweight(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7906,9 +7906,9 @@ void AttVisibility::ResetVisibility()
 bool AttVisibility::ReadVisibility(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        element.remove_attribute("visible");
+    if (pugi::xml_attribute attribute = element.attribute("visible")) {
+        this->SetVisible(StrToBoolean(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7952,9 +7952,9 @@ void AttVisualoffsetHo::ResetVisualoffsetHo()
 bool AttVisualoffsetHo::ReadVisualoffsetHo(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToStr(element.attribute("ho").value()));
-        element.remove_attribute("ho");
+    if (pugi::xml_attribute attribute = element.attribute("ho")) {
+        this->SetHo(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7998,9 +7998,9 @@ void AttVisualoffsetTo::ResetVisualoffsetTo()
 bool AttVisualoffsetTo::ReadVisualoffsetTo(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        element.remove_attribute("to");
+    if (pugi::xml_attribute attribute = element.attribute("to")) {
+        this->SetTo(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8044,9 +8044,9 @@ void AttVisualoffsetVo::ResetVisualoffsetVo()
 bool AttVisualoffsetVo::ReadVisualoffsetVo(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToStr(element.attribute("vo").value()));
-        element.remove_attribute("vo");
+    if (pugi::xml_attribute attribute = element.attribute("vo")) {
+        this->SetVo(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8091,14 +8091,14 @@ void AttVisualoffset2Ho::ResetVisualoffset2Ho()
 bool AttVisualoffset2Ho::ReadVisualoffset2Ho(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToStr(element.attribute("startho").value()));
-        element.remove_attribute("startho");
+    if (pugi::xml_attribute attribute = element.attribute("startho")) {
+        this->SetStartho(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToStr(element.attribute("endho").value()));
-        element.remove_attribute("endho");
+    if (pugi::xml_attribute attribute = element.attribute("endho")) {
+        this->SetEndho(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8152,14 +8152,14 @@ void AttVisualoffset2To::ResetVisualoffset2To()
 bool AttVisualoffset2To::ReadVisualoffset2To(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        element.remove_attribute("startto");
+    if (pugi::xml_attribute attribute = element.attribute("startto")) {
+        this->SetStartto(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        element.remove_attribute("endto");
+    if (pugi::xml_attribute attribute = element.attribute("endto")) {
+        this->SetEndto(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8213,14 +8213,14 @@ void AttVisualoffset2Vo::ResetVisualoffset2Vo()
 bool AttVisualoffset2Vo::ReadVisualoffset2Vo(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToStr(element.attribute("startvo").value()));
-        element.remove_attribute("startvo");
+    if (pugi::xml_attribute attribute = element.attribute("startvo")) {
+        this->SetStartvo(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToStr(element.attribute("endvo").value()));
-        element.remove_attribute("endvo");
+    if (pugi::xml_attribute attribute = element.attribute("endvo")) {
+        this->SetEndvo(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8273,9 +8273,9 @@ void AttWhitespace::ResetWhitespace()
 bool AttWhitespace::ReadWhitespace(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        element.remove_attribute("xml:space");
+    if (pugi::xml_attribute attribute = element.attribute("xml:space")) {
+        this->SetSpace(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8319,9 +8319,9 @@ void AttWidth::ResetWidth()
 bool AttWidth::ReadWidth(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToStr(element.attribute("width").value()));
-        element.remove_attribute("width");
+    if (pugi::xml_attribute attribute = element.attribute("width")) {
+        this->SetWidth(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8366,14 +8366,14 @@ void AttXy::ResetXy()
 bool AttXy::ReadXy(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        element.remove_attribute("x");
+    if (pugi::xml_attribute attribute = element.attribute("x")) {
+        this->SetX(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        element.remove_attribute("y");
+    if (pugi::xml_attribute attribute = element.attribute("y")) {
+        this->SetY(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8427,14 +8427,14 @@ void AttXy2::ResetXy2()
 bool AttXy2::ReadXy2(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        element.remove_attribute("x2");
+    if (pugi::xml_attribute attribute = element.attribute("x2")) {
+        this->SetX2(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        element.remove_attribute("y2");
+    if (pugi::xml_attribute attribute = element.attribute("y2")) {
+        this->SetY2(StrToDbl(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -48,14 +48,14 @@ void AttNoteGesTablature::ResetNoteGesTablature()
 bool AttNoteGesTablature::ReadNoteGesTablature(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.fret")) {
-        this->SetTabFret(StrToFretnumber(element.attribute("tab.fret").value()));
-        element.remove_attribute("tab.fret");
+    if (pugi::xml_attribute attribute = element.attribute("tab.fret")) {
+        this->SetTabFret(StrToFretnumber(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tab.string")) {
-        this->SetTabString(StrToStringnumber(element.attribute("tab.string").value()));
-        element.remove_attribute("tab.string");
+    if (pugi::xml_attribute attribute = element.attribute("tab.string")) {
+        this->SetTabString(StrToStringnumber(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -108,9 +108,9 @@ void AttStaffDefGesTablature::ResetStaffDefGesTablature()
 bool AttStaffDefGesTablature::ReadStaffDefGesTablature(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.strings")) {
-        this->SetTabStrings(StrToStr(element.attribute("tab.strings").value()));
-        element.remove_attribute("tab.strings");
+    if (pugi::xml_attribute attribute = element.attribute("tab.strings")) {
+        this->SetTabStrings(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -47,9 +47,9 @@ void AttAltsym::ResetAltsym()
 bool AttAltsym::ReadAltsym(pugi::xml_node element)
 {
     bool hasAttribute = false;
-    if (element.attribute("altsym")) {
-        this->SetAltsym(StrToStr(element.attribute("altsym").value()));
-        element.remove_attribute("altsym");
+    if (pugi::xml_attribute attribute = element.attribute("altsym")) {
+        this->SetAltsym(StrToStr(attribute.value()));
+        element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -58,7 +58,7 @@ void Artic::Reset()
 void Artic::AddChild(Object *child)
 {
     if (child->Is(ARTIC_PART)) {
-        assert(dynamic_cast<ArticPart *>(child));
+        assert(vrv_cast<ArticPart *>(child));
     }
     else {
         LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
@@ -67,6 +67,7 @@ void Artic::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -260,19 +261,19 @@ void ArticPart::AddSlurPositioner(FloatingPositioner *positioner, bool start)
 
 int Artic::CalcArtic(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     /************** Get the parent and the stem direction **************/
 
     LayerElement *parent = NULL;
     Note *parentNote = NULL;
-    Chord *parentChord = dynamic_cast<Chord *>(this->GetFirstParent(CHORD, 2));
+    Chord *parentChord = vrv_cast<Chord *>(this->GetFirstParent(CHORD, 2));
     data_STEMDIRECTION stemDir = STEMDIRECTION_NONE;
     data_STAFFREL place = STAFFREL_NONE;
 
     if (!parentChord) {
-        parentNote = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        parentNote = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         parent = parentNote;
     }
     else {
@@ -284,9 +285,9 @@ int Artic::CalcArtic(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
 
     stemDir = parentNote ? parentNote->GetDrawingStemDir() : parentChord->GetDrawingStemDir();
@@ -445,7 +446,7 @@ int ArticPart::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int ArticPart::AdjustArticWithSlurs(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     if (m_startSlurPositioners.empty() && m_endSlurPositioners.empty()) return FUNCTOR_CONTINUE;
@@ -11,6 +11,7 @@
 
 #include <sstream>
 #include <stdlib.h>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -136,13 +137,17 @@ std::string Att::BeatrptRendToStr(data_BEATRPT_REND data) const
 
 data_BEATRPT_REND Att::StrToBeatrptRend(std::string value) const
 {
-    if (value == "4") return BEATRPT_REND_4;
-    if (value == "8") return BEATRPT_REND_8;
-    if (value == "16") return BEATRPT_REND_16;
-    if (value == "32") return BEATRPT_REND_32;
-    if (value == "64") return BEATRPT_REND_64;
-    if (value == "128") return BEATRPT_REND_128;
-    if (value == "mixed") return BEATRPT_REND_mixed;
+    static const std::unordered_map<std::string, data_BEATRPT_REND> values = {
+        { "4", BEATRPT_REND_4 },
+        { "8", BEATRPT_REND_8 },
+        { "16", BEATRPT_REND_16 },
+        { "32", BEATRPT_REND_32 },
+        { "64", BEATRPT_REND_64 },
+        { "128", BEATRPT_REND_128 },
+        { "mixed", BEATRPT_REND_mixed },
+    };
+    std::unordered_map<std::string, data_BEATRPT_REND>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported beatrpt rend '%s'", value.c_str());
     return BEATRPT_REND_NONE;
 }
@@ -180,25 +185,29 @@ std::string Att::DurationToStr(data_DURATION data) const
 
 data_DURATION Att::StrToDuration(std::string value) const
 {
-    if (value == "maxima") return DURATION_maxima;
-    if (value == "longa") return DURATION_longa;
-    if (value == "brevis") return DURATION_brevis;
-    if (value == "semibrevis") return DURATION_semibrevis;
-    if (value == "minima") return DURATION_minima;
-    if (value == "semiminima") return DURATION_semiminima;
-    if (value == "fusa") return DURATION_fusa;
-    if (value == "semifusa") return DURATION_semifusa;
-    if (value == "long") return DURATION_long;
-    if (value == "breve") return DURATION_breve;
-    if (value == "1") return DURATION_1;
-    if (value == "2") return DURATION_2;
-    if (value == "4") return DURATION_4;
-    if (value == "8") return DURATION_8;
-    if (value == "16") return DURATION_16;
-    if (value == "32") return DURATION_32;
-    if (value == "64") return DURATION_64;
-    if (value == "128") return DURATION_128;
-    if (value == "256") return DURATION_256;
+    static const std::unordered_map<std::string, data_DURATION> values = {
+        { "maxima", DURATION_maxima },
+        { "longa", DURATION_longa },
+        { "brevis", DURATION_brevis },
+        { "semibrevis", DURATION_semibrevis },
+        { "minima", DURATION_minima },
+        { "semiminima", DURATION_semiminima },
+        { "fusa", DURATION_fusa },
+        { "semifusa", DURATION_semifusa },
+        { "long", DURATION_long },
+        { "breve", DURATION_breve },
+        { "1", DURATION_1 },
+        { "2", DURATION_2 },
+        { "4", DURATION_4 },
+        { "8", DURATION_8 },
+        { "16", DURATION_16 },
+        { "32", DURATION_32 },
+        { "64", DURATION_64 },
+        { "128", DURATION_128 },
+        { "256", DURATION_256 },
+    };
+    std::unordered_map<std::string, data_DURATION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     if ((value.length() > 0) && (value[value.length() - 1] == 'p')) {
         // LogWarning("PPQ duration dur_s are not supported"); // remove it for now
     }
@@ -238,22 +247,26 @@ std::string Att::KeysignatureToStr(data_KEYSIGNATURE data) const
 
 data_KEYSIGNATURE Att::StrToKeysignature(std::string value) const
 {
-    if (value == "7f") return KEYSIGNATURE_7f;
-    if (value == "6f") return KEYSIGNATURE_6f;
-    if (value == "5f") return KEYSIGNATURE_5f;
-    if (value == "4f") return KEYSIGNATURE_4f;
-    if (value == "3f") return KEYSIGNATURE_3f;
-    if (value == "2f") return KEYSIGNATURE_2f;
-    if (value == "1f") return KEYSIGNATURE_1f;
-    if (value == "0") return KEYSIGNATURE_0;
-    if (value == "1s") return KEYSIGNATURE_1s;
-    if (value == "2s") return KEYSIGNATURE_2s;
-    if (value == "3s") return KEYSIGNATURE_3s;
-    if (value == "4s") return KEYSIGNATURE_4s;
-    if (value == "5s") return KEYSIGNATURE_5s;
-    if (value == "6s") return KEYSIGNATURE_6s;
-    if (value == "7s") return KEYSIGNATURE_7s;
-    if (value == "mixed") return KEYSIGNATURE_mixed;
+    static const std::unordered_map<std::string, data_KEYSIGNATURE> values = {
+        { "7f", KEYSIGNATURE_7f },
+        { "6f", KEYSIGNATURE_6f },
+        { "5f", KEYSIGNATURE_5f },
+        { "4f", KEYSIGNATURE_4f },
+        { "3f", KEYSIGNATURE_3f },
+        { "2f", KEYSIGNATURE_2f },
+        { "1f", KEYSIGNATURE_1f },
+        { "0", KEYSIGNATURE_0 },
+        { "1s", KEYSIGNATURE_1s },
+        { "2s", KEYSIGNATURE_2s },
+        { "3s", KEYSIGNATURE_3s },
+        { "4s", KEYSIGNATURE_4s },
+        { "5s", KEYSIGNATURE_5s },
+        { "6s", KEYSIGNATURE_6s },
+        { "7s", KEYSIGNATURE_7s },
+        { "mixed", KEYSIGNATURE_mixed },
+    };
+    std::unordered_map<std::string, data_KEYSIGNATURE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported key signature '%s'", value.c_str());
     return KEYSIGNATURE_NONE;
 }
@@ -301,8 +314,12 @@ std::string Att::ModusmaiorToStr(data_MODUSMAIOR data) const
 
 data_MODUSMAIOR Att::StrToModusmaior(std::string value) const
 {
-    if (value == "2") return MODUSMAIOR_2;
-    if (value == "3") return MODUSMAIOR_3;
+    static const std::unordered_map<std::string, data_MODUSMAIOR> values = {
+        { "2", MODUSMAIOR_2 },
+        { "3", MODUSMAIOR_3 },
+    };
+    std::unordered_map<std::string, data_MODUSMAIOR>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported modusmaior '%s'", value.c_str());
     return MODUSMAIOR_NONE;
 }
@@ -323,8 +340,12 @@ std::string Att::ModusminorToStr(data_MODUSMINOR data) const
 
 data_MODUSMINOR Att::StrToModusminor(std::string value) const
 {
-    if (value == "2") return MODUSMINOR_2;
-    if (value == "3") return MODUSMINOR_3;
+    static const std::unordered_map<std::string, data_MODUSMINOR> values = {
+        { "2", MODUSMINOR_2 },
+        { "3", MODUSMINOR_3 },
+    };
+    std::unordered_map<std::string, data_MODUSMINOR>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported modusmaior '%s'", value.c_str());
     return MODUSMINOR_NONE;
 }
@@ -360,13 +381,17 @@ std::string Att::PitchnameToStr(data_PITCHNAME data) const
 
 data_PITCHNAME Att::StrToPitchname(std::string value) const
 {
-    if (value == "c") return PITCHNAME_c;
-    if (value == "d") return PITCHNAME_d;
-    if (value == "e") return PITCHNAME_e;
-    if (value == "f") return PITCHNAME_f;
-    if (value == "g") return PITCHNAME_g;
-    if (value == "a") return PITCHNAME_a;
-    if (value == "b") return PITCHNAME_b;
+    static const std::unordered_map<std::string, data_PITCHNAME> values = {
+        { "c", PITCHNAME_c },
+        { "d", PITCHNAME_d },
+        { "e", PITCHNAME_e },
+        { "f", PITCHNAME_f },
+        { "g", PITCHNAME_g },
+        { "a", PITCHNAME_a },
+        { "b", PITCHNAME_b },
+    };
+    std::unordered_map<std::string, data_PITCHNAME>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported pitch name '%s'", value.c_str());
     return PITCHNAME_NONE;
 }
@@ -388,9 +413,13 @@ std::string Att::OctaveDisToStr(data_OCTAVE_DIS data) const
 
 data_OCTAVE_DIS Att::StrToOctaveDis(std::string value) const
 {
-    if (value == "8") return OCTAVE_DIS_8;
-    if (value == "15") return OCTAVE_DIS_15;
-    if (value == "22") return OCTAVE_DIS_22;
+    static const std::unordered_map<std::string, data_OCTAVE_DIS> values = {
+        { "8", OCTAVE_DIS_8 },
+        { "15", OCTAVE_DIS_15 },
+        { "22", OCTAVE_DIS_22 },
+    };
+    std::unordered_map<std::string, data_OCTAVE_DIS>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported octave dis '%s'", value.c_str());
     return OCTAVE_DIS_NONE;
 }
@@ -412,9 +441,13 @@ std::string Att::OrientationToStr(data_ORIENTATION data) const
 
 data_ORIENTATION Att::StrToOrientation(std::string value) const
 {
-    if (value == "reversed") return ORIENTATION_reversed;
-    if (value == "90CW") return ORIENTATION_90CW;
-    if (value == "90CCW") return ORIENTATION_90CCW;
+    static const std::unordered_map<std::string, data_ORIENTATION> values = {
+        { "reversed", ORIENTATION_reversed },
+        { "90CW", ORIENTATION_90CW },
+        { "90CCW", ORIENTATION_90CCW },
+    };
+    std::unordered_map<std::string, data_ORIENTATION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported orientation '%s'", value.c_str());
     return ORIENTATION_NONE;
 }
@@ -435,8 +468,12 @@ std::string Att::ProlatioToStr(data_PROLATIO data) const
 
 data_PROLATIO Att::StrToProlatio(std::string value) const
 {
-    if (value == "2") return PROLATIO_2;
-    if (value == "3") return PROLATIO_3;
+    static const std::unordered_map<std::string, data_PROLATIO> values = {
+        { "2", PROLATIO_2 },
+        { "3", PROLATIO_3 },
+    };
+    std::unordered_map<std::string, data_PROLATIO>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported prolatio '%s'", value.c_str());
     return PROLATIO_NONE;
 }
@@ -457,8 +494,12 @@ std::string Att::StemdirectionToStr(data_STEMDIRECTION data) const
 
 data_STEMDIRECTION Att::StrToStemdirection(std::string value) const
 {
-    if (value == "up") return STEMDIRECTION_up;
-    if (value == "down") return STEMDIRECTION_down;
+    static const std::unordered_map<std::string, data_STEMDIRECTION> values = {
+        { "up", STEMDIRECTION_up },
+        { "down", STEMDIRECTION_down },
+    };
+    std::unordered_map<std::string, data_STEMDIRECTION>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported stem direction '%s'", value.c_str());
     return STEMDIRECTION_NONE;
 }
@@ -479,8 +520,12 @@ std::string Att::TempusToStr(data_TEMPUS data) const
 
 data_TEMPUS Att::StrToTempus(std::string value) const
 {
-    if (value == "2") return TEMPUS_2;
-    if (value == "3") return TEMPUS_3;
+    static const std::unordered_map<std::string, data_TEMPUS> values = {
+        { "2", TEMPUS_2 },
+        { "3", TEMPUS_3 },
+    };
+    std::unordered_map<std::string, data_TEMPUS>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported tempus '%s'", value.c_str());
     return TEMPUS_NONE;
 }
@@ -502,9 +547,13 @@ std::string Att::TieToStr(data_TIE data) const
 
 data_TIE Att::StrToTie(std::string value) const
 {
-    if (value == "i") return TIE_i;
-    if (value == "m") return TIE_m;
-    if (value == "t") return TIE_t;
+    static const std::unordered_map<std::string, data_TIE> values = {
+        { "i", TIE_i },
+        { "m", TIE_m },
+        { "t", TIE_t },
+    };
+    std::unordered_map<std::string, data_TIE>::const_iterator iter = values.find(value);
+    if (iter != values.end()) return iter->second;
     LogWarning("Unsupported tie '%s'", value.c_str());
     return TIE_NONE;
 }
@@ -104,7 +104,7 @@ void BeamDrawingParams::CalcBeam(
     for (i = 0; i < elementCount; i++) {
 
         if ((*beamElementCoords).at(i)->m_element->Is(CHORD)) {
-            Chord *chord = dynamic_cast<Chord *>((*beamElementCoords).at(i)->m_element);
+            Chord *chord = vrv_cast<Chord *>((*beamElementCoords).at(i)->m_element);
             assert(chord);
             chord->GetYExtremes(yMax, yMin);
             (*beamElementCoords).at(i)->m_yTop = yMax;
@@ -326,25 +326,25 @@ void Beam::Reset()
 void Beam::AddChild(Object *child)
 {
     if (child->Is(BEAM)) {
-        assert(dynamic_cast<Beam *>(child));
+        assert(vrv_cast<Beam *>(child));
     }
     else if (child->Is(CHORD)) {
-        assert(dynamic_cast<Chord *>(child));
+        assert(vrv_cast<Chord *>(child));
     }
     else if (child->Is(CLEF)) {
-        assert(dynamic_cast<Clef *>(child));
+        assert(vrv_cast<Clef *>(child));
     }
     else if (child->Is(NOTE)) {
-        assert(dynamic_cast<Note *>(child));
+        assert(vrv_cast<Note *>(child));
     }
     else if (child->Is(REST)) {
-        assert(dynamic_cast<Rest *>(child));
+        assert(vrv_cast<Rest *>(child));
     }
     else if (child->Is(SPACE)) {
-        assert(dynamic_cast<Space *>(child));
+        assert(vrv_cast<Space *>(child));
     }
     else if (child->Is(TUPLET)) {
-        assert(dynamic_cast<Tuplet *>(child));
+        assert(vrv_cast<Tuplet *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -356,6 +356,7 @@ void Beam::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -378,7 +379,7 @@ void Beam::FilterList(ListOfObjects *childList)
             continue;
         }
         else {
-            LayerElement *element = dynamic_cast<LayerElement *>(*iter);
+            LayerElement *element = vrv_cast<LayerElement *>(*iter);
             assert(element);
             // if we are at the beginning of the beam
             // and the note is cueSize
@@ -395,7 +396,7 @@ void Beam::FilterList(ListOfObjects *childList)
             }
             // also remove notes within chords
             if (element->Is(NOTE)) {
-                Note *note = dynamic_cast<Note *>(element);
+                Note *note = vrv_cast<Note *>(element);
                 assert(note);
                 if (note->IsChordTone()) {
                     iter = childList->erase(iter);
@@ -415,7 +416,7 @@ int Beam::GetPosition(LayerElement *element)
     int position = this->GetListIndex(element);
     // Check if this is a note in the chord
     if ((position == -1) && (element->Is(NOTE))) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
         Chord *chord = note->IsChordTone();
         if (chord) position = this->GetListIndex(chord);
@@ -577,7 +578,7 @@ BeamElementCoord::~BeamElementCoord()
 
 int Beam::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     ListOfObjects *beamChildren = this->GetList(this);
@@ -590,9 +591,9 @@ int Beam::CalcStem(FunctorParams *functorParams)
 
     int elementCount = (int)beamChildren->size();
 
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
-    Staff *staff = dynamic_cast<Staff *>(layer->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstParent(STAFF));
     assert(staff);
 
     this->m_drawingParams.CalcBeam(layer, staff, params->m_doc, beamElementCoords, elementCount);
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <climits>
 #include <math.h>
 
 //----------------------------------------------------------------------------
@@ -857,4 +858,58 @@ int BoundingBox::RectBottomOverlap(const Point rect1[2], const Point rect2[2], i
     return std::max(0, rect2[1].y - rect1[0].y + margin);
 }
 
+//----------------------------------------------------------------------------
+// BoundingBoxIndex
+//----------------------------------------------------------------------------
+
+void BoundingBoxIndex::Clear()
+{
+    m_count = 0;
+    m_groups.clear();
+}
+
+void BoundingBoxIndex::Add(BoundingBox *box)
+{
+    assert(box);
+
+    m_count++;
+    // A box without content never overlaps
+    if (!box->HasContentBB()) return;
+
+    int width = box->GetContentRight() - box->GetContentLeft();
+    int group = 0;
+    while ((group < 32) && (width >= ((long long)1 << group))) group++;
+
+    if ((int)m_groups.size() <= group) m_groups.resize(group + 1);
+    m_groups.at(group).insert(std::make_pair(box->GetContentLeft(), std::make_pair(m_count, box)));
+}
+
+void BoundingBoxIndex::FindHorizontalContentOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes &overlaps) const
+{
+    assert(box);
+
+    overlaps.clear();
+    if (!box->HasContentBB()) return;
+
+    std::vector<std::pair<int, BoundingBox *> > found;
+    int group;
+    for (group = 0; group < (int)m_groups.size(); group++) {
+        // Boxes in the group are narrower than 2^group, so the ones starting too far left cannot reach the box
+        long long from = (long long)box->GetContentLeft() - ((long long)1 << group);
+        std::multimap<int, std::pair<int, BoundingBox *> >::const_iterator iter = m_groups.at(group).begin();
+        if (from > INT_MIN) iter = m_groups.at(group).upper_bound((int)from);
+        std::multimap<int, std::pair<int, BoundingBox *> >::const_iterator end
+            = m_groups.at(group).lower_bound(box->GetContentRight());
+        for (; iter != end; ++iter) {
+            if (box->HorizontalContentOverlap(iter->second.second)) found.push_back(iter->second);
+        }
+    }
+
+    std::sort(found.begin(), found.end());
+    std::vector<std::pair<int, BoundingBox *> >::iterator iter;
+    for (iter = found.begin(); iter != found.end(); ++iter) {
+        overlaps.push_back(iter->second);
+    }
+}
+
 } // namespace vrv
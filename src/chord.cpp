@@ -96,16 +96,16 @@ void Chord::ClearClusters() const
 void Chord::AddChild(Object *child)
 {
     if (child->Is(ARTIC)) {
-        assert(dynamic_cast<Artic *>(child));
+        assert(vrv_cast<Artic *>(child));
     }
     else if (child->Is(DOTS)) {
-        assert(dynamic_cast<Dots *>(child));
+        assert(vrv_cast<Dots *>(child));
     }
     else if (child->Is(NOTE)) {
-        assert(dynamic_cast<Note *>(child));
+        assert(vrv_cast<Note *>(child));
     }
     else if (child->Is(STEM)) {
-        assert(dynamic_cast<Stem *>(child));
+        assert(vrv_cast<Stem *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -122,6 +122,7 @@ void Chord::AddChild(Object *child)
         m_children.insert(m_children.begin(), child);
     else
         m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -154,7 +155,7 @@ void Chord::FilterList(ListOfObjects *childList)
     Layer *layer2 = NULL;
 
     while (iter != childList->end()) {
-        curNote = dynamic_cast<Note *>(*iter);
+        curNote = vrv_cast<Note *>(*iter);
         assert(curNote);
         curPitch = curNote->GetDiatonicPitch();
 
@@ -222,7 +223,7 @@ Note *Chord::GetTopNote()
     ListOfObjects *childList = this->GetList(this); // make sure it's initialized
     assert(childList->size() > 0);
 
-    Note *topNote = dynamic_cast<Note *>(childList->back());
+    Note *topNote = vrv_cast<Note *>(childList->back());
     assert(topNote);
     return topNote;
 }
@@ -233,7 +234,7 @@ Note *Chord::GetBottomNote()
     assert(childList->size() > 0);
 
     // The first note is the bottom
-    Note *bottomNote = dynamic_cast<Note *>(childList->front());
+    Note *bottomNote = vrv_cast<Note *>(childList->front());
     assert(bottomNote);
     return bottomNote;
 }
@@ -318,7 +319,7 @@ Point Chord::GetStemDownNW(Doc *doc, int staffSize, bool graceSize)
 
 int Chord::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     // Set them to NULL in any case
@@ -339,9 +340,9 @@ int Chord::CalcStem(FunctorParams *functorParams)
 
     Stem *stem = this->GetDrawingStem();
     assert(stem);
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -390,14 +391,14 @@ int Chord::CalcStem(FunctorParams *functorParams)
 
 int Chord::CalcDots(FunctorParams *functorParams)
 {
-    CalcDotsParams *params = dynamic_cast<CalcDotsParams *>(functorParams);
+    CalcDotsParams *params = vrv_cast<CalcDotsParams *>(functorParams);
     assert(params);
 
     if (!this->HasDots()) {
         return FUNCTOR_SIBLINGS;
     }
 
-    Dots *dots = dynamic_cast<Dots *>(this->FindChildByType(DOTS, 1));
+    Dots *dots = vrv_cast<Dots *>(this->FindChildByType(DOTS, 1));
     assert(dots);
 
     params->m_chordDots = dots;
@@ -412,7 +413,7 @@ int Chord::CalcDots(FunctorParams *functorParams)
     assert(this->GetBottomNote());
 
     for (rit = notes->rbegin(); rit != notes->rend(); rit++) {
-        Note *note = dynamic_cast<Note *>(*rit);
+        Note *note = vrv_cast<Note *>(*rit);
         assert(note);
 
         Layer *layer = NULL;
@@ -473,9 +474,9 @@ int Chord::CalcDots(FunctorParams *functorParams)
 
 int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
 {
-    Stem *currentStem = dynamic_cast<Stem *>(this->FindChildByType(STEM, 1));
+    Stem *currentStem = vrv_cast<Stem *>(this->FindChildByType(STEM, 1));
     Flag *currentFlag = NULL;
-    if (currentStem) currentFlag = dynamic_cast<Flag *>(currentStem->FindChildByType(FLAG, 1));
+    if (currentStem) currentFlag = vrv_cast<Flag *>(currentStem->FindChildByType(FLAG, 1));
 
     if (this->GetActualDur() > DUR_1) {
         if (!currentStem) {
@@ -515,14 +516,14 @@ int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
     ListOfObjects *childList = this->GetList(this); // make sure it's initialized
     for (ListOfObjects::iterator it = childList->begin(); it != childList->end(); it++) {
         assert((*it)->Is(NOTE));
-        Note *note = dynamic_cast<Note *>(*it);
+        Note *note = vrv_cast<Note *>(*it);
         assert(note);
         note->SetDrawingStem(currentStem);
     }
 
     /************ dots ***********/
 
-    Dots *currentDots = dynamic_cast<Dots *>(this->FindChildByType(DOTS, 1));
+    Dots *currentDots = vrv_cast<Dots *>(this->FindChildByType(DOTS, 1));
 
     if (this->GetDots() > 0) {
         if (!currentDots) {
@@ -543,7 +544,7 @@ int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Chord::PrepareTieAttr(FunctorParams *functorParams)
 {
-    PrepareTieAttrParams *params = dynamic_cast<PrepareTieAttrParams *>(functorParams);
+    PrepareTieAttrParams *params = vrv_cast<PrepareTieAttrParams *>(functorParams);
     assert(params);
 
     assert(!params->m_currentChord);
@@ -554,7 +555,7 @@ int Chord::PrepareTieAttr(FunctorParams *functorParams)
 
 int Chord::PrepareTieAttrEnd(FunctorParams *functorParams)
 {
-    PrepareTieAttrParams *params = dynamic_cast<PrepareTieAttrParams *>(functorParams);
+    PrepareTieAttrParams *params = vrv_cast<PrepareTieAttrParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentChord);
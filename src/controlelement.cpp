@@ -53,7 +53,7 @@ void ControlElement::Reset()
 
 char ControlElement::GetAlignment()
 {
-    Rend *rend = dynamic_cast<Rend *>(this->FindChildByType(REND));
+    Rend *rend = vrv_cast<Rend *>(this->FindChildByType(REND));
     if (!rend || !rend->HasHalign()) return 0;
 
     switch (rend->GetHalign()) {
@@ -60,6 +60,7 @@ void Dir::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <math.h>
 
@@ -16,7 +17,9 @@
 
 #include "attcomparison.h"
 #include "barline.h"
+#include "boundary.h"
 #include "chord.h"
+#include "clef.h"
 #include "functorparams.h"
 #include "glyph.h"
 #include "keysig.h"
@@ -35,6 +38,8 @@
 #include "staff.h"
 #include "syl.h"
 #include "system.h"
+#include "tie.h"
+#include "timeinterface.h"
 #include "verse.h"
 #include "vrv.h"
 
@@ -54,12 +59,19 @@ Doc::Doc() : Object("doc-")
 
     // owned pointers need to be set to NULL;
     m_scoreBuffer = NULL;
+    m_layoutThreadPool = NULL;
+    m_uuidIndexIsValid = false;
+    m_timeIndexIsValid = false;
+    m_uuidGenerator.seed(std::random_device{}());
     Reset();
 }
 
 Doc::~Doc()
 {
     delete m_style;
+    if (m_layoutThreadPool) {
+        delete m_layoutThreadPool;
+    }
     if (m_scoreBuffer) {
         delete m_scoreBuffer;
     }
@@ -67,6 +79,11 @@ Doc::~Doc()
 
 void Doc::Reset()
 {
+    // Nothing to remove from the index when clearing the children
+    m_uuidIndex.clear();
+    m_duplicatedUuids.clear();
+    m_uuidIndexIsValid = false;
+
     Object::Reset();
 
     m_type = Raw;
@@ -82,14 +99,31 @@ void Doc::Reset()
     m_spacingStaff = m_style->m_spacingStaff;
     m_spacingSystem = m_style->m_spacingSystem;
 
+    m_castOffFirstModifiedPage = -1;
+    m_castOffLastModifiedPage = -1;
+    m_castOffSystemWidth = VRV_UNSET;
+    m_castOffPageHeight = VRV_UNSET;
+    m_castOffLongestActualDur = VRV_UNSET;
+    m_castOffSpacingStaff = 0;
+    m_castOffSpacingSystem = 0;
+    m_castOffEvenSpacing = false;
+    m_castOffSpacingLinear = 0.0;
+    m_castOffSpacingNonLinear = 0.0;
+    m_castOffFont = NULL;
+    m_castOffPending = false;
+    m_castOffPageObjectCount = 0;
+
     m_drawingPage = NULL;
     m_drawingJustifyX = true;
     m_drawingEvenSpacing = false;
+    m_layoutThreads = 1;
     m_currentScoreDefDone = false;
     m_drawingPreparationDone = false;
     m_midiExportDone = false;
 
     m_scoreDef.Reset();
+    // The uuid generated with the doc came before any seeding of the generator
+    m_scoreDef.ResetUuid();
     if (m_scoreBuffer) {
         delete m_scoreBuffer;
         m_scoreBuffer = NULL;
@@ -97,6 +131,12 @@ void Doc::Reset()
 
     m_drawingSmuflFontSize = 0;
     m_drawingLyricFontSize = 0;
+
+    m_timeIndexNotes.clear();
+    m_notesByOnset.clear();
+    m_notesByOffset.clear();
+    m_maxOffsets.clear();
+    m_timeIndexIsValid = false;
 }
 
 void Doc::SetType(DocType type)
@@ -110,7 +150,7 @@ void Doc::AddChild(Object *child)
     assert(!m_scoreBuffer); // Children cannot be added if a score buffer was created;
 
     if (child->Is(PAGE)) {
-        assert(dynamic_cast<Page *>(child));
+        assert(vrv_cast<Page *>(child));
     }
     else {
         LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
@@ -119,6 +159,7 @@ void Doc::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -138,9 +179,151 @@ void Doc::Refresh()
     RefreshViews();
 }
 
+void Doc::Modify(bool modified)
+{
+    // The uuid index is updated when children are added or removed (see Object::AddToDocUuidIndex)
+    if (modified) {
+        m_timeIndexIsValid = false;
+    }
+
+    Object::Modify(modified);
+}
+
+void Doc::BuildUuidIndex()
+{
+    // We use the flat list functor with all objects, including the ones in hidden editorial elements
+    ListOfObjects objects;
+    AddLayerElementToFlatListParams addLayerElementToFlatListParams(&objects);
+    Functor addToFlatList(&Object::AddLayerElementToFlatList);
+    addToFlatList.m_visibleOnly = false;
+    this->Process(&addToFlatList, &addLayerElementToFlatListParams);
+
+    m_uuidIndex.clear();
+    m_uuidIndex.reserve(objects.size());
+    m_duplicatedUuids.clear();
+    ListOfObjects::iterator iter;
+    for (iter = objects.begin(); iter != objects.end(); iter++) {
+        // emplace keeps the first one in case of duplicated uuids, as Object::FindByUuid does
+        if (!m_uuidIndex.emplace((*iter)->GetUuid(), *iter).second) {
+            m_duplicatedUuids.insert((*iter)->GetUuid());
+        }
+    }
+    m_uuidIndexIsValid = true;
+}
+
+Object *Doc::GetIndexedObject(const std::string &uuid)
+{
+    if (!m_uuidIndexIsValid) this->BuildUuidIndex();
+
+    auto iter = m_uuidIndex.find(uuid);
+    Object *object = (iter != m_uuidIndex.end()) ? iter->second : NULL;
+
+#ifdef UUID_INDEX_CHECK
+    Functor findByUuid(&Object::FindByUuid);
+    findByUuid.m_visibleOnly = false;
+    FindByUuidParams findByUuidParams;
+    findByUuidParams.m_uuid = uuid;
+    this->Process(&findByUuid, &findByUuidParams);
+    if (findByUuidParams.m_element != object) {
+        LogError("Uuid index: '%s' does not give the object found in the document", uuid.c_str());
+        assert(false);
+    }
+#endif
+
+    return object;
+}
+
+void Doc::AddToUuidIndex(Object *object)
+{
+    assert(object);
+
+    // Nothing to do, the index will be built anyway
+    if (!m_uuidIndexIsValid) return;
+
+    // Only the children of objects in the index are added, not the ones of the aligners or of the other layout objects
+    Object *parent = object->GetParent();
+    assert(parent);
+    if (parent != this) {
+        auto iter = m_uuidIndex.find(parent->GetUuid());
+        if ((iter == m_uuidIndex.end()) || (iter->second != parent)) {
+            // See Doc::RemoveFromUuidIndex
+            if (m_duplicatedUuids.count(parent->GetUuid())) m_uuidIndexIsValid = false;
+            return;
+        }
+    }
+
+    ListOfObjects objects;
+    AddLayerElementToFlatListParams addLayerElementToFlatListParams(&objects);
+    Functor addToFlatList(&Object::AddLayerElementToFlatList);
+    addToFlatList.m_visibleOnly = false;
+    object->Process(&addToFlatList, &addLayerElementToFlatListParams);
+
+    ListOfObjects::iterator iter;
+    for (iter = objects.begin(); iter != objects.end(); iter++) {
+        // With a duplicated uuid, we do not know which one comes first - rebuild the index when needed
+        if (!m_uuidIndex.emplace((*iter)->GetUuid(), *iter).second) {
+            m_uuidIndexIsValid = false;
+            return;
+        }
+    }
+}
+
+void Doc::RemoveFromUuidIndex(Object *object)
+{
+    assert(object);
+
+    if (!m_uuidIndexIsValid) return;
+
+    auto iter = m_uuidIndex.find(object->GetUuid());
+    if ((iter == m_uuidIndex.end()) || (iter->second != object)) {
+        // Another object with the same uuid might come up in the index instead
+        if (m_duplicatedUuids.count(object->GetUuid())) m_uuidIndexIsValid = false;
+        // Otherwise the object is not in the index (e.g., a layout object) and neither are its children
+        return;
+    }
+
+    ListOfObjects objects;
+    AddLayerElementToFlatListParams addLayerElementToFlatListParams(&objects);
+    Functor addToFlatList(&Object::AddLayerElementToFlatList);
+    addToFlatList.m_visibleOnly = false;
+    object->Process(&addToFlatList, &addLayerElementToFlatListParams);
+
+    ListOfObjects::iterator objectIter;
+    for (objectIter = objects.begin(); objectIter != objects.end(); objectIter++) {
+        if (m_duplicatedUuids.count((*objectIter)->GetUuid())) {
+            m_uuidIndexIsValid = false;
+            return;
+        }
+        iter = m_uuidIndex.find((*objectIter)->GetUuid());
+        if ((iter != m_uuidIndex.end()) && (iter->second == *objectIter)) m_uuidIndex.erase(iter);
+    }
+}
+
+void Doc::UpdateUuidIndex(Object *object, const std::string &previousUuid)
+{
+    assert(object);
+
+    // Nothing to do, the index will be built anyway
+    if (!m_uuidIndexIsValid) return;
+
+    auto iter = m_uuidIndex.find(previousUuid);
+    if ((iter == m_uuidIndex.end()) || (iter->second != object)) {
+        // See Doc::RemoveFromUuidIndex
+        if (m_duplicatedUuids.count(previousUuid)) m_uuidIndexIsValid = false;
+        return;
+    }
+    // With duplicated uuids, we cannot know which one comes first - rebuild the index when needed
+    if (m_duplicatedUuids.count(previousUuid) || m_uuidIndex.count(object->GetUuid())) {
+        m_uuidIndexIsValid = false;
+        return;
+    }
+    m_uuidIndex.erase(iter);
+    m_uuidIndex.emplace(object->GetUuid(), object);
+}
+
 bool Doc::GenerateDocumentScoreDef()
 {
-    Measure *measure = dynamic_cast<Measure *>(this->FindChildByType(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->FindChildByType(MEASURE));
     if (!measure) {
         LogError("No measure found for generating a scoreDef");
         return false;
@@ -159,7 +342,7 @@ bool Doc::GenerateDocumentScoreDef()
     StaffGrp *staffGrp = new StaffGrp();
     ArrayOfObjects::iterator iter;
     for (iter = staves.begin(); iter != staves.end(); iter++) {
-        Staff *staff = dynamic_cast<Staff *>(*iter);
+        Staff *staff = vrv_cast<Staff *>(*iter);
         assert(staff);
         StaffDef *staffDef = new StaffDef();
         staffDef->SetN(staff->GetN());
@@ -192,9 +375,7 @@ void Doc::ExportMIDI(MidiFile *midiFile)
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separatly
-    // For this, we use a array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The tree is used to set up the state of each staff/layer before processing the document once
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
@@ -204,10 +385,12 @@ void Doc::ExportMIDI(MidiFile *midiFile)
         midiFile->addTempo(0, 0, m_scoreDef.GetMidiBpm());
     }
 
-    // Process notes and chords, rests, spaces layer by layer
+    GenerateMIDIParams generateMIDIParams(midiFile);
+    generateMIDIParams.m_maxValues = calcMaxMeasureDurationParams.m_maxValues;
+
+    // Notes and chords, rests, spaces are processed layer by layer, each layer having its own state
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiTrack = 1;
-    std::vector<AttComparison *> filters;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
 
@@ -221,28 +404,142 @@ void Doc::ExportMIDI(MidiFile *midiFile)
         }
 
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            GenerateMIDIParams generateMIDIParams(midiFile);
-            generateMIDIParams.m_maxValues = calcMaxMeasureDurationParams.m_maxValues;
-            generateMIDIParams.m_midiTrack = midiTrack;
-            generateMIDIParams.m_transSemi = transSemi;
-            Functor generateMIDI(&Object::GenerateMIDI);
-            Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
+            MIDILayerTrack &layerTrack
+                = generateMIDIParams.m_layerTracks[std::make_pair(staves->first, layers->first)];
+            layerTrack.m_midiTrack = midiTrack;
+            layerTrack.m_transSemi = transSemi;
+        }
+    }
 
-            // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, &generateMIDIEnd, &filters);
+    // Process the whole document once
+    Functor generateMIDI(&Object::GenerateMIDI);
+    Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
+    this->Process(&generateMIDI, &generateMIDIParams, &generateMIDIEnd);
+
+    // Add the notes in the order of the staff/layer tree
+    int channel = 0;
+    int velocity = 64;
+    std::map<std::pair<int, int>, MIDILayerTrack>::iterator layerTrackIter;
+    for (layerTrackIter = generateMIDIParams.m_layerTracks.begin();
+         layerTrackIter != generateMIDIParams.m_layerTracks.end(); ++layerTrackIter) {
+        MIDILayerTrack &layerTrack = layerTrackIter->second;
+        std::vector<MIDILayerTrack::MIDINote>::iterator noteIter;
+        for (noteIter = layerTrack.m_notes.begin(); noteIter != layerTrack.m_notes.end(); ++noteIter) {
+            midiFile->addNoteOn(layerTrack.m_midiTrack, noteIter->m_onset, channel, noteIter->m_pitch, velocity);
+            midiFile->addNoteOff(layerTrack.m_midiTrack, noteIter->m_offset, channel, noteIter->m_pitch);
         }
     }
 
+    this->BuildTimeIndex();
+
     m_midiExportDone = true;
 }
 
+void Doc::BuildTimeIndex()
+{
+    ArrayOfObjects notes;
+    AttComparison matchType(NOTE);
+    this->FindAllChildByAttComparison(&notes, &matchType);
+
+    m_timeIndexNotes.clear();
+    ArrayOfObjects::iterator iter;
+    for (iter = notes.begin(); iter != notes.end(); iter++) {
+        Note *note = vrv_cast<Note *>(*iter);
+        assert(note);
+        // Notes not played (e.g., grace notes) have no duration
+        if (note->m_playingOffset <= note->m_playingOnset) continue;
+        m_timeIndexNotes.push_back(note);
+    }
+
+    int count = (int)m_timeIndexNotes.size();
+    m_notesByOnset.resize(count);
+    m_notesByOffset.resize(count);
+    for (int i = 0; i < count; i++) {
+        m_notesByOnset.at(i) = i;
+        m_notesByOffset.at(i) = i;
+    }
+    std::vector<Note *> &timeIndexNotes = m_timeIndexNotes;
+    std::stable_sort(m_notesByOnset.begin(), m_notesByOnset.end(), [&timeIndexNotes](int a, int b) {
+        return (timeIndexNotes.at(a)->m_playingOnset < timeIndexNotes.at(b)->m_playingOnset);
+    });
+    std::stable_sort(m_notesByOffset.begin(), m_notesByOffset.end(), [&timeIndexNotes](int a, int b) {
+        return (timeIndexNotes.at(a)->m_playingOffset < timeIndexNotes.at(b)->m_playingOffset);
+    });
+
+    m_maxOffsets.resize(count);
+    double maxOffset = 0.0;
+    for (int i = 0; i < count; i++) {
+        maxOffset = std::max(maxOffset, m_timeIndexNotes.at(m_notesByOnset.at(i))->m_playingOffset);
+        m_maxOffsets.at(i) = maxOffset;
+    }
+
+    m_timeIndexIsValid = true;
+}
+
+std::vector<int>::iterator Doc::FindFirstPositionAt(std::vector<int> &positions, double time, bool byOffset)
+{
+    std::vector<Note *> &timeIndexNotes = m_timeIndexNotes;
+    return std::lower_bound(
+        positions.begin(), positions.end(), time, [&timeIndexNotes, byOffset](int position, double value) {
+            Note *note = timeIndexNotes.at(position);
+            return ((byOffset ? note->m_playingOffset : note->m_playingOnset) < value);
+        });
+}
+
+void Doc::FindNotesAtTime(double time, ArrayOfObjects *notes)
+{
+    assert(notes);
+
+    if (!m_timeIndexIsValid) this->BuildTimeIndex();
+
+    std::vector<Note *> &timeIndexNotes = m_timeIndexNotes;
+
+    // The first note with an onset not before the time
+    std::vector<int>::iterator first = this->FindFirstPositionAt(m_notesByOnset, time, false);
+
+    // Look backwards as long as a note up to the position can end after the time
+    std::vector<int> positions;
+    for (int i = (int)(first - m_notesByOnset.begin()) - 1; (i >= 0) && (m_maxOffsets.at(i) > time); i--) {
+        int position = m_notesByOnset.at(i);
+        if (timeIndexNotes.at(position)->m_playingOffset > time) positions.push_back(position);
+    }
+
+    std::sort(positions.begin(), positions.end());
+    std::vector<int>::iterator iter;
+    for (iter = positions.begin(); iter != positions.end(); iter++) {
+        notes->push_back(m_timeIndexNotes.at(*iter));
+    }
+}
+
+void Doc::FindNotesChangingBetweenTimes(double startTime, double endTime, ArrayOfObjects *notes)
+{
+    assert(notes);
+
+    if (!m_timeIndexIsValid) this->BuildTimeIndex();
+
+    std::vector<Note *> &timeIndexNotes = m_timeIndexNotes;
+    std::vector<int> positions;
+    std::vector<int>::iterator iter;
+
+    // Notes with an onset in the range
+    iter = this->FindFirstPositionAt(m_notesByOnset, startTime, false);
+    for (; (iter != m_notesByOnset.end()) && (timeIndexNotes.at(*iter)->m_playingOnset < endTime); iter++) {
+        positions.push_back(*iter);
+    }
+
+    // Notes with an offset in the range
+    iter = this->FindFirstPositionAt(m_notesByOffset, startTime, true);
+    for (; (iter != m_notesByOffset.end()) && (timeIndexNotes.at(*iter)->m_playingOffset < endTime); iter++) {
+        positions.push_back(*iter);
+    }
+
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    for (iter = positions.begin(); iter != positions.end(); iter++) {
+        notes->push_back(m_timeIndexNotes.at(*iter));
+    }
+}
+
 void Doc::PrepareDrawing()
 {
     if (m_drawingPreparationDone) {
@@ -250,8 +547,10 @@ void Doc::PrepareDrawing()
         this->Process(&resetDrawing, NULL);
     }
 
-    // Try to match all spanning elements (slur, tie, etc) by processing backwards
-    PrepareTimeSpanningParams prepareTimeSpanningParams;
+    // Try to match all spanning elements (slur, tie, etc) through the uuid index when reaching them
+    // The ones that cannot be matched through the index (e.g., duplicated uuids with a hidden one) are matched by
+    // processing the LayerElements backwards
+    PrepareTimeSpanningParams prepareTimeSpanningParams(this);
     Functor prepareTimeSpanning(&Object::PrepareTimeSpanning);
     Functor prepareTimeSpanningEnd(&Object::PrepareTimeSpanningEnd);
     this->Process(
@@ -267,8 +566,8 @@ void Doc::PrepareDrawing()
         this->Process(&prepareTimeSpanning, &prepareTimeSpanningParams);
     }
 
-    // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
-    PrepareTimePointingParams prepareTimePointingParams;
+    // Try to match all time pointing elements (tempo, fermata, etc) in the same way
+    PrepareTimePointingParams prepareTimePointingParams(this);
     Functor prepareTimePointing(&Object::PrepareTimePointing);
     Functor prepareTimePointingEnd(&Object::PrepareTimePointingEnd);
     this->Process(
@@ -277,6 +576,8 @@ void Doc::PrepareDrawing()
     // Now try to match the @tstamp and @tstamp2 attributes.
     PrepareTimestampsParams prepareTimestampsParams;
     prepareTimestampsParams.m_timeSpanningInterfaces = prepareTimeSpanningParams.m_timeSpanningInterfaces;
+    prepareTimestampsParams.m_timeSpanningInterfaces.insert(prepareTimestampsParams.m_timeSpanningInterfaces.end(),
+        prepareTimeSpanningParams.m_unmatchedInterfaces.begin(), prepareTimeSpanningParams.m_unmatchedInterfaces.end());
     Functor prepareTimestamps(&Object::PrepareTimestamps);
     Functor prepareTimestampsEnd(&Object::PrepareTimestampsEnd);
     this->Process(&prepareTimestamps, &prepareTimestampsParams, &prepareTimestampsEnd);
@@ -306,8 +607,8 @@ void Doc::PrepareDrawing()
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     // The tree is used to process each staff/layer/verse separately
-    // For this, we use an array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
+    // For this, we use the staves of each staff/layer filled in the processing lists and process them
+    // with an array of AttCommmonNComparison that looks for each object if it is of the type and with @n specified
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
@@ -319,17 +620,17 @@ void Doc::PrepareDrawing()
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
+            const ArrayOfObjects &layerStaves
+                = prepareProcessingListsParams.m_layerStaves[std::make_pair(staves->first, layers->first)];
             filters.clear();
             // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
             AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
             filters.push_back(&matchLayer);
 
             PrepareTieAttrParams prepareTieAttrParams;
             Functor prepareTieAttr(&Object::PrepareTieAttr);
             Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
-            this->Process(&prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd, &filters);
+            this->ProcessLayerStaves(layerStaves, &prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd, &filters);
 
             // After having processed one layer, we check if we have open ties - if yes, we
             // must reset them and they will be ignored.
@@ -341,22 +642,11 @@ void Doc::PrepareDrawing()
                     (*iter)->ResetDrawingTieAttr();
                 }
             }
-        }
-    }
-
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
 
             PreparePointersByLayerParams preparePointersByLayerParams;
             Functor preparePointersByLayer(&Object::PreparePointersByLayer);
-            this->Process(&preparePointersByLayer, &preparePointersByLayerParams, NULL, &filters);
+            this->ProcessLayerStaves(
+                layerStaves, &preparePointersByLayer, &preparePointersByLayerParams, NULL, &filters);
         }
     }
 
@@ -364,14 +654,14 @@ void Doc::PrepareDrawing()
     for (staves = prepareProcessingListsParams.m_verseTree.child.begin();
          staves != prepareProcessingListsParams.m_verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
+            const ArrayOfObjects &layerStaves
+                = prepareProcessingListsParams.m_layerStaves[std::make_pair(staves->first, layers->first)];
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
                 // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
                 filters.clear();
                 // Create ad comparison object for each type / @n
-                AttCommonNComparison matchStaff(STAFF, staves->first);
                 AttCommonNComparison matchLayer(LAYER, layers->first);
                 AttCommonNComparison matchVerse(VERSE, verses->first);
-                filters.push_back(&matchStaff);
                 filters.push_back(&matchLayer);
                 filters.push_back(&matchVerse);
 
@@ -380,7 +670,8 @@ void Doc::PrepareDrawing()
                 PrepareLyricsParams prepareLyricsParams;
                 Functor prepareLyrics(&Object::PrepareLyrics);
                 Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
-                this->Process(&prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
+                this->ProcessLayerStaves(
+                    layerStaves, &prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
             }
         }
     }
@@ -403,17 +694,17 @@ void Doc::PrepareDrawing()
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
+            const ArrayOfObjects &layerStaves
+                = prepareProcessingListsParams.m_layerStaves[std::make_pair(staves->first, layers->first)];
             filters.clear();
             // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
             AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
             filters.push_back(&matchLayer);
 
             // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
             PrepareRptParams prepareRptParams(&m_scoreDef);
             Functor prepareRpt(&Object::PrepareRpt);
-            this->Process(&prepareRpt, &prepareRptParams, NULL, &filters);
+            this->ProcessLayerStaves(layerStaves, &prepareRpt, &prepareRptParams, NULL, &filters);
         }
     }
 
@@ -465,6 +756,147 @@ void Doc::PrepareDrawing()
     m_drawingPreparationDone = true;
 }
 
+bool Doc::PrepareMeasuresTimeSpanning(Measure *startMeasure, Measure *endMeasure)
+{
+    assert(startMeasure);
+    assert(endMeasure);
+
+    Page *page = vrv_cast<Page *>(startMeasure->GetFirstParent(PAGE));
+    assert(page);
+    System *system = vrv_cast<System *>(startMeasure->GetFirstParent(SYSTEM));
+    assert(system);
+
+    // The measures from start to end, going through the following systems and pages
+    ArrayOfObjects measures;
+    int pageIdx = this->GetChildIndex(page);
+    int systemIdx = page->GetChildIndex(system);
+    int idx = system->GetChildIndex(startMeasure);
+    for (; pageIdx < this->GetChildCount(); ++pageIdx, systemIdx = 0) {
+        page = vrv_cast<Page *>(this->GetChild(pageIdx));
+        assert(page);
+        for (; systemIdx < page->GetChildCount(); ++systemIdx, idx = 0) {
+            system = vrv_cast<System *>(page->GetChild(systemIdx));
+            assert(system);
+            for (; idx < system->GetChildCount(); ++idx) {
+                Object *measure = system->GetChild(idx);
+                if (!measure->Is(MEASURE)) continue;
+                measures.push_back(measure);
+                if (measure == endMeasure) break;
+            }
+            if (idx < system->GetChildCount()) break;
+        }
+        if (systemIdx < page->GetChildCount()) break;
+    }
+    if (measures.empty() || (measures.back() != endMeasure)) return false;
+
+    // Match the time spanning elements backwards and then forwards (see Doc::PrepareDrawing)
+    PrepareTimeSpanningParams prepareTimeSpanningParams(this);
+    Functor prepareTimeSpanning(&Object::PrepareTimeSpanning);
+    Functor prepareTimeSpanningEnd(&Object::PrepareTimeSpanningEnd);
+    ArrayOfObjects::reverse_iterator reverseIter;
+    for (reverseIter = measures.rbegin(); reverseIter != measures.rend(); ++reverseIter) {
+        (*reverseIter)->Process(
+            &prepareTimeSpanning, &prepareTimeSpanningParams, &prepareTimeSpanningEnd, NULL, UNLIMITED_DEPTH, BACKWARD);
+    }
+    ArrayOfObjects::iterator iter;
+    if (!prepareTimeSpanningParams.m_timeSpanningInterfaces.empty()) {
+        prepareTimeSpanningParams.m_fillList = false;
+        for (iter = measures.begin(); iter != measures.end(); ++iter) {
+            (*iter)->Process(&prepareTimeSpanning, &prepareTimeSpanningParams);
+        }
+    }
+
+    // Set them as running to the staves again, starting with the elements running into the start measure from the
+    // previous ones, which are kept by its staves
+    FillStaffCurrentTimeSpanningParams fillStaffCurrentTimeSpanningParams;
+    std::vector<Object *> &runningElements = fillStaffCurrentTimeSpanningParams.m_timeSpanningElements;
+    AttComparison isStaff(STAFF);
+    for (iter = measures.begin(); iter != measures.end(); ++iter) {
+        ArrayOfObjects staves;
+        (*iter)->FindAllChildByAttComparison(&staves, &isStaff, 1);
+        ArrayOfObjects::iterator staffIter;
+        for (staffIter = staves.begin(); staffIter != staves.end(); ++staffIter) {
+            Staff *staff = vrv_cast<Staff *>(*staffIter);
+            assert(staff);
+            if (*iter == startMeasure) {
+                std::vector<Object *>::iterator elementIter;
+                for (elementIter = staff->m_timeSpanningElements.begin();
+                     elementIter != staff->m_timeSpanningElements.end(); ++elementIter) {
+                    if (std::find(runningElements.begin(), runningElements.end(), *elementIter)
+                        == runningElements.end()) {
+                        runningElements.push_back(*elementIter);
+                    }
+                }
+            }
+            staff->m_timeSpanningElements.clear();
+        }
+    }
+    Functor fillStaffCurrentTimeSpanning(&Object::FillStaffCurrentTimeSpanning);
+    Functor fillStaffCurrentTimeSpanningEnd(&Object::FillStaffCurrentTimeSpanningEnd);
+    for (iter = measures.begin(); iter != measures.end(); ++iter) {
+        (*iter)->Process(
+            &fillStaffCurrentTimeSpanning, &fillStaffCurrentTimeSpanningParams, &fillStaffCurrentTimeSpanningEnd);
+    }
+
+    return true;
+}
+
+void Doc::ProcessLayerStaves(const ArrayOfObjects &staves, Functor *functor, FunctorParams *functorParams,
+    Functor *endFunctor, ArrayOfAttComparisons *filters)
+{
+    // The staves are all the ones with the staff @n, so only the layer (and verse) filters need to be checked.
+    // A functor returning FUNCTOR_STOP will make Object::Process skip the remaining staves.
+    ArrayOfObjects::const_iterator iter;
+    for (iter = staves.begin(); iter != staves.end(); ++iter) {
+        (*iter)->Process(functor, functorParams, endFunctor, filters);
+    }
+
+    // Processing the entire document would also have called the end functor on the doc
+    if (endFunctor) {
+        endFunctor->Call(this, functorParams);
+    }
+}
+
+void Doc::PrepareParallelDrawing(std::vector<bool> &linkedPages)
+{
+    // We use the flat list functor with all objects, including the ones in hidden editorial elements
+    ListOfObjects objects;
+    AddLayerElementToFlatListParams addLayerElementToFlatListParams(&objects);
+    Functor addToFlatList(&Object::AddLayerElementToFlatList);
+    addToFlatList.m_visibleOnly = false;
+    this->Process(&addToFlatList, &addLayerElementToFlatListParams);
+
+    linkedPages.assign(this->GetChildCount(), false);
+    // Mark the pages from the one of start to the one of end as being linked
+    auto linkPages = [&linkedPages](Object *start, Object *end) {
+        if (!start || !end) return;
+        Object *startPage = start->GetFirstParent(PAGE);
+        Object *endPage = end->GetFirstParent(PAGE);
+        if (!startPage || !endPage || (startPage == endPage)) return;
+        int first = std::min(startPage->GetIdx(), endPage->GetIdx());
+        int last = std::max(startPage->GetIdx(), endPage->GetIdx());
+        for (int i = first; i < last; i++) linkedPages.at(i) = true;
+    };
+
+    ListOfObjects::iterator iter;
+    for (iter = objects.begin(); iter != objects.end(); iter++) {
+        Object *object = *iter;
+        if (object->Is(NOTE)) {
+            Tie *tie = vrv_cast<Note *>(object)->GetDrawingTieAttr();
+            if (tie) linkPages(tie->GetStart(), tie->GetEnd());
+        }
+
+        TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+        if (interface) linkPages(interface->GetStart(), interface->GetEnd());
+
+        if (object->IsBoundaryElement()) {
+            BoundaryStartInterface *boundary = dynamic_cast<BoundaryStartInterface *>(object);
+            assert(boundary);
+            linkPages(object, boundary->GetEnd());
+        }
+    }
+}
+
 void Doc::CollectScoreDefs(bool force)
 {
     if (m_currentScoreDefDone && !force) {
@@ -491,15 +923,309 @@ void Doc::CollectScoreDefs(bool force)
     m_currentScoreDefDone = true;
 }
 
+void Doc::CollectScoreDefsFrom(int pageIdx, const ScoreDef &pageScoreDef)
+{
+    // Nothing comes before the first page
+    if (pageIdx == 0) {
+        this->CollectScoreDefs(true);
+        return;
+    }
+
+    assert(m_currentScoreDefDone);
+    assert(pageIdx < this->GetChildCount());
+
+    ScoreDef upcomingScoreDef = pageScoreDef;
+    SetCurrentScoreDefParams setCurrentScoreDefParams(this, &upcomingScoreDef);
+    // The bar lines are set with the last measure of the previous page, which already has its cautionary scoreDef
+    Object *previousPage = this->GetChild(pageIdx - 1);
+    setCurrentScoreDefParams.m_previousMeasure
+        = vrv_cast<Measure *>(previousPage->FindChildByType(MEASURE, UNLIMITED_DEPTH, BACKWARD));
+    setCurrentScoreDefParams.m_cautionaryDone = true;
+
+    Functor unsetCurrentScoreDef(&Object::UnsetCurrentScoreDef);
+    Functor setCurrentScoreDef(&Object::SetCurrentScoreDef);
+    int i;
+    for (i = pageIdx; i < this->GetChildCount(); ++i) {
+        Object *page = this->GetChild(i);
+        page->Process(&unsetCurrentScoreDef, NULL);
+        page->Process(&setCurrentScoreDef, &setCurrentScoreDefParams);
+    }
+}
+
 void Doc::CastOffDoc()
 {
     this->CollectScoreDefs();
+    m_castOffPending = false;
 
-    Page *contentPage = this->SetDrawingPage(0);
+    this->CastOffContentPage(0, this->GetLongestActualDur());
+
+    // LogDebug("Layout: %d pages", this->GetChildCount());
+
+    // We need to reset the drawing page to NULL
+    // because idx will still be 0 but contentPage is dead!
+    this->ResetDrawingPage();
+    this->CollectScoreDefs(true);
+}
+
+void Doc::CastOffDocLazily()
+{
+    this->CollectScoreDefs();
+
+    assert(this->GetChildCount() == 1);
+    m_castOffPending = true;
+    // A first guess that is adjusted once pages are cast off
+    m_castOffPageObjectCount = 16;
+    // The spacing by duration of the pages depends on the longest duration of the entire document
+    m_castOffLongestActualDur = this->GetLongestActualDur();
+}
+
+void Doc::CastOffDocUpTo(int pageIdx)
+{
+    if (!m_castOffPending) return;
+
+    // All the pages before the last one are complete
+    if ((pageIdx != -1) && (pageIdx < this->GetChildCount() - 1)) return;
+
+    while (m_castOffPending && ((pageIdx == -1) || (pageIdx >= this->GetChildCount() - 1))) {
+        int chunkPageIdx = this->GetChildCount() - 1;
+        Page *remainingPage = vrv_cast<Page *>(this->GetChild(chunkPageIdx));
+        assert(remainingPage);
+        System *remainingSystem = vrv_cast<System *>(remainingPage->GetChild(0));
+        assert(remainingSystem);
+
+        // Estimate the size of the chunk from the number of objects per page, including the page following
+        // the requested one, which has to be started for the requested one to be complete
+        int chunkSize = remainingSystem->GetChildCount();
+        if (pageIdx != -1) {
+            chunkSize = std::min(chunkSize, m_castOffPageObjectCount * (pageIdx - chunkPageIdx + 2));
+        }
+
+        // The scoreDef at the beginning of the chunk, set with the remaining content, from which the scoreDefs of the
+        // chunk are collected without going through the pages before
+        ScoreDef chunkScoreDef = remainingPage->m_drawingScoreDef;
+
+        // Move the chunk to a new content page cast off without the rest of the content
+        this->DetachChild(chunkPageIdx);
+        Page *contentPage = new Page();
+        System *contentSystem = new System();
+        contentPage->AddChild(contentSystem);
+        int i;
+        for (i = 0; i < chunkSize; ++i) {
+            contentSystem->AddChild(remainingSystem->Relinquish(i));
+        }
+        remainingSystem->ClearRelinquishedChildren();
+        bool lastChunk = (remainingSystem->GetChildCount() == 0);
+        this->AddChild(contentPage);
+
+        this->ResetDrawingPage();
+        this->CollectScoreDefsFrom(chunkPageIdx, chunkScoreDef);
+        this->CastOffContentPage(chunkPageIdx, m_castOffLongestActualDur, &chunkScoreDef);
+
+        if (lastChunk) {
+            delete remainingPage;
+            m_castOffPending = false;
+            // The scoreDefs of the new pages
+            this->CollectScoreDefsFrom(chunkPageIdx, chunkScoreDef);
+            break;
+        }
+
+        // The last page is not complete - its content goes back to the remaining content
+        int lastPageIdx = this->GetChildCount() - 1;
+        Page *lastPage = vrv_cast<Page *>(this->DetachChild(lastPageIdx));
+        assert(lastPage);
+        contentSystem = new System();
+        UnCastOffParams unCastOffParams(contentSystem);
+        Functor unCastOff(&Object::UnCastOff);
+        lastPage->Process(&unCastOff, &unCastOffParams);
+        delete lastPage;
+        contentSystem->MoveChildrenFrom(remainingSystem);
+        remainingSystem->ClearRelinquishedChildren();
+        remainingPage->DeleteChild(remainingSystem);
+        remainingPage->AddChild(contentSystem);
+        remainingPage->ResetLayout();
+        this->AddChild(remainingPage);
+
+        // The scoreDefs of the new pages and of the remaining content
+        this->CollectScoreDefsFrom(chunkPageIdx, chunkScoreDef);
+
+        // Update the number of objects per page - if no page is complete, a page has at least the entire chunk
+        if (lastPageIdx > chunkPageIdx) {
+            m_castOffPageObjectCount
+                = std::max(1, (chunkSize - contentSystem->GetChildCount()) / (lastPageIdx - chunkPageIdx));
+        }
+        else {
+            m_castOffPageObjectCount = chunkSize;
+        }
+    }
+
+    this->ResetDrawingPage();
+}
+
+void Doc::RedoCastOffDoc()
+{
+    // A document not entirely cast off is cast off lazily again from the start
+    if (m_castOffPending) {
+        this->UnCastOffDoc();
+        this->CastOffDocLazily();
+        return;
+    }
+
+    // Make sure the drawing values are the current ones of the document
+    this->ResetDrawingPage();
+    Page *page = this->SetDrawingPage(0);
+    // The spacing by duration of all the pages depends on the longest duration
+    int longestActualDur = this->GetLongestActualDur();
+
+    if (!page || (m_castOffFirstModifiedPage == -1) || (m_castOffSystemWidth == VRV_UNSET)
+        || (m_castOffLongestActualDur != longestActualDur)
+        || (m_castOffSystemWidth != this->m_drawingPageWidth - this->m_drawingPageLeftMar - this->m_drawingPageRightMar)
+        || (m_castOffPageHeight != this->m_drawingPageHeight - this->m_drawingPageTopMar)
+        || (m_castOffSpacingStaff != this->GetSpacingStaff()) || (m_castOffSpacingSystem != this->GetSpacingSystem())
+        || (m_castOffEvenSpacing != this->GetEvenSpacing()) || (m_castOffSpacingLinear != this->GetSpacingLinear())
+        || (m_castOffSpacingNonLinear != this->GetSpacingNonLinear())
+        || (m_castOffFont != Resources::GetCurrentFont())) {
+        this->UnCastOffDoc();
+        this->CastOffDoc();
+        return;
+    }
+
+    int firstPage = m_castOffFirstModifiedPage;
+    int lastPage = std::min(m_castOffLastModifiedPage, this->GetChildCount() - 1);
+
+    // The number of pages following the last page that are cast off again with it when the breaks are not stable
+    int pageCount = 1;
+
+    Functor unCastOff(&Object::UnCastOff);
+
+    while (true) {
+        // Keep the first object of each system of the last page for checking if the breaks are stable
+        ArrayOfObjects previousBreaks;
+        Object *previousPage = this->GetChild(lastPage);
+        assert(previousPage);
+        int i;
+        for (i = 0; i < previousPage->GetChildCount(); ++i) {
+            Object *system = previousPage->GetChild(i);
+            if (system->GetChildCount() > 0) previousBreaks.push_back(system->GetChild(0));
+        }
+
+        // Detach the pages following the ones we cast off again - they will be added back afterwards
+        ArrayOfObjects followingPages;
+        while (this->GetChildCount() > lastPage + 1) {
+            followingPages.push_back(this->DetachChild(this->GetChildCount() - 1));
+        }
+
+        Page *contentPage = new Page();
+        System *contentSystem = new System();
+        contentPage->AddChild(contentSystem);
+
+        UnCastOffParams unCastOffParams(contentSystem);
+        for (i = firstPage; i <= lastPage; ++i) {
+            this->GetChild(i)->Process(&unCastOff, &unCastOffParams);
+        }
+        for (i = lastPage; i >= firstPage; --i) {
+            delete this->DetachChild(i);
+        }
+        this->AddChild(contentPage);
+
+        this->ResetDrawingPage();
+        this->CollectScoreDefs(true);
+
+        this->CastOffContentPage(firstPage, longestActualDur);
+
+        int castOffPageCount = this->GetChildCount();
+        ArrayOfObjects::reverse_iterator pageIter;
+        for (pageIter = followingPages.rbegin(); pageIter != followingPages.rend(); ++pageIter) {
+            this->AddChild(*pageIter);
+        }
+
+        if (followingPages.empty()) break;
+
+        // The page and system breaks are stable if the last page has the same systems as before
+        // Otherwise, this page has to be cast off again with the next one
+        Object *castOffPage = this->GetChild(castOffPageCount - 1);
+        ArrayOfObjects breaks;
+        for (i = 0; i < castOffPage->GetChildCount(); ++i) {
+            Object *system = castOffPage->GetChild(i);
+            if (system->GetChildCount() > 0) breaks.push_back(system->GetChild(0));
+        }
+        if (breaks == previousBreaks) break;
+
+        firstPage = castOffPageCount - 1;
+        lastPage = std::min(castOffPageCount - 1 + pageCount, this->GetChildCount() - 1);
+        pageCount *= 2;
+    }
+
+    // The staffDef drawing objects of the pages we kept will be recreated by CollectScoreDefs
+    int i;
+    for (i = 0; i < this->GetChildCount(); ++i) {
+        Page *page = vrv_cast<Page *>(this->GetChild(i));
+        assert(page);
+        page->ResetLayout();
+    }
+
+    this->ResetDrawingPage();
+    this->CollectScoreDefs(true);
+}
+
+void Doc::SetCastOffModified(Object *object)
+{
+    assert(object);
+
+    int firstPage = 0;
+    int lastPage = this->GetChildCount() - 1;
+    Page *page = vrv_cast<Page *>(object->GetFirstParent(PAGE));
+    if (page) {
+        firstPage = this->GetChildIndex(page);
+        // The widths and the breaks of all the following pages change with the scoreDef, the staffDefs, the clefs,
+        // the key signatures, the meter signatures and the mensurs
+        if (object->Is({ SCOREDEF, STAFFGRP, STAFFDEF, CLEF, KEYSIG, METERSIG, MENSUR })
+            || object->GetFirstParent(SCOREDEF)) {
+            lastPage = this->GetChildCount() - 1;
+        }
+        else {
+            lastPage = firstPage;
+        }
+    }
+
+    if ((m_castOffFirstModifiedPage == -1) || (firstPage < m_castOffFirstModifiedPage)) {
+        m_castOffFirstModifiedPage = firstPage;
+    }
+    m_castOffLastModifiedPage = std::max(m_castOffLastModifiedPage, lastPage);
+}
+
+ThreadPool *Doc::GetLayoutThreadPool()
+{
+    if (m_layoutThreads < 2) return NULL;
+
+    if (m_layoutThreadPool && (m_layoutThreadPool->GetThreadCount() != m_layoutThreads)) {
+        delete m_layoutThreadPool;
+        m_layoutThreadPool = NULL;
+    }
+    if (!m_layoutThreadPool) m_layoutThreadPool = new ThreadPool(m_layoutThreads);
+    return m_layoutThreadPool;
+}
+
+int Doc::GetLongestActualDur()
+{
+    int longestActualDur = DUR_4;
+    AttDurExtreme durExtremeComparison(LONGEST);
+    Object *longestDur = this->FindChildExtremeByAttComparison(&durExtremeComparison);
+    if (longestDur) {
+        DurationInterface *interface = longestDur->GetDurationInterface();
+        assert(interface);
+        longestActualDur = interface->GetActualDur();
+    }
+    return longestActualDur;
+}
+
+void Doc::CastOffContentPage(int pageIdx, int longestActualDur, const ScoreDef *pageScoreDef)
+{
+    Page *contentPage = this->SetDrawingPage(pageIdx);
     assert(contentPage);
-    contentPage->LayOutHorizontally();
+    assert(pageIdx == this->GetChildCount() - 1);
+    contentPage->LayOutHorizontally(longestActualDur);
 
-    System *contentSystem = dynamic_cast<System *>(contentPage->DetachChild(0));
+    System *contentSystem = vrv_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
 
     System *currentSystem = new System();
@@ -507,7 +1233,18 @@ void Doc::CastOffDoc()
     CastOffSystemsParams castOffSystemsParams(contentSystem, contentPage, currentSystem);
     castOffSystemsParams.m_systemWidth = this->m_drawingPageWidth - this->m_drawingPageLeftMar
         - this->m_drawingPageRightMar - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
-    castOffSystemsParams.m_shift = -contentSystem->GetDrawingLabelsWidth();
+    if (pageIdx == 0) {
+        castOffSystemsParams.m_shift = -contentSystem->GetDrawingLabelsWidth();
+    }
+    // Not the first system - its labels are the abbreviated ones and its first measure has the scoreDef, which
+    // is otherwise taken into account only with the current scoreDef width
+    else {
+        contentSystem->SetDrawingAbbrLabelsWidth(contentSystem->GetDrawingLabelsWidth());
+        Measure *firstMeasure = vrv_cast<Measure *>(contentSystem->FindChildByType(MEASURE, 1));
+        if (firstMeasure) {
+            castOffSystemsParams.m_shift = firstMeasure->GetDrawingXRel() + firstMeasure->GetLeftBarLineXRel();
+        }
+    }
     castOffSystemsParams.m_currentScoreDefWidth
         = contentPage->m_drawingScoreDef.GetDrawingWidth() + contentSystem->GetDrawingAbbrLabelsWidth();
 
@@ -517,7 +1254,12 @@ void Doc::CastOffDoc()
     delete contentSystem;
 
     // Reset the scoreDef at the beginning of each system
-    this->CollectScoreDefs(true);
+    if (pageScoreDef) {
+        this->CollectScoreDefsFrom(pageIdx, *pageScoreDef);
+    }
+    else {
+        this->CollectScoreDefs(true);
+    }
 
     // Here we redo the alignment because of the new scoreDefs
     // We can actually optimise this and have a custom version that does not redo all the calculation
@@ -526,7 +1268,7 @@ void Doc::CastOffDoc()
     contentPage->LayOutVertically();
 
     // Detach the contentPage
-    this->DetachChild(0);
+    this->DetachChild(pageIdx);
     assert(contentPage && !contentPage->GetParent());
 
     Page *currentPage = new Page();
@@ -538,12 +1280,17 @@ void Doc::CastOffDoc()
     contentPage->Process(&castOffPages, &castOffPagesParams);
     delete contentPage;
 
-    // LogDebug("Layout: %d pages", this->GetChildCount());
-
-    // We need to reset the drawing page to NULL
-    // because idx will still be 0 but contentPage is dead!
-    this->ResetDrawingPage();
-    this->CollectScoreDefs(true);
+    m_castOffFirstModifiedPage = -1;
+    m_castOffLastModifiedPage = -1;
+    m_castOffSystemWidth = this->m_drawingPageWidth - this->m_drawingPageLeftMar - this->m_drawingPageRightMar;
+    m_castOffPageHeight = castOffPagesParams.m_pageHeight;
+    m_castOffLongestActualDur = longestActualDur;
+    m_castOffSpacingStaff = this->GetSpacingStaff();
+    m_castOffSpacingSystem = this->GetSpacingSystem();
+    m_castOffEvenSpacing = this->GetEvenSpacing();
+    m_castOffSpacingLinear = this->GetSpacingLinear();
+    m_castOffSpacingNonLinear = this->GetSpacingNonLinear();
+    m_castOffFont = Resources::GetCurrentFont();
 }
 
 void Doc::UnCastOffDoc()
@@ -561,6 +1308,11 @@ void Doc::UnCastOffDoc()
 
     this->AddChild(contentPage);
 
+    m_castOffFirstModifiedPage = -1;
+    m_castOffLastModifiedPage = -1;
+    m_castOffSystemWidth = VRV_UNSET;
+    m_castOffPending = false;
+
     // LogDebug("ContinousLayout: %d pages", this->GetChildCount());
 
     // We need to reset the drawing page to NULL
@@ -576,7 +1328,7 @@ void Doc::CastOffEncodingDoc()
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
 
-    System *contentSystem = dynamic_cast<System *>(contentPage->FindChildByType(SYSTEM));
+    System *contentSystem = vrv_cast<System *>(contentPage->FindChildByType(SYSTEM));
     assert(contentSystem);
 
     // Detach the contentPage
@@ -594,6 +1346,11 @@ void Doc::CastOffEncodingDoc()
     contentSystem->Process(&castOffEncoding, &castOffEncodingParams);
     delete contentPage;
 
+    m_castOffFirstModifiedPage = -1;
+    m_castOffLastModifiedPage = -1;
+    m_castOffSystemWidth = VRV_UNSET;
+    m_castOffPending = false;
+
     // We need to reset the drawing page to NULL
     // because idx will still be 0 but contentPage is dead!
     this->ResetDrawingPage();
@@ -634,6 +1391,20 @@ int Doc::GetPageCount() const
     return GetChildCount();
 }
 
+int Doc::GetEstimatedPageCount() const
+{
+    if (!m_castOffPending) return GetPageCount();
+
+    // The content not cast off yet is in the last page
+    Object *remainingPage = this->GetLast();
+    assert(remainingPage);
+    Object *remainingSystem = remainingPage->GetChild(0);
+    assert(remainingSystem);
+    int remainingCount = remainingSystem->GetChildCount();
+    return GetChildCount() - 1
+        + std::max(1, (remainingCount + m_castOffPageObjectCount - 1) / m_castOffPageObjectCount);
+}
+
 bool Doc::GetMidiExportDone() const
 {
     return m_midiExportDone;
@@ -816,16 +1587,19 @@ int Doc::GetCueSize(int value) const
 
 FontInfo *Doc::GetDrawingSmuflFont(int staffSize, bool graceSize)
 {
+    // One font per thread since the point size is changed at every call (see Toolkit::RenderAllToSvg)
+    static thread_local FontInfo drawingSmuflFont;
     int value = m_drawingSmuflFontSize * staffSize / 100;
     if (graceSize) value = value * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    m_drawingSmuflFont.SetPointSize(value);
-    return &m_drawingSmuflFont;
+    drawingSmuflFont.SetPointSize(value);
+    return &drawingSmuflFont;
 }
 
 FontInfo *Doc::GetDrawingLyricFont(int staffSize)
 {
-    m_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
-    return &m_drawingLyricFont;
+    static thread_local FontInfo drawingLyricFont;
+    drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
+    return &drawingLyricFont;
 }
 
 char Doc::GetLeftMargin(const ClassId classId) const
@@ -930,7 +1704,7 @@ Page *Doc::SetDrawingPage(int pageIdx)
     if (m_drawingPage && m_drawingPage->GetIdx() == pageIdx) {
         return m_drawingPage;
     }
-    m_drawingPage = dynamic_cast<Page *>(this->GetChild(pageIdx));
+    m_drawingPage = vrv_cast<Page *>(this->GetChild(pageIdx));
     assert(m_drawingPage);
 
     int glyph_size;
@@ -1036,7 +1810,7 @@ int Doc::GetAdjustedDrawingPageWidth() const
 
 int Doc::PrepareLyricsEnd(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentSyl && params->m_lastNote) && (params->m_currentSyl->GetStart() != params->m_lastNote)) {
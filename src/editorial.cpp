@@ -82,16 +82,16 @@ void EditorialElement::AddChild(Object *child)
         assert(dynamic_cast<TextElement *>(child));
     }
     else if (child->Is(LAYER)) {
-        assert(dynamic_cast<Layer *>(child));
+        assert(vrv_cast<Layer *>(child));
     }
     else if (child->Is(MEASURE)) {
-        assert(dynamic_cast<Measure *>(child));
+        assert(vrv_cast<Measure *>(child));
     }
     else if (child->Is(SCOREDEF)) {
-        assert(dynamic_cast<ScoreDef *>(child));
+        assert(vrv_cast<ScoreDef *>(child));
     }
     else if (child->Is(STAFF)) {
-        assert(dynamic_cast<Staff *>(child));
+        assert(vrv_cast<Staff *>(child));
     }
     else if (child->Is(STAFFDEF)) {
         assert(dynamic_cast<Staff *>(child));
@@ -106,6 +106,7 @@ void EditorialElement::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -204,10 +205,10 @@ App::~App()
 void App::AddChild(Object *child)
 {
     if (child->Is(LEM)) {
-        assert(dynamic_cast<Lem *>(child));
+        assert(vrv_cast<Lem *>(child));
     }
     else if (child->Is(RDG)) {
-        assert(dynamic_cast<Rdg *>(child));
+        assert(vrv_cast<Rdg *>(child));
     }
     else {
         LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
@@ -216,6 +217,7 @@ void App::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -249,28 +251,28 @@ Choice::~Choice()
 void Choice::AddChild(Object *child)
 {
     if (child->Is(ABBR)) {
-        assert(dynamic_cast<Abbr *>(child));
+        assert(vrv_cast<Abbr *>(child));
     }
     else if (child->Is(CHOICE)) {
-        assert(dynamic_cast<Choice *>(child));
+        assert(vrv_cast<Choice *>(child));
     }
     else if (child->Is(CORR)) {
-        assert(dynamic_cast<Corr *>(child));
+        assert(vrv_cast<Corr *>(child));
     }
     else if (child->Is(EXPAN)) {
-        assert(dynamic_cast<Expan *>(child));
+        assert(vrv_cast<Expan *>(child));
     }
     else if (child->Is(ORIG)) {
-        assert(dynamic_cast<Orig *>(child));
+        assert(vrv_cast<Orig *>(child));
     }
     else if (child->Is(REG)) {
-        assert(dynamic_cast<Reg *>(child));
+        assert(vrv_cast<Reg *>(child));
     }
     else if (child->Is(SIC)) {
-        assert(dynamic_cast<Sic *>(child));
+        assert(vrv_cast<Sic *>(child));
     }
     else if (child->Is(UNCLEAR)) {
-        assert(dynamic_cast<Unclear *>(child));
+        assert(vrv_cast<Unclear *>(child));
     }
     else {
         LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
@@ -279,6 +281,7 @@ void Choice::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -540,7 +543,7 @@ void Unclear::Reset()
 
 int EditorialElement::ConvertToPageBased(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     this->MoveItselfTo(params->m_pageBasedSystem);
@@ -550,7 +553,7 @@ int EditorialElement::ConvertToPageBased(FunctorParams *functorParams)
 
 int EditorialElement::ConvertToPageBasedEnd(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     if (this->m_visibility == Visible) ConvertToPageBasedBoundary(this, params->m_pageBasedSystem);
@@ -578,7 +581,7 @@ int EditorialElement::ResetDrawing(FunctorParams *functorParams)
 
 int EditorialElement::CastOffSystems(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     // Since the functor returns FUNCTOR_SIBLINGS we should never go lower than the system children
@@ -599,7 +602,7 @@ int EditorialElement::CastOffSystems(FunctorParams *functorParams)
 
 int EditorialElement::CastOffEncoding(FunctorParams *functorParams)
 {
-    CastOffEncodingParams *params = dynamic_cast<CastOffEncodingParams *>(functorParams);
+    CastOffEncodingParams *params = vrv_cast<CastOffEncodingParams *>(functorParams);
     assert(params);
 
     MoveItselfTo(params->m_currentSystem);
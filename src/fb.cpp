@@ -53,6 +53,7 @@ void Fb::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -77,7 +78,7 @@ void F::Reset()
 void F::AddChild(Object *child)
 {
     if (child->Is(TEXT)) {
-        assert(dynamic_cast<Text *>(child));
+        assert(vrv_cast<Text *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -89,6 +90,7 @@ void F::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -112,19 +112,19 @@ FloatingPositioner::FloatingPositioner(FloatingObject *object) : BoundingBox()
 
     m_object = object;
     if (object->Is(BREATH)) {
-        Breath *breath = dynamic_cast<Breath *>(object);
+        Breath *breath = vrv_cast<Breath *>(object);
         assert(breath);
         // breath above by default
         m_place = breath->HasPlace() ? breath->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(DIR)) {
-        Dir *dir = dynamic_cast<Dir *>(object);
+        Dir *dir = vrv_cast<Dir *>(object);
         assert(dir);
         // dir below by default
         m_place = dir->HasPlace() ? dir->GetPlace() : STAFFREL_below;
     }
     else if (object->Is(DYNAM)) {
-        Dynam *dynam = dynamic_cast<Dynam *>(object);
+        Dynam *dynam = vrv_cast<Dynam *>(object);
         assert(dynam);
         // dynam below by default
         m_place = dynam->HasPlace() ? dynam->GetPlace() : STAFFREL_below;
@@ -134,56 +134,56 @@ FloatingPositioner::FloatingPositioner(FloatingObject *object) : BoundingBox()
         m_place = STAFFREL_above;
     }
     else if (object->Is(FERMATA)) {
-        Fermata *fermata = dynamic_cast<Fermata *>(object);
+        Fermata *fermata = vrv_cast<Fermata *>(object);
         assert(fermata);
         // fermata above by default
         m_place = fermata->HasPlace() ? fermata->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(HAIRPIN)) {
-        Hairpin *hairpin = dynamic_cast<Hairpin *>(object);
+        Hairpin *hairpin = vrv_cast<Hairpin *>(object);
         assert(hairpin);
         // haripin below by default;
         m_place = hairpin->HasPlace() ? hairpin->GetPlace() : STAFFREL_below;
     }
     else if (object->Is(HARM)) {
-        Harm *harm = dynamic_cast<Harm *>(object);
+        Harm *harm = vrv_cast<Harm *>(object);
         assert(harm);
         // harm above by default
         m_place = harm->HasPlace() ? harm->GetPlace() : STAFFREL_above;
         if (!harm->HasPlace() && object->GetFirst()->Is(FB)) m_place = STAFFREL_below;
     }
     else if (object->Is(MORDENT)) {
-        Mordent *mordent = dynamic_cast<Mordent *>(object);
+        Mordent *mordent = vrv_cast<Mordent *>(object);
         assert(mordent);
         // mordent above by default;
         m_place = mordent->HasPlace() ? mordent->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(OCTAVE)) {
-        Octave *octave = dynamic_cast<Octave *>(object);
+        Octave *octave = vrv_cast<Octave *>(object);
         assert(octave);
         // octave below by default (won't draw without @dis.place anyway);
         m_place = (octave->GetDisPlace() == PLACE_above) ? STAFFREL_above : STAFFREL_below;
     }
     else if (object->Is(PEDAL)) {
-        Pedal *pedal = dynamic_cast<Pedal *>(object);
+        Pedal *pedal = vrv_cast<Pedal *>(object);
         assert(pedal);
         // pedal below by default
         m_place = pedal->HasPlace() ? pedal->GetPlace() : STAFFREL_below;
     }
     else if (object->Is(TEMPO)) {
-        Tempo *tempo = dynamic_cast<Tempo *>(object);
+        Tempo *tempo = vrv_cast<Tempo *>(object);
         assert(tempo);
         // tempo above by default;
         m_place = tempo->HasPlace() ? tempo->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(TRILL)) {
-        Trill *trill = dynamic_cast<Trill *>(object);
+        Trill *trill = vrv_cast<Trill *>(object);
         assert(trill);
         // trill above by default;
         m_place = trill->HasPlace() ? trill->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(TURN)) {
-        Turn *turn = dynamic_cast<Turn *>(object);
+        Turn *turn = vrv_cast<Turn *>(object);
         assert(turn);
         // turn above by default;
         m_place = turn->HasPlace() ? turn->GetPlace() : STAFFREL_above;
@@ -138,4 +138,45 @@ const Point *Glyph::GetAnchor(SMuFLGlyphAnchor anchor)
     return &m_anchors[anchor];
 }
 
+void Glyph::WriteCache(std::ostream &output) const
+{
+    BinaryWriteInt(output, m_x);
+    BinaryWriteInt(output, m_y);
+    BinaryWriteInt(output, m_width);
+    BinaryWriteInt(output, m_height);
+    BinaryWriteInt(output, m_horizAdvX);
+    BinaryWriteInt(output, m_unitsPerEm);
+    BinaryWriteString(output, m_path);
+    BinaryWriteString(output, m_codeStr);
+    BinaryWriteString(output, m_xml);
+    BinaryWriteInt(output, (int)m_anchors.size());
+    std::map<SMuFLGlyphAnchor, Point>::const_iterator iter;
+    for (iter = m_anchors.begin(); iter != m_anchors.end(); iter++) {
+        BinaryWriteInt(output, iter->first);
+        BinaryWriteInt(output, iter->second.x);
+        BinaryWriteInt(output, iter->second.y);
+    }
+}
+
+bool Glyph::ReadCache(std::istream &input)
+{
+    if (!BinaryReadInt(input, m_x) || !BinaryReadInt(input, m_y) || !BinaryReadInt(input, m_width)
+        || !BinaryReadInt(input, m_height) || !BinaryReadInt(input, m_horizAdvX)
+        || !BinaryReadInt(input, m_unitsPerEm)) {
+        return false;
+    }
+    if (!BinaryReadString(input, m_path) || !BinaryReadString(input, m_codeStr) || !BinaryReadString(input, m_xml)) {
+        return false;
+    }
+    int anchorCount = 0;
+    if (!BinaryReadInt(input, anchorCount)) return false;
+    m_anchors.clear();
+    for (int i = 0; i < anchorCount; i++) {
+        int anchor, x, y;
+        if (!BinaryReadInt(input, anchor) || !BinaryReadInt(input, x) || !BinaryReadInt(input, y)) return false;
+        m_anchors[(SMuFLGlyphAnchor)anchor] = Point(x, y);
+    }
+    return true;
+}
+
 } // namespace vrv
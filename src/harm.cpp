@@ -59,7 +59,7 @@ void Harm::AddChild(Object *child)
         assert(dynamic_cast<EditorialElement *>(child));
     }
     else if (child->Is(FB)) {
-        assert(dynamic_cast<Fb *>(child));
+        assert(vrv_cast<Fb *>(child));
     }
     else {
         LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
@@ -68,6 +68,7 @@ void Harm::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -77,7 +78,7 @@ void Harm::AddChild(Object *child)
 
 int Harm::PrepareFloatingGrps(FunctorParams *functorParams)
 {
-    // PrepareFloatingGrpsParams *params = dynamic_cast<PrepareFloatingGrpsParams *>(functorParams);
+    // PrepareFloatingGrpsParams *params = vrv_cast<PrepareFloatingGrpsParams *>(functorParams);
     // assert(params);
 
     this->SetDrawingGrpId(DRAWING_GRP_HARM);
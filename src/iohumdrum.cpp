@@ -6748,7 +6748,20 @@ static const EntityNameEntry StaticEntityNames[] = {
 
 typedef std::map<std::string, unsigned int> EntityNameMap;
 typedef std::pair<std::string, unsigned int> EntityNamePair;
-static EntityNameMap EntityNames;
+
+// Built on first use - the initialization of the static local is thread-safe
+static const EntityNameMap &GetEntityNames()
+{
+    static const EntityNameMap entityNames = []() {
+        EntityNameMap names;
+        const EntityNameEntry *ThisEntry;
+        for (ThisEntry = StaticEntityNames; ThisEntry->Name != NULL; ++ThisEntry) {
+            names.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
+        }
+        return names;
+    }();
+    return entityNames;
+}
 
 //////////////////////////////
 //
@@ -6834,16 +6847,7 @@ void HumdrumInput::UnquoteHTML(std::istream &In, std::ostream &Out)
                     ProcessedChar = true;
                 }
                 else if (ThisCh == ';') {
-                    if (EntityNames.empty()) {
-                        /* first use, load EntityNames from StaticEntityNames */
-                        const EntityNameEntry *ThisEntry;
-                        ThisEntry = StaticEntityNames;
-                        for (;;) {
-                            if (ThisEntry->Name == NULL) break;
-                            EntityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
-                            ++ThisEntry;
-                        }
-                    }
+                    const EntityNameMap &EntityNames = GetEntityNames();
                     const EntityNameMap::const_iterator NameEntry = EntityNames.find(MatchingName);
                     if (NameEntry != EntityNames.end()) {
                         CharCode = NameEntry->second;
@@ -123,7 +123,7 @@ bool MeiOutput::ExportFile()
                 LogError("Page %d does not exist", m_page);
                 return false;
             }
-            Page *page = dynamic_cast<Page *>(m_doc->GetChild(m_page));
+            Page *page = vrv_cast<Page *>(m_doc->GetChild(m_page));
             assert(page);
             if (m_scoreBasedMEI) {
                 m_currentNode = meiDoc.append_child("score");
@@ -174,7 +174,7 @@ bool MeiOutput::WriteObject(Object *object)
 
     // Containers and scoreDef related
     if (object->Is(DOC)) {
-        WriteMeiDoc(dynamic_cast<Doc *>(object));
+        WriteMeiDoc(vrv_cast<Doc *>(object));
         m_nodeStack.push_back(m_currentNode);
         return true;
     }
@@ -193,109 +193,109 @@ bool MeiOutput::WriteObject(Object *object)
     }
     else if (object->Is(SECTION)) {
         m_currentNode = m_currentNode.append_child("section");
-        WriteMeiSection(m_currentNode, dynamic_cast<Section *>(object));
+        WriteMeiSection(m_currentNode, vrv_cast<Section *>(object));
     }
     else if (object->Is(ENDING)) {
         m_currentNode = m_currentNode.append_child("ending");
-        WriteMeiEnding(m_currentNode, dynamic_cast<Ending *>(object));
+        WriteMeiEnding(m_currentNode, vrv_cast<Ending *>(object));
     }
     else if (object->Is(EXPANSION)) {
         m_currentNode = m_currentNode.append_child("expansion");
-        WriteMeiExpansion(m_currentNode, dynamic_cast<Expansion *>(object));
+        WriteMeiExpansion(m_currentNode, vrv_cast<Expansion *>(object));
     }
     else if (object->Is(PB)) {
         m_currentNode = m_currentNode.append_child("pb");
-        WriteMeiPb(m_currentNode, dynamic_cast<Pb *>(object));
+        WriteMeiPb(m_currentNode, vrv_cast<Pb *>(object));
     }
     else if (object->Is(SB)) {
         m_currentNode = m_currentNode.append_child("sb");
-        WriteMeiSb(m_currentNode, dynamic_cast<Sb *>(object));
+        WriteMeiSb(m_currentNode, vrv_cast<Sb *>(object));
     }
     else if (object->Is(SCOREDEF)) {
         m_currentNode = m_currentNode.append_child("scoreDef");
-        WriteMeiScoreDef(m_currentNode, dynamic_cast<ScoreDef *>(object));
+        WriteMeiScoreDef(m_currentNode, vrv_cast<ScoreDef *>(object));
     }
     else if (object->Is(STAFFGRP)) {
         m_currentNode = m_currentNode.append_child("staffGrp");
-        WriteMeiStaffGrp(m_currentNode, dynamic_cast<StaffGrp *>(object));
+        WriteMeiStaffGrp(m_currentNode, vrv_cast<StaffGrp *>(object));
     }
     else if (object->Is(STAFFDEF)) {
         m_currentNode = m_currentNode.append_child("staffDef");
-        WriteMeiStaffDef(m_currentNode, dynamic_cast<StaffDef *>(object));
+        WriteMeiStaffDef(m_currentNode, vrv_cast<StaffDef *>(object));
     }
     else if (object->Is(MEASURE)) {
         m_currentNode = m_currentNode.append_child("measure");
-        WriteMeiMeasure(m_currentNode, dynamic_cast<Measure *>(object));
+        WriteMeiMeasure(m_currentNode, vrv_cast<Measure *>(object));
     }
     else if (object->Is(STAFF)) {
         m_currentNode = m_currentNode.append_child("staff");
-        WriteMeiStaff(m_currentNode, dynamic_cast<Staff *>(object));
+        WriteMeiStaff(m_currentNode, vrv_cast<Staff *>(object));
     }
     else if (object->Is(LAYER)) {
         m_currentNode = m_currentNode.append_child("layer");
-        WriteMeiLayer(m_currentNode, dynamic_cast<Layer *>(object));
+        WriteMeiLayer(m_currentNode, vrv_cast<Layer *>(object));
     }
 
     // Measure elements
     else if (object->Is(ANCHORED_TEXT)) {
         m_currentNode = m_currentNode.append_child("anchoredText");
-        WriteMeiAnchoredText(m_currentNode, dynamic_cast<AnchoredText *>(object));
+        WriteMeiAnchoredText(m_currentNode, vrv_cast<AnchoredText *>(object));
     }
     else if (object->Is(BREATH)) {
         m_currentNode = m_currentNode.append_child("breath");
-        WriteMeiBreath(m_currentNode, dynamic_cast<Breath *>(object));
+        WriteMeiBreath(m_currentNode, vrv_cast<Breath *>(object));
     }
     else if (object->Is(DIR)) {
         m_currentNode = m_currentNode.append_child("dir");
-        WriteMeiDir(m_currentNode, dynamic_cast<Dir *>(object));
+        WriteMeiDir(m_currentNode, vrv_cast<Dir *>(object));
     }
     else if (object->Is(DYNAM)) {
         m_currentNode = m_currentNode.append_child("dynam");
-        WriteMeiDynam(m_currentNode, dynamic_cast<Dynam *>(object));
+        WriteMeiDynam(m_currentNode, vrv_cast<Dynam *>(object));
     }
     else if (object->Is(FERMATA)) {
         m_currentNode = m_currentNode.append_child("fermata");
-        WriteMeiFermata(m_currentNode, dynamic_cast<Fermata *>(object));
+        WriteMeiFermata(m_currentNode, vrv_cast<Fermata *>(object));
     }
     else if (object->Is(HAIRPIN)) {
         m_currentNode = m_currentNode.append_child("hairpin");
-        WriteMeiHairpin(m_currentNode, dynamic_cast<Hairpin *>(object));
+        WriteMeiHairpin(m_currentNode, vrv_cast<Hairpin *>(object));
     }
     else if (object->Is(HARM)) {
         m_currentNode = m_currentNode.append_child("harm");
-        WriteMeiHarm(m_currentNode, dynamic_cast<Harm *>(object));
+        WriteMeiHarm(m_currentNode, vrv_cast<Harm *>(object));
     }
     else if (object->Is(MORDENT)) {
         m_currentNode = m_currentNode.append_child("mordent");
-        WriteMeiMordent(m_currentNode, dynamic_cast<Mordent *>(object));
+        WriteMeiMordent(m_currentNode, vrv_cast<Mordent *>(object));
     }
     else if (object->Is(OCTAVE)) {
         m_currentNode = m_currentNode.append_child("octave");
-        WriteMeiOctave(m_currentNode, dynamic_cast<Octave *>(object));
+        WriteMeiOctave(m_currentNode, vrv_cast<Octave *>(object));
     }
     else if (object->Is(PEDAL)) {
         m_currentNode = m_currentNode.append_child("pedal");
-        WriteMeiPedal(m_currentNode, dynamic_cast<Pedal *>(object));
+        WriteMeiPedal(m_currentNode, vrv_cast<Pedal *>(object));
     }
     else if (object->Is(SLUR)) {
         m_currentNode = m_currentNode.append_child("slur");
-        WriteMeiSlur(m_currentNode, dynamic_cast<Slur *>(object));
+        WriteMeiSlur(m_currentNode, vrv_cast<Slur *>(object));
     }
     else if (object->Is(TEMPO)) {
         m_currentNode = m_currentNode.append_child("tempo");
-        WriteMeiTempo(m_currentNode, dynamic_cast<Tempo *>(object));
+        WriteMeiTempo(m_currentNode, vrv_cast<Tempo *>(object));
     }
     else if (object->Is(TIE)) {
         m_currentNode = m_currentNode.append_child("tie");
-        WriteMeiTie(m_currentNode, dynamic_cast<Tie *>(object));
+        WriteMeiTie(m_currentNode, vrv_cast<Tie *>(object));
     }
     else if (object->Is(TRILL)) {
         m_currentNode = m_currentNode.append_child("trill");
-        WriteMeiTrill(m_currentNode, dynamic_cast<Trill *>(object));
+        WriteMeiTrill(m_currentNode, vrv_cast<Trill *>(object));
     }
     else if (object->Is(TURN)) {
         m_currentNode = m_currentNode.append_child("turn");
-        WriteMeiTurn(m_currentNode, dynamic_cast<Turn *>(object));
+        WriteMeiTurn(m_currentNode, vrv_cast<Turn *>(object));
     }
 
     // Layer elements
@@ -311,43 +311,43 @@ bool MeiOutput::WriteObject(Object *object)
     }
     else if (object->Is(BARLINE)) {
         m_currentNode = m_currentNode.append_child("barLine");
-        WriteMeiBarLine(m_currentNode, dynamic_cast<BarLine *>(object));
+        WriteMeiBarLine(m_currentNode, vrv_cast<BarLine *>(object));
     }
     else if (object->Is(BEAM)) {
         m_currentNode = m_currentNode.append_child("beam");
-        WriteMeiBeam(m_currentNode, dynamic_cast<Beam *>(object));
+        WriteMeiBeam(m_currentNode, vrv_cast<Beam *>(object));
     }
     else if (object->Is(BEATRPT)) {
         m_currentNode = m_currentNode.append_child("beatRpt");
-        WriteMeiBeatRpt(m_currentNode, dynamic_cast<BeatRpt *>(object));
+        WriteMeiBeatRpt(m_currentNode, vrv_cast<BeatRpt *>(object));
     }
     else if (object->Is(BTREM)) {
         m_currentNode = m_currentNode.append_child("bTrem");
-        WriteMeiBTrem(m_currentNode, dynamic_cast<BTrem *>(object));
+        WriteMeiBTrem(m_currentNode, vrv_cast<BTrem *>(object));
     }
     else if (object->Is(CHORD)) {
         m_currentNode = m_currentNode.append_child("chord");
-        WriteMeiChord(m_currentNode, dynamic_cast<Chord *>(object));
+        WriteMeiChord(m_currentNode, vrv_cast<Chord *>(object));
     }
     else if (object->Is(CLEF)) {
         m_currentNode = m_currentNode.append_child("clef");
-        WriteMeiClef(m_currentNode, dynamic_cast<Clef *>(object));
+        WriteMeiClef(m_currentNode, vrv_cast<Clef *>(object));
     }
     else if (object->Is(CUSTOS)) {
         m_currentNode = m_currentNode.append_child("custos");
-        WriteMeiCustos(m_currentNode, dynamic_cast<Custos *>(object));
+        WriteMeiCustos(m_currentNode, vrv_cast<Custos *>(object));
     }
     else if (object->Is(DOT)) {
         m_currentNode = m_currentNode.append_child("dot");
-        WriteMeiDot(m_currentNode, dynamic_cast<Dot *>(object));
+        WriteMeiDot(m_currentNode, vrv_cast<Dot *>(object));
     }
     else if (object->Is(FTREM)) {
         m_currentNode = m_currentNode.append_child("fTrem");
-        WriteMeiFTrem(m_currentNode, dynamic_cast<FTrem *>(object));
+        WriteMeiFTrem(m_currentNode, vrv_cast<FTrem *>(object));
     }
     else if (object->Is(KEYSIG)) {
         m_currentNode = m_currentNode.append_child("keySig");
-        WriteMeiKeySig(m_currentNode, dynamic_cast<KeySig *>(object));
+        WriteMeiKeySig(m_currentNode, vrv_cast<KeySig *>(object));
     }
     else if (object->Is(LIGATURE)) {
         LogError("WriteMeiLigature not implemented. (MeiOutput::WriteObject)");
@@ -356,19 +356,19 @@ bool MeiOutput::WriteObject(Object *object)
     }
     else if (object->Is(MENSUR)) {
         m_currentNode = m_currentNode.append_child("mensur");
-        WriteMeiMensur(m_currentNode, dynamic_cast<Mensur *>(object));
+        WriteMeiMensur(m_currentNode, vrv_cast<Mensur *>(object));
     }
     else if (object->Is(METERSIG)) {
         m_currentNode = m_currentNode.append_child("meterSig");
-        WriteMeiMeterSig(m_currentNode, dynamic_cast<MeterSig *>(object));
+        WriteMeiMeterSig(m_currentNode, vrv_cast<MeterSig *>(object));
     }
     else if (object->Is(MREST)) {
         m_currentNode = m_currentNode.append_child("mRest");
-        WriteMeiMRest(m_currentNode, dynamic_cast<MRest *>(object));
+        WriteMeiMRest(m_currentNode, vrv_cast<MRest *>(object));
     }
     else if (object->Is(MRPT)) {
         m_currentNode = m_currentNode.append_child("mRpt");
-        WriteMeiMRpt(m_currentNode, dynamic_cast<MRpt *>(object));
+        WriteMeiMRpt(m_currentNode, vrv_cast<MRpt *>(object));
     }
     else if (object->Is(MRPT2)) {
         m_currentNode = m_currentNode.append_child("mRpt2");
@@ -376,39 +376,39 @@ bool MeiOutput::WriteObject(Object *object)
     }
     else if (object->Is(MULTIREST)) {
         m_currentNode = m_currentNode.append_child("multiRest");
-        WriteMeiMultiRest(m_currentNode, dynamic_cast<MultiRest *>(object));
+        WriteMeiMultiRest(m_currentNode, vrv_cast<MultiRest *>(object));
     }
     else if (object->Is(MULTIRPT)) {
         m_currentNode = m_currentNode.append_child("multiRpt");
-        WriteMeiMultiRpt(m_currentNode, dynamic_cast<MultiRpt *>(object));
+        WriteMeiMultiRpt(m_currentNode, vrv_cast<MultiRpt *>(object));
     }
     else if (object->Is(NOTE)) {
         m_currentNode = m_currentNode.append_child("note");
-        WriteMeiNote(m_currentNode, dynamic_cast<Note *>(object));
+        WriteMeiNote(m_currentNode, vrv_cast<Note *>(object));
     }
     else if (object->Is(PROPORT)) {
         m_currentNode = m_currentNode.append_child("proport");
-        WriteMeiProport(m_currentNode, dynamic_cast<Proport *>(object));
+        WriteMeiProport(m_currentNode, vrv_cast<Proport *>(object));
     }
     else if (object->Is(REST)) {
         m_currentNode = m_currentNode.append_child("rest");
-        WriteMeiRest(m_currentNode, dynamic_cast<Rest *>(object));
+        WriteMeiRest(m_currentNode, vrv_cast<Rest *>(object));
     }
     else if (object->Is(SPACE)) {
         m_currentNode = m_currentNode.append_child("space");
-        WriteMeiSpace(m_currentNode, dynamic_cast<Space *>(object));
+        WriteMeiSpace(m_currentNode, vrv_cast<Space *>(object));
     }
     else if (object->Is(SYL)) {
         m_currentNode = m_currentNode.append_child("syl");
-        WriteMeiSyl(m_currentNode, dynamic_cast<Syl *>(object));
+        WriteMeiSyl(m_currentNode, vrv_cast<Syl *>(object));
     }
     else if (object->Is(TUPLET)) {
         m_currentNode = m_currentNode.append_child("tuplet");
-        WriteMeiTuplet(m_currentNode, dynamic_cast<Tuplet *>(object));
+        WriteMeiTuplet(m_currentNode, vrv_cast<Tuplet *>(object));
     }
     else if (object->Is(VERSE)) {
         m_currentNode = m_currentNode.append_child("verse");
-        WriteMeiVerse(m_currentNode, dynamic_cast<Verse *>(object));
+        WriteMeiVerse(m_currentNode, vrv_cast<Verse *>(object));
     }
 
     // Text elements
@@ -418,84 +418,84 @@ bool MeiOutput::WriteObject(Object *object)
     }
     else if (object->Is(FB)) {
         m_currentNode = m_currentNode.append_child("fb");
-        WriteMeiFb(m_currentNode, dynamic_cast<Fb *>(object));
+        WriteMeiFb(m_currentNode, vrv_cast<Fb *>(object));
     }
     else if (object->Is(REND)) {
         m_currentNode = m_currentNode.append_child("rend");
-        WriteMeiRend(m_currentNode, dynamic_cast<Rend *>(object));
+        WriteMeiRend(m_currentNode, vrv_cast<Rend *>(object));
     }
     else if (object->Is(TEXT)) {
-        WriteMeiText(m_currentNode, dynamic_cast<Text *>(object));
+        WriteMeiText(m_currentNode, vrv_cast<Text *>(object));
     }
 
     // Editorial markup
     else if (object->Is(ABBR)) {
         m_currentNode = m_currentNode.append_child("abbr");
-        WriteMeiAbbr(m_currentNode, dynamic_cast<Abbr *>(object));
+        WriteMeiAbbr(m_currentNode, vrv_cast<Abbr *>(object));
     }
     else if (object->Is(ADD)) {
         m_currentNode = m_currentNode.append_child("add");
-        WriteMeiAdd(m_currentNode, dynamic_cast<Add *>(object));
+        WriteMeiAdd(m_currentNode, vrv_cast<Add *>(object));
     }
     else if (object->Is(ANNOT)) {
         m_currentNode = m_currentNode.append_child("annot");
-        WriteMeiAnnot(m_currentNode, dynamic_cast<Annot *>(object));
+        WriteMeiAnnot(m_currentNode, vrv_cast<Annot *>(object));
     }
     else if (object->Is(APP)) {
         m_currentNode = m_currentNode.append_child("app");
-        WriteMeiApp(m_currentNode, dynamic_cast<App *>(object));
+        WriteMeiApp(m_currentNode, vrv_cast<App *>(object));
     }
     else if (object->Is(CHOICE)) {
         m_currentNode = m_currentNode.append_child("choice");
-        WriteMeiChoice(m_currentNode, dynamic_cast<Choice *>(object));
+        WriteMeiChoice(m_currentNode, vrv_cast<Choice *>(object));
     }
     else if (object->Is(CORR)) {
         m_currentNode = m_currentNode.append_child("corr");
-        WriteMeiCorr(m_currentNode, dynamic_cast<Corr *>(object));
+        WriteMeiCorr(m_currentNode, vrv_cast<Corr *>(object));
     }
     else if (object->Is(DAMAGE)) {
         m_currentNode = m_currentNode.append_child("damage");
-        WriteMeiDamage(m_currentNode, dynamic_cast<Damage *>(object));
+        WriteMeiDamage(m_currentNode, vrv_cast<Damage *>(object));
     }
     else if (object->Is(DEL)) {
         m_currentNode = m_currentNode.append_child("del");
-        WriteMeiDel(m_currentNode, dynamic_cast<Del *>(object));
+        WriteMeiDel(m_currentNode, vrv_cast<Del *>(object));
     }
     else if (object->Is(EXPAN)) {
         m_currentNode = m_currentNode.append_child("epxan");
-        WriteMeiExpan(m_currentNode, dynamic_cast<Expan *>(object));
+        WriteMeiExpan(m_currentNode, vrv_cast<Expan *>(object));
     }
     else if (object->Is(LEM)) {
         m_currentNode = m_currentNode.append_child("lem");
-        WriteMeiLem(m_currentNode, dynamic_cast<Lem *>(object));
+        WriteMeiLem(m_currentNode, vrv_cast<Lem *>(object));
     }
     else if (object->Is(ORIG)) {
         m_currentNode = m_currentNode.append_child("orig");
-        WriteMeiOrig(m_currentNode, dynamic_cast<Orig *>(object));
+        WriteMeiOrig(m_currentNode, vrv_cast<Orig *>(object));
     }
     else if (object->Is(RDG)) {
         m_currentNode = m_currentNode.append_child("rdg");
-        WriteMeiRdg(m_currentNode, dynamic_cast<Rdg *>(object));
+        WriteMeiRdg(m_currentNode, vrv_cast<Rdg *>(object));
     }
     else if (object->Is(REG)) {
         m_currentNode = m_currentNode.append_child("reg");
-        WriteMeiReg(m_currentNode, dynamic_cast<Reg *>(object));
+        WriteMeiReg(m_currentNode, vrv_cast<Reg *>(object));
     }
     else if (object->Is(RESTORE)) {
         m_currentNode = m_currentNode.append_child("restore");
-        WriteMeiRestore(m_currentNode, dynamic_cast<Restore *>(object));
+        WriteMeiRestore(m_currentNode, vrv_cast<Restore *>(object));
     }
     else if (object->Is(SIC)) {
         m_currentNode = m_currentNode.append_child("sic");
-        WriteMeiSic(m_currentNode, dynamic_cast<Sic *>(object));
+        WriteMeiSic(m_currentNode, vrv_cast<Sic *>(object));
     }
     else if (object->Is(SUPPLIED)) {
         m_currentNode = m_currentNode.append_child("supplied");
-        WriteMeiSupplied(m_currentNode, dynamic_cast<Supplied *>(object));
+        WriteMeiSupplied(m_currentNode, vrv_cast<Supplied *>(object));
     }
     else if (object->Is(UNCLEAR)) {
         m_currentNode = m_currentNode.append_child("unclear");
-        WriteMeiUnclear(m_currentNode, dynamic_cast<Unclear *>(object));
+        WriteMeiUnclear(m_currentNode, vrv_cast<Unclear *>(object));
     }
 
     // BoundaryEnd - nothing to add - only
@@ -1573,6 +1573,119 @@ std::string MeiOutput::DocTypeToStr(DocType type)
     return value;
 }
 
+//----------------------------------------------------------------------------
+// MeiChildQuery
+//----------------------------------------------------------------------------
+
+MeiChildQuery::MeiChildQuery(const std::string &query)
+{
+    m_query = query;
+    m_isSimple = ParseSimpleQuery(query);
+    if (m_isSimple) return;
+
+    try {
+        m_xPathQuery = pugi::xpath_query(query.c_str());
+    }
+    catch (pugi::xpath_exception &e) {
+        LogError("The xpath query '%s' could not be compiled: %s", query.c_str(), e.what());
+        return;
+    }
+    if (m_xPathQuery.return_type() != pugi::xpath_type_node_set) {
+        LogError("The xpath query '%s' does not select nodes", query.c_str());
+        m_xPathQuery = pugi::xpath_query();
+    }
+}
+
+bool MeiChildQuery::ParseSimpleQuery(const std::string &query)
+{
+    size_t pos = 0;
+    auto skipSpaces = [&query, &pos]() {
+        while ((pos < query.size()) && isspace(query.at(pos))) pos++;
+    };
+    auto isNameChar = [](char c) { return (isalnum(c) || (c == '_') || (c == '-') || (c == '.') || (c == ':')); };
+    auto readName = [&query, &pos, &isNameChar]() {
+        size_t start = pos;
+        while ((pos < query.size()) && isNameChar(query.at(pos))) pos++;
+        return query.substr(start, pos - start);
+    };
+    auto readLiteral = [&query, &pos](std::string &literal) {
+        if ((pos >= query.size()) || ((query.at(pos) != '\'') && (query.at(pos) != '"'))) return false;
+        size_t end = query.find(query.at(pos), pos + 1);
+        if (end == std::string::npos) return false;
+        literal = query.substr(pos + 1, end - pos - 1);
+        pos = end + 1;
+        return true;
+    };
+    auto readChar = [&query, &pos, &skipSpaces](char c) {
+        skipSpaces();
+        if ((pos >= query.size()) || (query.at(pos) != c)) return false;
+        pos++;
+        skipSpaces();
+        return true;
+    };
+
+    skipSpaces();
+    if (query.compare(pos, 2, "./") == 0) pos += 2;
+    if ((pos < query.size()) && (query.at(pos) == '*')) {
+        m_name = "*";
+        pos++;
+    }
+    else {
+        m_name = readName();
+        // The name cannot start with a digit or a punctuation character, and axes are left to XPath
+        if (m_name.empty() || !(isalpha(m_name.at(0)) || (m_name.at(0) == '_'))) return false;
+        if (m_name.find("::") != std::string::npos) return false;
+    }
+
+    skipSpaces();
+    while (pos < query.size()) {
+        AttributePredicate predicate;
+        if (!readChar('[')) return false;
+        predicate.m_contains = (query.compare(pos, 8, "contains") == 0);
+        if (predicate.m_contains) {
+            pos += 8;
+            if (!readChar('(')) return false;
+        }
+        if (!readChar('@')) return false;
+        predicate.m_attribute = readName();
+        if (predicate.m_attribute.empty()) return false;
+        if (!readChar(predicate.m_contains ? ',' : '=')) return false;
+        if (!readLiteral(predicate.m_value)) return false;
+        if (predicate.m_contains && !readChar(')')) return false;
+        if (!readChar(']')) return false;
+        m_predicates.push_back(predicate);
+    }
+    return true;
+}
+
+pugi::xml_node MeiChildQuery::Select(pugi::xml_node parent) const
+{
+    if (!m_isSimple) {
+        if (!m_xPathQuery) return pugi::xml_node();
+        return m_xPathQuery.evaluate_node(parent).node();
+    }
+
+    pugi::xml_node child;
+    for (child = parent.first_child(); child; child = child.next_sibling()) {
+        if (child.type() != pugi::node_element) continue;
+        if ((m_name != "*") && (m_name != child.name())) continue;
+        std::vector<AttributePredicate>::const_iterator iter;
+        for (iter = m_predicates.begin(); iter != m_predicates.end(); ++iter) {
+            pugi::xml_attribute attribute = child.attribute(iter->m_attribute.c_str());
+            if (iter->m_contains) {
+                // As in XPath, a missing attribute is an empty string
+                if (std::string(attribute.value()).find(iter->m_value) == std::string::npos) break;
+            }
+            else {
+                // As in XPath, a missing attribute is never equal to a string
+                if (!attribute || (iter->m_value != attribute.value())) break;
+            }
+        }
+        if (iter == m_predicates.end()) return child;
+    }
+    return pugi::xml_node();
+}
+
 //----------------------------------------------------------------------------
 // MeiInput
 //----------------------------------------------------------------------------
@@ -1590,6 +1703,20 @@ MeiInput::~MeiInput()
 {
 }
 
+void MeiInput::SetAppXPathQueries(std::vector<std::string> &xPathQueries)
+{
+    m_appQueries.clear();
+    std::vector<std::string>::iterator iter;
+    for (iter = xPathQueries.begin(); iter != xPathQueries.end(); ++iter) m_appQueries.emplace_back(*iter);
+}
+
+void MeiInput::SetChoiceXPathQueries(std::vector<std::string> &xPathQueries)
+{
+    m_choiceQueries.clear();
+    std::vector<std::string>::iterator iter;
+    for (iter = xPathQueries.begin(); iter != xPathQueries.end(); ++iter) m_choiceQueries.emplace_back(*iter);
+}
+
 bool MeiInput::ImportFile()
 {
     try {
@@ -1609,11 +1736,32 @@ bool MeiInput::ImportFile()
 }
 
 bool MeiInput::ImportString(std::string const &mei)
+{
+    return ImportBuffer(mei.c_str(), mei.size());
+}
+
+bool MeiInput::ImportBuffer(const char *data, size_t length)
+{
+    try {
+        m_doc->SetType(Raw);
+        pugi::xml_document doc;
+        doc.load_buffer(data, length, pugi::parse_default & ~pugi::parse_eol, pugi::encoding_utf8);
+        pugi::xml_node root = doc.first_child();
+        return ReadMei(root);
+    }
+    catch (char *str) {
+        LogError("%s", str);
+        return false;
+    }
+}
+
+bool MeiInput::ImportBufferInPlace(char *data, size_t length)
 {
     try {
         m_doc->SetType(Raw);
         pugi::xml_document doc;
-        doc.load(mei.c_str(), pugi::parse_default & ~pugi::parse_eol);
+        // The document uses the buffer directly and is destroyed before returning
+        doc.load_buffer_inplace(data, length, pugi::parse_default & ~pugi::parse_eol, pugi::encoding_utf8);
         pugi::xml_node root = doc.first_child();
         return ReadMei(root);
     }
@@ -2125,7 +2273,7 @@ bool MeiInput::ReadMeiSystem(Object *parent, pugi::xml_node system)
 
     // This could be moved to an AddSystem method for consistency with AddLayerElement
     if (parent->Is(PAGE)) {
-        Page *page = dynamic_cast<Page *>(parent);
+        Page *page = vrv_cast<Page *>(parent);
         assert(page);
         page->AddChild(vrvSystem);
     }
@@ -2159,7 +2307,7 @@ bool MeiInput::ReadMeiSystemChildren(Object *parent, pugi::xml_node parentNode)
         else if (std::string(current.name()) == "staff") {
             if (!unmeasured) {
                 if (parent->Is(SYSTEM)) {
-                    System *system = dynamic_cast<System *>(parent);
+                    System *system = vrv_cast<System *>(parent);
                     assert(system);
                     unmeasured = new Measure(false);
                     if ((m_doc->GetType() == Transcription) && (m_version == MEI_2013))
@@ -3536,12 +3684,11 @@ bool MeiInput::ReadMeiAppChildren(Object *parent, pugi::xml_node parentNode, Edi
 {
     assert(dynamic_cast<App *>(parent));
 
-    // Check if one child node matches the m_appXPathQuery
+    // Check if one child node matches the m_appQueries
     pugi::xml_node selectedLemOrRdg;
-    if (m_appXPathQueries.size() > 0) {
-        auto i = std::find_if(m_appXPathQueries.begin(), m_appXPathQueries.end(),
-            [parentNode](std::string &query) { return (parentNode.select_single_node(query.c_str())); });
-        if (i != m_appXPathQueries.end()) selectedLemOrRdg = parentNode.select_single_node(i->c_str()).node();
+    std::vector<MeiChildQuery>::const_iterator iter;
+    for (iter = m_appQueries.begin(); iter != m_appQueries.end() && !selectedLemOrRdg; ++iter) {
+        selectedLemOrRdg = iter->Select(parentNode);
     }
 
     bool success = true;
@@ -3600,12 +3747,11 @@ bool MeiInput::ReadMeiChoiceChildren(Object *parent, pugi::xml_node parentNode,
 {
     assert(dynamic_cast<Choice *>(parent));
 
-    // Check if one child node matches a value in m_choiceXPathQueries
+    // Check if one child node matches a value in m_choiceQueries
     pugi::xml_node selectedChild;
-    if (m_choiceXPathQueries.size() > 0) {
-        auto i = std::find_if(m_choiceXPathQueries.begin(), m_choiceXPathQueries.end(),
-            [parentNode](std::string &query) { return (parentNode.select_single_node(query.c_str())); });
-        if (i != m_choiceXPathQueries.end()) selectedChild = parentNode.select_single_node(i->c_str()).node();
+    std::vector<MeiChildQuery>::const_iterator iter;
+    for (iter = m_choiceQueries.begin(); iter != m_choiceQueries.end() && !selectedChild; ++iter) {
+        selectedChild = iter->Select(parentNode);
     }
 
     bool success = true;
@@ -3942,7 +4088,7 @@ bool MeiInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpa
         return false;
     }
 
-    Layer *parentLayer = dynamic_cast<Layer *>(startChild->GetParent());
+    Layer *parentLayer = vrv_cast<Layer *>(startChild->GetParent());
     assert(parentLayer);
 
     int startIdx = startChild->GetIdx();
@@ -3961,12 +4107,13 @@ bool MeiInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpa
 
 void MeiInput::SetMeiUuid(pugi::xml_node element, Object *object)
 {
-    if (!element.attribute("xml:id")) {
+    pugi::xml_attribute uuid = element.attribute("xml:id");
+    if (!uuid) {
         return;
     }
 
-    object->SetUuid(element.attribute("xml:id").value());
-    element.remove_attribute("xml:id");
+    object->SetUuid(uuid.value());
+    element.remove_attribute(uuid);
 }
 
 DocType MeiInput::StrToDocType(std::string type)
@@ -1218,7 +1218,7 @@ void PaeInput::parseNote(pae::Note *note)
     // this case is simpler. NOTE a note can not be acciacctura AND appoggiatura
     // Acciaccatura rests do not exist
     if (note->acciaccatura && (element->Is(NOTE))) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         mnote->SetDur(DURATION_8);
         mnote->SetGrace(GRACE_acc);
@@ -1226,7 +1226,7 @@ void PaeInput::parseNote(pae::Note *note)
     }
 
     if ((note->appoggiatura > 0) && (element->Is(NOTE))) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         mnote->SetGrace(GRACE_unacc);
         mnote->SetStemDir(STEMDIRECTION_up);
@@ -1251,7 +1251,7 @@ void PaeInput::parseNote(pae::Note *note)
 
     // note in a chord
     if (note->chord) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         // first note?
         if (!m_is_in_chord) {
@@ -1281,7 +1281,7 @@ void PaeInput::parseNote(pae::Note *note)
 
     // last note of a chord
     if (!note->chord && m_is_in_chord) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         mnote->SetDots(0);
         mnote->SetDur(DURATION_NONE);
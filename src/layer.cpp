@@ -128,6 +128,7 @@ void Layer::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -144,14 +145,14 @@ LayerElement *Layer::GetAtPos(int x)
     Object *first = this->GetFirst();
     if (!first || !first->IsLayerElement()) return NULL;
 
-    LayerElement *element = dynamic_cast<LayerElement *>(first);
+    LayerElement *element = vrv_cast<LayerElement *>(first);
     assert(element);
     if (element->GetDrawingX() > x) return NULL;
 
     Object *next;
     while ((next = this->GetNext())) {
         if (!next->IsLayerElement()) continue;
-        LayerElement *nextLayerElement = dynamic_cast<LayerElement *>(next);
+        LayerElement *nextLayerElement = vrv_cast<LayerElement *>(next);
         assert(nextLayerElement);
         if (nextLayerElement->GetDrawingX() > x) return element;
         element = nextLayerElement;
@@ -175,7 +176,7 @@ Clef *Layer::GetClef(LayerElement *test)
     }
 
     if (testObject && testObject->Is(CLEF)) {
-        Clef *clef = dynamic_cast<Clef *>(testObject);
+        Clef *clef = vrv_cast<Clef *>(testObject);
         assert(clef);
         return clef;
     }
@@ -192,28 +193,28 @@ int Layer::GetClefLocOffset(LayerElement *test)
 
 Clef *Layer::GetCurrentClef() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef && staff->m_drawingStaffDef->GetCurrentClef());
     return staff->m_drawingStaffDef->GetCurrentClef();
 }
 
 KeySig *Layer::GetCurrentKeySig() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentKeySig();
 }
 
 Mensur *Layer::GetCurrentMensur() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentMensur();
 }
 
 MeterSig *Layer::GetCurrentMeterSig() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentMeterSig();
 }
@@ -297,7 +298,7 @@ int Layer::UnsetCurrentScoreDef(FunctorParams *functorParams)
 
 int Layer::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_currentMensur = GetCurrentMensur();
@@ -335,7 +336,7 @@ int Layer::AlignHorizontally(FunctorParams *functorParams)
 
 int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_scoreDefRole = CAUTIONARY_SCOREDEF;
@@ -358,7 +359,7 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
     int i;
     for (i = 0; i < params->m_measureAligner->GetChildCount(); i++) {
-        Alignment *alignment = dynamic_cast<Alignment *>(params->m_measureAligner->GetChild(i));
+        Alignment *alignment = vrv_cast<Alignment *>(params->m_measureAligner->GetChild(i));
         assert(alignment);
         if (alignment->HasGraceAligner()) {
             alignment->GetGraceAligner()->AlignStack();
@@ -370,22 +371,28 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
 int Layer::PrepareProcessingLists(FunctorParams *functorParams)
 {
-    PrepareProcessingListsParams *params = dynamic_cast<PrepareProcessingListsParams *>(functorParams);
+    PrepareProcessingListsParams *params = vrv_cast<PrepareProcessingListsParams *>(functorParams);
     assert(params);
 
     // Alternate solution with StaffN_LayerN_VerseN_t
     // StaffN_LayerN_VerseN_t *tree = static_cast<StaffN_LayerN_VerseN_t*>((*params).at(0));
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
     params->m_layerTree.child[staff->GetN()].child[this->GetN()];
 
+    // Keep the staves of the staff/layer so it can be processed without going through the entire document
+    ArrayOfObjects *staves = &params->m_layerStaves[std::make_pair(staff->GetN(), this->GetN())];
+    if (staves->empty() || (staves->back() != staff)) {
+        staves->push_back(staff);
+    }
+
     return FUNCTOR_CONTINUE;
 }
 
 int Layer::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
     // If we have encountered a mRpt before and there is none is this layer, reset it to NULL
@@ -397,7 +404,7 @@ int Layer::PrepareRpt(FunctorParams *functorParams)
 
 int Layer::AdjustSylSpacing(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     // reset it
@@ -407,9 +414,36 @@ int Layer::AdjustSylSpacing(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Layer::GenerateMIDI(FunctorParams *functorParams)
+{
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
+    assert(params);
+
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
+    assert(staff);
+
+    // The state of each staff/layer is set in Doc::ExportMIDI from the processing lists
+    std::map<std::pair<int, int>, MIDILayerTrack>::iterator iter
+        = params->m_layerTracks.find(std::make_pair(staff->GetN(), this->GetN()));
+    assert(iter != params->m_layerTracks.end());
+    params->m_currentLayerTrack = (iter != params->m_layerTracks.end()) ? &iter->second : NULL;
+
+    return FUNCTOR_CONTINUE;
+}
+
+int Layer::GenerateMIDIEnd(FunctorParams *functorParams)
+{
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
+    assert(params);
+
+    params->m_currentLayerTrack = NULL;
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Layer::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     // reset it
@@ -142,10 +142,10 @@ bool LayerElement::IsGraceNote()
     // For accid, artic, etc.. look at the parent note / chord
     else {
         // For an accid we expect to be the child of a note - the note will lookup at the chord parent in necessary
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE, MAX_ACCID_DEPTH));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE, MAX_ACCID_DEPTH));
         if (note) return note->IsGraceNote();
         // For an artic we can be direct child of a chord
-        Chord *chord = dynamic_cast<Chord *>(this->GetFirstParent(CHORD, MAX_ACCID_DEPTH));
+        Chord *chord = vrv_cast<Chord *>(this->GetFirstParent(CHORD, MAX_ACCID_DEPTH));
         if (chord) return chord->IsGraceNote();
     }
     return false;
@@ -168,10 +168,16 @@ bool LayerElement::IsInFTrem()
     return (this->GetFirstParent(FTREM, MAX_FTREM_DEPTH));
 }
 
+bool LayerElement::IsTimePointingTarget()
+{
+    // Do not look for tstamp pointing to these
+    return (!this->Is({ ARTIC, ARTIC_PART, BEAM, FLAG, TUPLET, STEM, VERSE }));
+}
+
 Beam *LayerElement::IsInBeam()
 {
     if (!this->Is(NOTE) && !this->Is(CHORD)) return NULL;
-    Beam *beamParent = dynamic_cast<Beam *>(this->GetFirstParent(BEAM, MAX_BEAM_DEPTH));
+    Beam *beamParent = vrv_cast<Beam *>(this->GetFirstParent(BEAM, MAX_BEAM_DEPTH));
     if (beamParent != NULL) {
         // This note is beamed and cue-sized
         if (this->IsGraceNote()) {
@@ -282,7 +288,7 @@ int LayerElement::GetDrawingArticulationTopOrBottom(data_STAFFREL place, ArticPa
     ArticPart *lastArticPart = NULL;
 
     // We limit support to two artic elements, get them by searching in both directions
-    Artic *firstArtic = dynamic_cast<Artic *>(this->FindChildByType(ARTIC));
+    Artic *firstArtic = vrv_cast<Artic *>(this->FindChildByType(ARTIC));
     Artic *lastArtic = dynamic_cast<Artic *>(this->FindChildByType(ARTIC, MAX_ACCID_DEPTH, BACKWARD));
     // If they are the same (we have only one artic child), then ignore the second one
     if (firstArtic == lastArtic) lastArtic = NULL;
@@ -334,7 +340,7 @@ void LayerElement::CenterDrawingX()
 
     SetDrawingXRel(0);
 
-    Measure *measure = dynamic_cast<Measure *>(this->GetFirstParent(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->GetFirstParent(MEASURE));
     assert(measure);
 
     SetDrawingXRel(measure->GetInnerCenterX() - this->GetDrawingX());
@@ -352,7 +358,7 @@ int LayerElement::GetDrawingTop(Doc *doc, int staffSize, bool withArtic, ArticPa
         if (durationInterface->GetNoteOrChordDur(this) < DUR_2) {
             if (this->Is(CHORD)) {
                 int yChordMax = 0, yChordMin = 0;
-                Chord *chord = dynamic_cast<Chord *>(this);
+                Chord *chord = vrv_cast<Chord *>(this);
                 assert(chord);
                 chord->GetYExtremes(yChordMax, yChordMin);
                 return yChordMax + doc->GetDrawingUnit(staffSize);
@@ -385,7 +391,7 @@ int LayerElement::GetDrawingBottom(Doc *doc, int staffSize, bool withArtic, Arti
         if (durationInterface->GetNoteOrChordDur(this) < DUR_2) {
             if (this->Is(CHORD)) {
                 int yChordMax = 0, yChordMin = 0;
-                Chord *chord = dynamic_cast<Chord *>(this);
+                Chord *chord = vrv_cast<Chord *>(this);
                 assert(chord);
                 chord->GetYExtremes(yChordMax, yChordMin);
                 return yChordMin - doc->GetDrawingUnit(staffSize);
@@ -415,7 +421,7 @@ double LayerElement::GetAlignmentDuration(Mensur *mensur, MeterSig *meterSig, bo
     if (this->HasInterface(INTERFACE_DURATION)) {
         int num = 1;
         int numbase = 1;
-        Tuplet *tuplet = dynamic_cast<Tuplet *>(this->GetFirstParent(TUPLET, MAX_TUPLET_DEPTH));
+        Tuplet *tuplet = vrv_cast<Tuplet *>(this->GetFirstParent(TUPLET, MAX_TUPLET_DEPTH));
         if (tuplet) {
             num = tuplet->GetNum();
             numbase = tuplet->GetNumbase();
@@ -430,21 +436,21 @@ double LayerElement::GetAlignmentDuration(Mensur *mensur, MeterSig *meterSig, bo
         }
         double durationValue = duration->GetInterfaceAlignmentDuration(num, numbase);
         // With fTrem we need to divide the duration by two
-        FTrem *fTrem = dynamic_cast<FTrem *>(this->GetFirstParent(FTREM, MAX_FTREM_DEPTH));
+        FTrem *fTrem = vrv_cast<FTrem *>(this->GetFirstParent(FTREM, MAX_FTREM_DEPTH));
         if (fTrem) {
             durationValue /= 2.0;
         }
         return durationValue;
     }
     else if (this->Is(BEATRPT)) {
-        BeatRpt *beatRpt = dynamic_cast<BeatRpt *>(this);
+        BeatRpt *beatRpt = vrv_cast<BeatRpt *>(this);
         assert(beatRpt);
         int meterUnit = 4;
         if (meterSig && meterSig->HasUnit()) meterSig->GetUnit();
         return beatRpt->GetBeatRptAlignmentDuration(meterUnit);
     }
     else if (this->Is(TIMESTAMP_ATTR)) {
-        TimestampAttr *timestampAttr = dynamic_cast<TimestampAttr *>(this);
+        TimestampAttr *timestampAttr = vrv_cast<TimestampAttr *>(this);
         assert(timestampAttr);
         int meterUnit = 4;
         if (meterSig && meterSig->HasUnit()) meterUnit = meterSig->GetUnit();
@@ -490,7 +496,7 @@ int LayerElement::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int LayerElement::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_xAbs != VRV_UNSET) m_xAbs /= params->m_page->GetPPUFactor();
@@ -500,7 +506,7 @@ int LayerElement::ApplyPPUFactor(FunctorParams *functorParams)
 
 int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     assert(!m_alignment);
@@ -509,9 +515,9 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 
     AlignmentType type = ALIGNMENT_DEFAULT;
 
-    Chord *chordParent = dynamic_cast<Chord *>(this->GetFirstParent(CHORD, MAX_CHORD_DEPTH));
-    Note *noteParent = dynamic_cast<Note *>(this->GetFirstParent(NOTE, MAX_NOTE_DEPTH));
-    Rest *restParent = dynamic_cast<Rest *>(this->GetFirstParent(REST, MAX_NOTE_DEPTH));
+    Chord *chordParent = vrv_cast<Chord *>(this->GetFirstParent(CHORD, MAX_CHORD_DEPTH));
+    Note *noteParent = vrv_cast<Note *>(this->GetFirstParent(NOTE, MAX_NOTE_DEPTH));
+    Rest *restParent = vrv_cast<Rest *>(this->GetFirstParent(REST, MAX_NOTE_DEPTH));
 
     if (chordParent) {
         m_alignment = chordParent->GetAlignment();
@@ -595,13 +601,13 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     }
     else if (this->Is({ ARTIC, ARTIC_PART, SYL })) {
         // Refer to the note parent
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
     }
     else if (this->Is(VERSE)) {
         // Idem
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
     }
@@ -654,13 +660,13 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 
 int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 {
-    SetAlignmentPitchPosParams *params = dynamic_cast<SetAlignmentPitchPosParams *>(functorParams);
+    SetAlignmentPitchPosParams *params = vrv_cast<SetAlignmentPitchPosParams *>(functorParams);
     assert(params);
 
     LayerElement *layerElementY = this;
-    Staff *staffY = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staffY = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staffY);
-    Layer *layerY = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layerY = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layerY);
 
     if (m_crossStaff && m_crossLayer) {
@@ -671,9 +677,9 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 
     // Adjust m_drawingYRel for notes and rests, etc.
     if (this->Is(ACCID)) {
-        Accid *accid = dynamic_cast<Accid *>(this);
+        Accid *accid = vrv_cast<Accid *>(this);
         assert(accid);
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         // We should probably also avoid to add editorial accidentals to the accid space
         // However, since they are placed above by View::DrawNote it works without avoiding it
         if (note) {
@@ -689,7 +695,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
     }
     else if (this->Is(CHORD)) {
         // The y position is set to the top note one
-        Chord *chord = dynamic_cast<Chord *>(this);
+        Chord *chord = vrv_cast<Chord *>(this);
         assert(chord);
         Note *note = chord->GetTopNote();
         assert(note);
@@ -705,7 +711,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         this->SetDrawingYRel(staffY->CalcPitchPosYRel(params->m_doc, interface->CalcDrawingLoc(layerY, layerElementY)));
     }
     else if (this->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
         Chord *chord = note->IsChordTone();
         int loc = 0;
@@ -725,7 +731,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         this->SetDrawingYRel(yRel);
     }
     else if (this->Is(MREST)) {
-        MRest *mRest = dynamic_cast<MRest *>(this);
+        MRest *mRest = vrv_cast<MRest *>(this);
         assert(mRest);
         int loc = 0;
         if (mRest->HasLoc()) {
@@ -734,14 +740,14 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
             assert(staff);
             loc = staff->m_drawingLines - 1;
             // Limitation: GetLayerCount does not take into account editorial markup
             // should be refined later
             bool hasMultipleLayer = (staffY->GetLayerCount() > 1);
             if (hasMultipleLayer) {
-                Layer *firstLayer = dynamic_cast<Layer *>(staffY->FindChildByType(LAYER));
+                Layer *firstLayer = vrv_cast<Layer *>(staffY->FindChildByType(LAYER));
                 assert(firstLayer);
                 if (firstLayer->GetN() == layerY->GetN())
                     loc += 2;
@@ -759,7 +765,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
     }
 
     else if (this->Is(REST)) {
-        Rest *rest = dynamic_cast<Rest *>(this);
+        Rest *rest = vrv_cast<Rest *>(this);
         assert(rest);
         int loc = 0;
         if (rest->HasPloc() && rest->HasOloc()) {
@@ -771,14 +777,14 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
             assert(staff);
             loc = staff->m_drawingLines - 1;
             // Limitation: GetLayerCount does not take into account editorial markup
             // should be refined later
             bool hasMultipleLayer = (staffY->GetLayerCount() > 1);
             if (hasMultipleLayer) {
-                Layer *firstLayer = dynamic_cast<Layer *>(staffY->FindChildByType(LAYER));
+                Layer *firstLayer = vrv_cast<Layer *>(staffY->FindChildByType(LAYER));
                 assert(firstLayer);
                 if (firstLayer->GetN() == layerY->GetN())
                     loc += 2;
@@ -796,7 +802,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 
 int LayerElement::AdjustLayers(FunctorParams *functorParams)
 {
-    AdjustLayersParams *params = dynamic_cast<AdjustLayersParams *>(functorParams);
+    AdjustLayersParams *params = vrv_cast<AdjustLayersParams *>(functorParams);
     assert(params);
 
     // Check if we are starting a new layer content - if yes copy the current elements to previous
@@ -816,19 +822,19 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
     if (params->m_previous.empty()) return FUNCTOR_SIBLINGS;
 
     if (this->Is(NOTE)) {
-        params->m_currentNote = dynamic_cast<Note *>(this);
+        params->m_currentNote = vrv_cast<Note *>(this);
         assert(params->m_currentNote);
         if (!params->m_currentNote->IsChordTone()) params->m_currentChord = NULL;
     }
     else if (this->Is(CHORD)) {
-        params->m_currentChord = dynamic_cast<Chord *>(this);
+        params->m_currentChord = vrv_cast<Chord *>(this);
         assert(params->m_currentChord);
     }
 
     // Eventually we also want to have stem for overlapping voices
     if (this->Is({ NOTE, DOTS })) {
 
-        Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
         assert(staff);
 
         std::vector<LayerElement *>::iterator iter;
@@ -839,7 +845,7 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
 
             if (this->Is(NOTE) && (*iter)->Is(NOTE)) {
                 assert(params->m_currentNote);
-                Note *previousNote = dynamic_cast<Note *>(*iter);
+                Note *previousNote = vrv_cast<Note *>(*iter);
                 assert(previousNote);
                 // Unisson, look at the duration for the note heads
                 if (params->m_currentNote->IsUnissonWith(previousNote, false)) {
@@ -880,7 +886,7 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
 
 int LayerElement::AdjustGraceXPos(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     if (params->m_graceCumulatedXShift == VRV_UNSET) params->m_graceCumulatedXShift = 0;
@@ -917,7 +923,7 @@ int LayerElement::AdjustGraceXPos(FunctorParams *functorParams)
 
 int LayerElement::AdjustXPos(FunctorParams *functorParams)
 {
-    AdjustXPosParams *params = dynamic_cast<AdjustXPosParams *>(functorParams);
+    AdjustXPosParams *params = vrv_cast<AdjustXPosParams *>(functorParams);
     assert(params);
 
     // we should have processed aligned before
@@ -1007,21 +1013,21 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
     }
     // For accid, look at the parent if @func="edit" or otherwise to the parent note
     else if (this->Is(ACCID)) {
-        Accid const *accid = dynamic_cast<Accid *>(this);
+        Accid const *accid = vrv_cast<Accid *>(this);
         assert(accid);
         if (accid->GetFunc() == accidLog_FUNC_edit)
             m_drawingCueSize = true;
         else {
-            Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE, MAX_ACCID_DEPTH));
+            Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE, MAX_ACCID_DEPTH));
             if (note) m_drawingCueSize = note->IsCueSize();
         }
     }
     else if (this->Is({ DOTS, FLAG, STEM })) {
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE, MAX_NOTE_DEPTH));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE, MAX_NOTE_DEPTH));
         if (note)
             m_drawingCueSize = note->IsCueSize();
         else {
-            Chord *chord = dynamic_cast<Chord *>(this->GetFirstParent(CHORD, MAX_CHORD_DEPTH));
+            Chord *chord = vrv_cast<Chord *>(this->GetFirstParent(CHORD, MAX_CHORD_DEPTH));
             if (chord) m_drawingCueSize = chord->IsCueSize();
         }
     }
@@ -1031,7 +1037,7 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
 
 int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     m_crossStaff = NULL;
@@ -1061,7 +1067,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *parentStaff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *parentStaff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(parentStaff);
     // Check if we have a cross-staff to itself...
     if (m_crossStaff == parentStaff) {
@@ -1071,7 +1077,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Layer *parentLayer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *parentLayer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(parentLayer);
     // Now try to get the corresponding layer - for now look for the same layer @n
     int layerN = parentLayer->GetN();
@@ -1081,7 +1087,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
     m_crossLayer = dynamic_cast<Layer *>(m_crossStaff->FindChildByAttComparison(&comparisonFirstLayer, 1));
     if (!m_crossLayer) {
         // Just try to pick the first one...
-        m_crossLayer = dynamic_cast<Layer *>(m_crossStaff->FindChildByType(LAYER));
+        m_crossLayer = vrv_cast<Layer *>(m_crossStaff->FindChildByType(LAYER));
     }
     if (!m_crossLayer) {
         // Nothing we can do
@@ -1098,7 +1104,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
 
 int LayerElement::PrepareCrossStaffEnd(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     DurationInterface *durElement = this->GetDurationInterface();
@@ -1117,11 +1123,10 @@ int LayerElement::PrepareCrossStaffEnd(FunctorParams *functorParams)
 
 int LayerElement::PrepareTimePointing(FunctorParams *functorParams)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimePointingParams *params = vrv_cast<PrepareTimePointingParams *>(functorParams);
     assert(params);
 
-    // Do not look for tstamp pointing to these
-    if (this->Is({ ARTIC, ARTIC_PART, BEAM, FLAG, TUPLET, STEM, VERSE })) return FUNCTOR_CONTINUE;
+    if (!this->IsTimePointingTarget()) return FUNCTOR_CONTINUE;
 
     ArrayOfPointingInterClassIdPairs::iterator iter = params->m_timePointingInterfaces.begin();
     while (iter != params->m_timePointingInterfaces.end()) {
@@ -1139,11 +1144,10 @@ int LayerElement::PrepareTimePointing(FunctorParams *functorParams)
 
 int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
-    // Do not look for tstamp pointing to these
-    if (this->Is({ ARTIC, ARTIC_PART, BEAM, FLAG, TUPLET, STEM, VERSE })) return FUNCTOR_CONTINUE;
+    if (!this->IsTimePointingTarget()) return FUNCTOR_CONTINUE;
 
     ArrayOfSpanningInterClassIdPairs::iterator iter = params->m_timeSpanningInterfaces.begin();
     while (iter != params->m_timeSpanningInterfaces.end()) {
@@ -1161,7 +1165,7 @@ int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
 
 int LayerElement::FindTimeSpanningLayerElements(FunctorParams *functorParams)
 {
-    FindTimeSpanningLayerElementsParams *params = dynamic_cast<FindTimeSpanningLayerElementsParams *>(functorParams);
+    FindTimeSpanningLayerElementsParams *params = vrv_cast<FindTimeSpanningLayerElementsParams *>(functorParams);
     assert(params);
 
     if ((this->GetDrawingX() > params->m_minPos) && (this->GetDrawingX() < params->m_maxPos)) {
@@ -1176,19 +1180,22 @@ int LayerElement::FindTimeSpanningLayerElements(FunctorParams *functorParams)
 
 int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     // Here we need to check if the LayerElement has a duration, otherwise we can continue
     if (!this->HasInterface(INTERFACE_DURATION)) return FUNCTOR_CONTINUE;
 
+    MIDILayerTrack *layerTrack = params->m_currentLayerTrack;
+    if (!layerTrack) return FUNCTOR_CONTINUE;
+
     // Now deal with the different elements
     if (this->Is(REST)) {
         // increase the currentTime accordingly
-        params->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+        layerTrack->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
     }
     else if (this->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
 
         // For now just ignore grace notes
@@ -1251,48 +1258,49 @@ int LayerElement::GenerateMIDI(FunctorParams *functorParams)
         }
 
         // Adjustment for transposition intruments
-        midiBase += params->m_transSemi;
+        midiBase += layerTrack->m_transSemi;
 
         int oct = note->GetOct();
         if (note->HasOctGes()) oct = note->GetOctGes();
 
         int pitch = midiBase + (oct + 1) * 12;
-        int channel = 0;
-        int velocity = 64;
-        params->m_midiFile->addNoteOn(
-            params->m_midiTrack, params->m_totalTime + params->m_currentMeasureTime, channel, pitch, velocity);
-        params->m_midiFile->addNoteOff(
-            params->m_midiTrack, params->m_totalTime + params->m_currentMeasureTime + dur, channel, pitch);
+        // The notes are added to the MidiFile in Doc::ExportMIDI
+        MIDILayerTrack::MIDINote midiNote;
+        midiNote.m_pitch = pitch;
+        midiNote.m_onset = params->m_totalTime + layerTrack->m_currentMeasureTime;
+        midiNote.m_offset = params->m_totalTime + layerTrack->m_currentMeasureTime + dur;
+        layerTrack->m_notes.push_back(midiNote);
 
-        note->m_playingOnset = params->m_totalTime + params->m_currentMeasureTime;
-        note->m_playingOffset = params->m_totalTime + params->m_currentMeasureTime + dur;
+        note->m_playingOnset = params->m_totalTime + layerTrack->m_currentMeasureTime;
+        note->m_playingOffset = params->m_totalTime + layerTrack->m_currentMeasureTime + dur;
 
         // increase the currentTime accordingly, but only if not in a chord - checkit with note->IsChordTone()
         if (!(note->IsChordTone())) {
-            params->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+            layerTrack->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
         }
     }
     else if (this->Is(SPACE)) {
-        // Space *space = dynamic_cast<Space *>(this);
+        // Space *space = vrv_cast<Space *>(this);
         // assert(space);
         // LogMessage("Space %f", GetAlignmentDuration());
         // increase the currentTime accordingly
-        params->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+        layerTrack->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
     }
     return FUNCTOR_CONTINUE;
 }
 
 int LayerElement::GenerateMIDIEnd(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
-    if (this->Is(CHORD)) {
+    if (this->Is(CHORD) && params->m_currentLayerTrack) {
         // Chord *chord = dynamic_cast<Chord *>(this);
         // assert(chord);
         // LogMessage("Chord %f", GetAlignmentDuration());
         // increase the currentTime accordingly.
-        params->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+        params->m_currentLayerTrack->m_currentMeasureTime
+            += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
     }
 
     return FUNCTOR_CONTINUE;
@@ -1300,14 +1308,14 @@ int LayerElement::GenerateMIDIEnd(FunctorParams *functorParams)
 
 int LayerElement::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     // Here we need to check if the LayerElement as a duration, otherwise we can continue
     if (!this->HasInterface(INTERFACE_DURATION)) return FUNCTOR_CONTINUE;
 
     if (this->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
 
         // For now just ignore grace notes
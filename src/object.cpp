@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <iostream>
 #include <math.h>
+#include <random>
 #include <sstream>
 
 //----------------------------------------------------------------------------
@@ -45,22 +46,20 @@ namespace vrv {
 // Object
 //----------------------------------------------------------------------------
 
-unsigned long Object::s_objectCounter = 0;
+// The random number generator for the uuids of a thread when none is selected, seeded on first use
+static thread_local std::minstd_rand s_defaultUuidGenerator(std::random_device{}());
+// The random number generator selected for the uuids of a thread (usually the one of a Doc)
+static thread_local std::minstd_rand *s_currentUuidGenerator = NULL;
 
 Object::Object() : BoundingBox()
 {
-    Init("m-");
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
+    // The layout objects (aligners and alignments) have no classid and no uuid
+    Init("");
 }
 
 Object::Object(std::string classid) : BoundingBox()
 {
     Init(classid);
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
 Object *Object::Clone() const
@@ -77,7 +76,8 @@ Object::Object(const Object &object) : BoundingBox(object)
     m_parent = NULL;
     m_classid = object.m_classid;
     m_isReferencObject = object.m_isReferencObject;
-    m_uuid = object.m_uuid; // for now copy the uuid - to be decided
+    // for now copy the uuid - to be decided
+    m_uuid = object.m_uuid;
     m_isModified = true;
     int i;
     for (i = 0; i < (int)object.m_children.size(); i++) {
@@ -98,7 +98,8 @@ Object &Object::operator=(const Object &object)
         m_parent = NULL;
         m_classid = object.m_classid;
         m_isReferencObject = object.m_isReferencObject;
-        m_uuid = object.m_uuid; // for now copy the uuid - to be decided
+        // for now copy the uuid - to be decided
+        m_uuid = object.m_uuid;
         m_isModified = true;
 
         int i;
@@ -115,7 +116,8 @@ Object &Object::operator=(const Object &object)
 
 Object::~Object()
 {
-    ClearChildren();
+    // The object was removed from the uuid index of its doc (if any) when detached from its parent
+    ClearChildren(false);
 }
 
 void Object::Init(std::string classid)
@@ -125,7 +127,8 @@ void Object::Init(std::string classid)
     m_isModified = true;
     m_classid = classid;
     m_isReferencObject = false;
-    this->GenerateUuid();
+    // Not for the layout objects, which are created concurrently (see Page::ProcessMeasures)
+    if (!m_classid.empty()) this->GenerateUuid();
 
     Reset();
 }
@@ -185,8 +188,10 @@ void Object::MoveChildrenFrom(Object *sourceParent, int idx, bool allowTypeChang
         }
         else {
             this->m_children.push_back(child);
+            this->AddToDocUuidIndex(child);
         }
     }
+    this->Modify();
 }
 
 void Object::MoveItselfTo(Object *targetParent)
@@ -202,25 +207,82 @@ void Object::MoveItselfTo(Object *targetParent)
 
 void Object::SetUuid(std::string uuid)
 {
+    if (m_uuid == uuid) return;
+
+    std::string previousUuid = m_uuid;
     m_uuid = uuid;
+    this->UpdateDocUuidIndex(previousUuid);
 };
 
+Doc *Object::GetUuidIndexDoc()
+{
+    Object *root = this;
+    while (root->m_parent) root = root->m_parent;
+    if (!root->Is(DOC)) return NULL;
+    return vrv_cast<Doc *>(root);
+}
+
+void Object::UpdateDocUuidIndex(const std::string &previousUuid)
+{
+    // Objects being loaded usually do not have a parent yet
+    if (!m_parent) return;
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) {
+        doc->UpdateUuidIndex(this, previousUuid);
+    }
+}
+
+void Object::AddToDocUuidIndex(Object *child)
+{
+    assert(child && (child->GetParent() == this));
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) {
+        doc->AddToUuidIndex(child);
+    }
+}
+
+void Object::RemoveFromDocUuidIndex(Object *child)
+{
+    assert(child && (child->GetParent() == this));
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) {
+        doc->RemoveFromUuidIndex(child);
+    }
+}
+
 void Object::ClearChildren()
+{
+    ClearChildren(true);
+}
+
+void Object::ClearChildren(bool updateDocUuidIndex)
 {
     if (m_isReferencObject) {
         m_children.clear();
         return;
     }
 
+    if (m_children.empty()) {
+        return;
+    }
+
+    Doc *doc = (updateDocUuidIndex) ? this->GetUuidIndexDoc() : NULL;
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
         // we need to check if this is the parent
         // ownership might have been given up with Relinquish
         if ((*iter)->GetParent() == this) {
+            if (doc) doc->RemoveFromUuidIndex(*iter);
+            // reset the parent first so the child does not mark us as modified when being deleted
+            (*iter)->ResetParent();
             delete *iter;
         }
     }
     m_children.clear();
+    this->Modify();
 }
 
 int Object::GetChildCount(const ClassId classId) const
@@ -292,10 +354,13 @@ void Object::InsertChild(Object *element, int idx)
 
     if (idx >= (int)m_children.size()) {
         m_children.push_back(element);
-        return;
     }
-    ArrayOfObjects::iterator iter = m_children.begin();
-    m_children.insert(iter + (idx), element);
+    else {
+        ArrayOfObjects::iterator iter = m_children.begin();
+        m_children.insert(iter + (idx), element);
+    }
+    this->AddToDocUuidIndex(element);
+    this->Modify();
 }
 
 Object *Object::DetachChild(int idx)
@@ -304,9 +369,11 @@ Object *Object::DetachChild(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    this->RemoveFromDocUuidIndex(child);
     child->ResetParent();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
+    this->Modify();
     return child;
 }
 
@@ -332,7 +399,9 @@ Object *Object::Relinquish(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    this->RemoveFromDocUuidIndex(child);
     child->ResetParent();
+    this->Modify();
     return child;
 }
 
@@ -346,10 +415,36 @@ void Object::ClearRelinquishedChildren()
         else
             iter++;
     }
+    this->Modify();
 }
 
 Object *Object::FindChildByUuid(std::string uuid, int deepness, bool direction)
 {
+    // Use the uuid index of the document (if any) for full depth forward searches
+    if ((deepness == UNLIMITED_DEPTH) && (direction == FORWARD)) {
+        Doc *doc = (this->Is(DOC)) ? vrv_cast<Doc *>(this) : vrv_cast<Doc *>(this->GetFirstParent(DOC));
+        if (doc) {
+            Object *element = doc->GetIndexedObject(uuid);
+            if (!element) return NULL;
+            if (element == this) return element;
+            // Check that the element is a descendant of this object and that it is not within a hidden
+            // editorial element, since these are not processed by Object::FindByUuid
+            bool isVisible = true;
+            Object *parent = element;
+            do {
+                parent = parent->GetParent();
+                if (!parent) return NULL;
+                if (parent->IsEditorialElement()) {
+                    EditorialElement *editorialElement = vrv_cast<EditorialElement *>(parent);
+                    assert(editorialElement);
+                    if (editorialElement->m_visibility == Hidden) isVisible = false;
+                }
+            } while (parent != this);
+            if (isVisible) return element;
+            // Otherwise look for another (visible) element with the same uuid
+        }
+    }
+
     Functor findByUuid(&Object::FindByUuid);
     FindByUuidParams findbyUuidParams;
     findbyUuidParams.m_uuid = uuid;
@@ -402,6 +497,7 @@ bool Object::DeleteChild(Object *child)
 {
     auto it = std::find(m_children.begin(), m_children.end(), child);
     if (it != m_children.end()) {
+        this->RemoveFromDocUuidIndex(child);
         m_children.erase(it);
         delete child;
         this->Modify();
@@ -415,12 +511,14 @@ bool Object::DeleteChild(Object *child)
 
 void Object::GenerateUuid()
 {
-    int nr = std::rand();
+    int nr = Object::GetUuidRandomNumber();
     char str[17];
     // I do not want to use a stream for doing this!
     snprintf(str, 17, "%016d", nr);
 
+    std::string previousUuid = m_uuid;
     m_uuid = m_classid + std::string(str);
+    this->UpdateDocUuidIndex(previousUuid);
 }
 
 void Object::ResetUuid()
@@ -430,15 +528,31 @@ void Object::ResetUuid()
 
 void Object::SeedUuid(unsigned int seed)
 {
+    std::minstd_rand *generator = Object::GetCurrentUuidGenerator();
     // Init random number generator for uuids
     if (seed == 0) {
-        std::srand((unsigned int)std::time(0));
+        generator->seed(std::random_device{}());
     }
     else {
-        std::srand(seed);
+        generator->seed(seed);
     }
 }
 
+int Object::GetUuidRandomNumber()
+{
+    return (int)(*Object::GetCurrentUuidGenerator())();
+}
+
+std::minstd_rand *Object::GetCurrentUuidGenerator()
+{
+    return (s_currentUuidGenerator) ? s_currentUuidGenerator : &s_defaultUuidGenerator;
+}
+
+void Object::SetCurrentUuidGenerator(std::minstd_rand *generator)
+{
+    s_currentUuidGenerator = generator;
+}
+
 void Object::SetParent(Object *parent)
 {
     assert(!m_parent);
@@ -563,7 +677,7 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
 
     bool processChildren = true;
     if (functor->m_visibleOnly && this->IsEditorialElement()) {
-        EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(this);
+        EditorialElement *editorialElement = vrv_cast<EditorialElement *>(this);
         assert(editorialElement);
         if (editorialElement->m_visibility == Hidden) {
             processChildren = false;
@@ -655,6 +769,7 @@ ObjectListInterface::ObjectListInterface(const ObjectListInterface &interface)
 {
     // actually nothing to do, we just don't want the list to be copied
     m_list.clear();
+    m_listIndexes.clear();
 }
 
 ObjectListInterface &ObjectListInterface::operator=(const ObjectListInterface &interface)
@@ -662,6 +777,7 @@ ObjectListInterface &ObjectListInterface::operator=(const ObjectListInterface &i
     // actually nothing to do, we just don't want the list to be copied
     if (this != &interface) {
         this->m_list.clear();
+        this->m_listIndexes.clear();
     }
     return *this;
 }
@@ -677,6 +793,16 @@ void ObjectListInterface::ResetList(Object *node)
     m_list.clear();
     node->FillFlatList(&m_list);
     this->FilterList(&m_list);
+
+    // Index the positions of long lists (e.g., in layers) so the lookups do not have to go through them
+    m_listIndexes.clear();
+    if ((int)m_list.size() < LIST_INDEX_MIN_SIZE) return;
+    m_listIndexes.reserve(m_list.size());
+    int i;
+    for (i = 0; i < (int)m_list.size(); ++i) {
+        // keep the first position if an object is there twice
+        m_listIndexes.emplace(m_list.at(i), i);
+    }
 }
 
 ListOfObjects *ObjectListInterface::GetList(Object *node)
@@ -687,14 +813,12 @@ ListOfObjects *ObjectListInterface::GetList(Object *node)
 
 int ObjectListInterface::GetListIndex(const Object *listElement)
 {
-    ListOfObjects::iterator iter;
-    int i;
-    for (iter = m_list.begin(), i = 0; iter != m_list.end(); ++iter, i++) {
-        if (listElement == *iter) {
-            return i;
-        }
+    if (m_listIndexes.empty()) {
+        ListOfObjects::iterator iter = std::find(m_list.begin(), m_list.end(), listElement);
+        return (iter == m_list.end()) ? -1 : (int)std::distance(m_list.begin(), iter);
     }
-    return -1;
+    std::unordered_map<const Object *, int>::const_iterator iter = m_listIndexes.find(listElement);
+    return (iter == m_listIndexes.end()) ? -1 : iter->second;
 }
 
 Object *ObjectListInterface::GetListFirst(const Object *startFrom, const ClassId classId)
@@ -720,36 +844,16 @@ Object *ObjectListInterface::GetListFirstBackward(Object *startFrom, const Class
 
 Object *ObjectListInterface::GetListPrevious(Object *listElement)
 {
-    ListOfObjects::iterator iter;
-    int i;
-    for (iter = m_list.begin(), i = 0; iter != m_list.end(); ++iter, i++) {
-        if (listElement == *iter) {
-            if (i > 0) {
-                return *(--iter);
-            }
-            else {
-                return NULL;
-            }
-        }
-    }
-    return NULL;
+    int idx = GetListIndex(listElement);
+    if (idx < 1) return NULL;
+    return m_list.at(idx - 1);
 }
 
 Object *ObjectListInterface::GetListNext(Object *listElement)
 {
-    ListOfObjects::reverse_iterator iter;
-    int i;
-    for (iter = m_list.rbegin(), i = 0; iter != m_list.rend(); ++iter, i++) {
-        if (listElement == *iter) {
-            if (i > 0) {
-                return *(--iter);
-            }
-            else {
-                return NULL;
-            }
-        }
-    }
-    return NULL;
+    int idx = GetListIndex(listElement);
+    if ((idx == -1) || (idx >= (int)m_list.size() - 1)) return NULL;
+    return m_list.at(idx + 1);
 }
 
 //----------------------------------------------------------------------------
@@ -762,7 +866,7 @@ std::wstring TextListInterface::GetText(Object *node)
     std::wstring concatText;
     ListOfObjects *childList = this->GetList(node); // make sure it's initialized
     for (ListOfObjects::iterator it = childList->begin(); it != childList->end(); it++) {
-        Text *text = dynamic_cast<Text *>(*it);
+        Text *text = vrv_cast<Text *>(*it);
         assert(text);
         concatText += text->GetText();
     }
@@ -813,7 +917,7 @@ void Functor::Call(Object *ptr, FunctorParams *functorParams)
 
 int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 {
-    AddLayerElementToFlatListParams *params = dynamic_cast<AddLayerElementToFlatListParams *>(functorParams);
+    AddLayerElementToFlatListParams *params = vrv_cast<AddLayerElementToFlatListParams *>(functorParams);
     assert(params);
 
     params->m_flatList->push_back(this);
@@ -824,7 +928,7 @@ int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 
 int Object::FindByUuid(FunctorParams *functorParams)
 {
-    FindByUuidParams *params = dynamic_cast<FindByUuidParams *>(functorParams);
+    FindByUuidParams *params = vrv_cast<FindByUuidParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -832,7 +936,7 @@ int Object::FindByUuid(FunctorParams *functorParams)
         return FUNCTOR_STOP;
     }
 
-    if (params->m_uuid == this->GetUuid()) {
+    if ((params->m_uuid == this->GetUuid())) {
         params->m_element = this;
         // LogDebug("Found it!");
         return FUNCTOR_STOP;
@@ -843,7 +947,7 @@ int Object::FindByUuid(FunctorParams *functorParams)
 
 int Object::FindByAttComparison(FunctorParams *functorParams)
 {
-    FindByAttComparisonParams *params = dynamic_cast<FindByAttComparisonParams *>(functorParams);
+    FindByAttComparisonParams *params = vrv_cast<FindByAttComparisonParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -863,7 +967,7 @@ int Object::FindByAttComparison(FunctorParams *functorParams)
 
 int Object::FindExtremeByAttComparison(FunctorParams *functorParams)
 {
-    FindExtremeByAttComparisonParams *params = dynamic_cast<FindExtremeByAttComparisonParams *>(functorParams);
+    FindExtremeByAttComparisonParams *params = vrv_cast<FindExtremeByAttComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the AttComparison operator()
@@ -876,7 +980,7 @@ int Object::FindExtremeByAttComparison(FunctorParams *functorParams)
 
 int Object::FindAllByAttComparison(FunctorParams *functorParams)
 {
-    FindAllByAttComparisonParams *params = dynamic_cast<FindAllByAttComparisonParams *>(functorParams);
+    FindAllByAttComparisonParams *params = vrv_cast<FindAllByAttComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the AttComparison operator()
@@ -889,14 +993,14 @@ int Object::FindAllByAttComparison(FunctorParams *functorParams)
 
 int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 {
-    SetCautionaryScoreDefParams *params = dynamic_cast<SetCautionaryScoreDefParams *>(functorParams);
+    SetCautionaryScoreDefParams *params = vrv_cast<SetCautionaryScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentScoreDef);
 
     // starting a new staff
     if (this->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(this);
+        Staff *staff = vrv_cast<Staff *>(this);
         assert(staff);
         params->m_currentStaffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
         return FUNCTOR_CONTINUE;
@@ -904,7 +1008,7 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
     // starting a new layer
     if (this->Is(LAYER)) {
-        Layer *layer = dynamic_cast<Layer *>(this);
+        Layer *layer = vrv_cast<Layer *>(this);
         assert(layer);
         layer->SetDrawingCautionValues(params->m_currentStaffDef);
         return FUNCTOR_SIBLINGS;
@@ -915,14 +1019,14 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
 int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 {
-    SetCurrentScoreDefParams *params = dynamic_cast<SetCurrentScoreDefParams *>(functorParams);
+    SetCurrentScoreDefParams *params = vrv_cast<SetCurrentScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_upcomingScoreDef);
 
     // starting a new page
     if (this->Is(PAGE)) {
-        Page *page = dynamic_cast<Page *>(this);
+        Page *page = vrv_cast<Page *>(this);
         assert(page);
         if (page->GetParent()->GetChildIndex(page) == 0) {
             params->m_upcomingScoreDef->SetRedrawFlags(true, true, true, true, false);
@@ -934,7 +1038,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new system
     if (this->Is(SYSTEM)) {
-        System *system = dynamic_cast<System *>(this);
+        System *system = vrv_cast<System *>(this);
         assert(system);
         // This is the only thing we do for now - we need to wait until we reach the first measure
         params->m_currentSystem = system;
@@ -943,7 +1047,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new measure
     if (this->Is(MEASURE)) {
-        Measure *measure = dynamic_cast<Measure *>(this);
+        Measure *measure = vrv_cast<Measure *>(this);
         assert(measure);
         bool systemBreak = false;
         bool scoreDefInsert = false;
@@ -953,7 +1057,8 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
             // We had a scoreDef so we need to put cautionnary values
             // This will also happend with clef in the last measure - however, the cautionnary functor will not do
             // anything then
-            if (params->m_upcomingScoreDef->m_setAsDrawing && params->m_previousMeasure) {
+            if (params->m_upcomingScoreDef->m_setAsDrawing && params->m_previousMeasure
+                && !params->m_cautionaryDone) {
                 ScoreDef cautionaryScoreDef = *params->m_upcomingScoreDef;
                 SetCautionaryScoreDefParams setCautionaryScoreDefParams(&cautionaryScoreDef);
                 Functor setCautionaryScoreDef(&Object::SetCautionaryScoreDef);
@@ -966,6 +1071,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
             params->m_currentSystem->GetDrawingScoreDef()->SetDrawLabels(params->m_drawLabels);
             params->m_currentSystem = NULL;
             params->m_drawLabels = false;
+            params->m_cautionaryDone = false;
         }
         if (params->m_upcomingScoreDef->m_setAsDrawing) {
             scoreDefInsert = true;
@@ -981,7 +1087,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new scoreDef
     if (this->Is(SCOREDEF)) {
-        ScoreDef *scoreDef = dynamic_cast<ScoreDef *>(this);
+        ScoreDef *scoreDef = vrv_cast<ScoreDef *>(this);
         assert(scoreDef);
         // Replace the current scoreDef with the new one, including its content (staffDef) - this also sets
         // m_setAsDrawing to true so it will then be taken into account at the next measure
@@ -991,14 +1097,14 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new staffDef
     if (this->Is(STAFFDEF)) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(this);
+        StaffDef *staffDef = vrv_cast<StaffDef *>(this);
         assert(staffDef);
         params->m_upcomingScoreDef->ReplaceDrawingValues(staffDef);
     }
 
     // starting a new staff
     if (this->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(this);
+        Staff *staff = vrv_cast<Staff *>(this);
         assert(staff);
         params->m_currentStaffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
         assert(staff->m_drawingStaffDef == NULL);
@@ -1013,7 +1119,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new layer
     if (this->Is(LAYER)) {
-        Layer *layer = dynamic_cast<Layer *>(this);
+        Layer *layer = vrv_cast<Layer *>(this);
         assert(layer);
         // setting the layer stem direction. Alternatively, this could be done in
         // View::DrawLayer. If this (and other things) is kept here, renaming the method to something
@@ -1032,7 +1138,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new clef
     if (this->Is(CLEF)) {
-        Clef *clef = dynamic_cast<Clef *>(this);
+        Clef *clef = vrv_cast<Clef *>(this);
         assert(clef);
         assert(params->m_currentStaffDef);
         StaffDef *upcomingStaffDef = params->m_upcomingScoreDef->GetStaffDef(params->m_currentStaffDef->GetN());
@@ -1044,7 +1150,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new keysig
     if (this->Is(KEYSIG)) {
-        KeySig *keysig = dynamic_cast<KeySig *>(this);
+        KeySig *keysig = vrv_cast<KeySig *>(this);
         assert(keysig);
         assert(params->m_currentStaffDef);
         StaffDef *upcomingStaffDef = params->m_upcomingScoreDef->GetStaffDef(params->m_currentStaffDef->GetN());
@@ -1059,7 +1165,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
 int Object::GetAlignmentLeftRight(FunctorParams *functorParams)
 {
-    GetAlignmentLeftRightParams *params = dynamic_cast<GetAlignmentLeftRightParams *>(functorParams);
+    GetAlignmentLeftRightParams *params = vrv_cast<GetAlignmentLeftRightParams *>(functorParams);
     assert(params);
 
     if (!this->IsLayerElement()) return FUNCTOR_CONTINUE;
@@ -1077,12 +1183,12 @@ int Object::GetAlignmentLeftRight(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting a new staff
     if (this->Is(STAFF)) {
-        Staff *currentStaff = dynamic_cast<Staff *>(this);
+        Staff *currentStaff = vrv_cast<Staff *>(this);
         assert(currentStaff);
         assert(currentStaff->GetAlignment());
 
@@ -1093,7 +1199,7 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
     // starting new layer
     if (this->Is(LAYER)) {
-        Layer *currentLayer = dynamic_cast<Layer *>(this);
+        Layer *currentLayer = vrv_cast<Layer *>(this);
         assert(currentLayer);
         // set scoreDef attr
         if (currentLayer->GetStaffDefClef()) {
@@ -1137,12 +1243,12 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    LayerElement *current = dynamic_cast<LayerElement *>(this);
+    LayerElement *current = vrv_cast<LayerElement *>(this);
     assert(current);
 
     bool skipAbove = false;
     bool skipBelow = false;
-    Chord *chord = dynamic_cast<Chord *>(this->GetFirstParent(CHORD, MAX_CHORD_DEPTH));
+    Chord *chord = vrv_cast<Chord *>(this->GetFirstParent(CHORD, MAX_CHORD_DEPTH));
     if (chord) {
         chord->GetCrossStaffOverflows(current, params->m_staffAlignment, skipAbove, skipBelow);
     }
@@ -1176,12 +1282,12 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting new layer
     if (this->Is(LAYER)) {
-        Layer *currentLayer = dynamic_cast<Layer *>(this);
+        Layer *currentLayer = vrv_cast<Layer *>(this);
         assert(currentLayer);
         // set scoreDef attr
         if (currentLayer->GetCautionStaffDefClef()) {
@@ -1202,7 +1308,7 @@ int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 
 int Object::Save(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObject(this)) {
@@ -1213,7 +1319,7 @@ int Object::Save(FunctorParams *functorParams)
 
 int Object::SaveEnd(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObjectEnd(this)) {
@@ -56,7 +56,7 @@ void Page::Reset()
 void Page::AddChild(Object *child)
 {
     if (child->Is(SYSTEM)) {
-        assert(dynamic_cast<System *>(child));
+        assert(vrv_cast<System *>(child));
     }
     else {
         LogError("Adding '%s' to a '%s'", child->GetClassName().c_str(), this->GetClassName().c_str());
@@ -65,6 +65,7 @@ void Page::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -87,7 +88,7 @@ void Page::LayOutTranscription(bool force)
         return;
     }
 
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -153,15 +154,36 @@ void Page::LayOutTranscription(bool force)
     m_layoutDone = true;
 }
 
-void Page::LayOutHorizontally()
+void Page::LayOutHorizontally(int longestActualDur)
 {
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    // The measures processed concurrently by the passes working within each measure (if more than one thread)
+#ifdef USE_EMSCRIPTEN
+    ThreadPool *threads = NULL;
+#else
+    ThreadPool *threads = doc->GetLayoutThreadPool();
+#endif
+    ArrayOfObjects measures;
+    std::vector<bool> firstMeasures;
+    if (threads) {
+        AttComparison isMeasure(MEASURE);
+        ArrayOfObjects::iterator systemIter;
+        for (systemIter = m_children.begin(); systemIter != m_children.end(); ++systemIter) {
+            int count = (int)measures.size();
+            (*systemIter)->FindAllChildByAttComparison(&measures, &isMeasure, UNLIMITED_DEPTH, FORWARD, false);
+            firstMeasures.resize(measures.size(), false);
+            if ((int)measures.size() > count) firstMeasures.at(count) = true;
+        }
+    }
+    bool concurrent = (measures.size() > 1);
+    std::vector<int> staffNs = doc->m_scoreDef.GetStaffNs();
+
     // Reset the horizontal alignment
     Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
     this->Process(&resetHorizontalAlignment, NULL);
@@ -173,10 +195,22 @@ void Page::LayOutHorizontally()
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
-    Functor alignHorizontally(&Object::AlignHorizontally);
-    Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd);
-    AlignHorizontallyParams alignHorizontallyParams(&alignHorizontally);
-    this->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd);
+    if (concurrent) {
+        this->ProcessMeasures(measures, firstMeasures, threads, [](Object *measure, bool isFirstMeasure) {
+            Functor alignHorizontally(&Object::AlignHorizontally);
+            Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd);
+            AlignHorizontallyParams alignHorizontallyParams(&alignHorizontally);
+            // This is otherwise set by System::AlignHorizontally and Measure::AlignHorizontallyEnd
+            alignHorizontallyParams.m_isFirstMeasure = isFirstMeasure;
+            measure->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd);
+        });
+    }
+    else {
+        Functor alignHorizontally(&Object::AlignHorizontally);
+        Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd);
+        AlignHorizontallyParams alignHorizontallyParams(&alignHorizontally);
+        this->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd);
+    }
 
     // Align the content of the page using system aligners
     // After this:
@@ -189,41 +223,75 @@ void Page::LayOutHorizontally()
     // Unless duration-based spacing is disabled, set the X position of each Alignment.
     // Does non-linear spacing based on the duration space between two Alignment objects.
     if (!doc->GetEvenSpacing()) {
-        int longestActualDur = DUR_4;
-        // Get the longest duration in the piece
-        AttDurExtreme durExtremeComparison(LONGEST);
-        Object *longestDur = this->FindChildExtremeByAttComparison(&durExtremeComparison);
-        if (longestDur) {
-            DurationInterface *interface = longestDur->GetDurationInterface();
-            assert(interface);
-            longestActualDur = interface->GetActualDur();
-            // LogDebug("Longest duration is DUR_* code %d", longestActualDur);
+        if (longestActualDur == VRV_UNSET) {
+            longestActualDur = DUR_4;
+            // Get the longest duration in the piece
+            AttDurExtreme durExtremeComparison(LONGEST);
+            Object *longestDur = this->FindChildExtremeByAttComparison(&durExtremeComparison);
+            if (longestDur) {
+                DurationInterface *interface = longestDur->GetDurationInterface();
+                assert(interface);
+                longestActualDur = interface->GetActualDur();
+                // LogDebug("Longest duration is DUR_* code %d", longestActualDur);
+            }
         }
 
-        Functor setAlignmentX(&Object::SetAlignmentXPos);
-        SetAlignmentXPosParams setAlignmentXPosParams(doc, &setAlignmentX);
-        setAlignmentXPosParams.m_longestActualDur = longestActualDur;
-        this->Process(&setAlignmentX, &setAlignmentXPosParams);
+        if (concurrent) {
+            this->ProcessMeasures(measures, firstMeasures, threads, [doc, longestActualDur](Object *measure, bool) {
+                Functor setAlignmentX(&Object::SetAlignmentXPos);
+                SetAlignmentXPosParams setAlignmentXPosParams(doc, &setAlignmentX);
+                setAlignmentXPosParams.m_longestActualDur = longestActualDur;
+                measure->Process(&setAlignmentX, &setAlignmentXPosParams);
+            });
+        }
+        else {
+            Functor setAlignmentX(&Object::SetAlignmentXPos);
+            SetAlignmentXPosParams setAlignmentXPosParams(doc, &setAlignmentX);
+            setAlignmentXPosParams.m_longestActualDur = longestActualDur;
+            this->Process(&setAlignmentX, &setAlignmentXPosParams);
+        }
     }
 
-    // Set the pitch / pos alignement
-    SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
-    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
-    this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
+    // Set the pitch / pos alignement, the stems, the chord note heads and the dots
+    if (concurrent) {
+        this->ProcessMeasures(measures, firstMeasures, threads, [doc](Object *measure, bool) {
+            SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
+            Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
+            measure->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
+
+            CalcStemParams calcStemParams(doc);
+            Functor calcStem(&Object::CalcStem);
+            measure->Process(&calcStem, &calcStemParams);
+
+            FunctorDocParams calcChordNoteHeadsParams(doc);
+            Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+            measure->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
+
+            CalcDotsParams calcDotsParams(doc);
+            Functor calcDots(&Object::CalcDots);
+            measure->Process(&calcDots, &calcDotsParams);
+        });
+    }
+    else {
+        SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
+        Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
+        this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
 
-    CalcStemParams calcStemParams(doc);
-    Functor calcStem(&Object::CalcStem);
-    this->Process(&calcStem, &calcStemParams);
+        CalcStemParams calcStemParams(doc);
+        Functor calcStem(&Object::CalcStem);
+        this->Process(&calcStem, &calcStemParams);
 
-    FunctorDocParams calcChordNoteHeadsParams(doc);
-    Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
-    this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
+        FunctorDocParams calcChordNoteHeadsParams(doc);
+        Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+        this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
 
-    CalcDotsParams calcDotsParams(doc);
-    Functor calcDots(&Object::CalcDots);
-    this->Process(&calcDots, &calcDotsParams);
+        CalcDotsParams calcDotsParams(doc);
+        Functor calcDots(&Object::CalcDots);
+        this->Process(&calcDots, &calcDotsParams);
+    }
 
     // Render it for filling the bounding box
+    // This is not done concurrently since the systems collect the elements drawn at their end while drawing
     View view;
     view.SetDoc(doc);
     BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
@@ -231,31 +299,53 @@ void Page::LayOutHorizontally()
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
 
-    // Adjust the x position of the LayerElement where multiple layer collide
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustLayers(&Object::AdjustLayers);
-    AdjustLayersParams adjustLayersParams(doc, &adjustLayers, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustLayers, &adjustLayersParams);
-
-    // Adjust the X position of the accidentals, including in chords
-    Functor adjustAccidX(&Object::AdjustAccidX);
-    AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
-    this->Process(&adjustAccidX, &adjustAccidXParams);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustXPos(&Object::AdjustXPos);
-    Functor adjustXPosEnd(&Object::AdjustXPosEnd);
-    AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustGraceXPos(&Object::AdjustGraceXPos);
-    Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
-    AdjustGraceXPosParams adjustGraceXPosParams(
-        doc, &adjustGraceXPos, &adjustGraceXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    if (concurrent) {
+        this->ProcessMeasures(measures, firstMeasures, threads, [doc, &staffNs](Object *measure, bool) {
+            Functor adjustLayers(&Object::AdjustLayers);
+            AdjustLayersParams adjustLayersParams(doc, &adjustLayers, staffNs);
+            measure->Process(&adjustLayers, &adjustLayersParams);
+
+            Functor adjustAccidX(&Object::AdjustAccidX);
+            AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
+            measure->Process(&adjustAccidX, &adjustAccidXParams);
+
+            Functor adjustXPos(&Object::AdjustXPos);
+            Functor adjustXPosEnd(&Object::AdjustXPosEnd);
+            AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, staffNs);
+            measure->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
+
+            Functor adjustGraceXPos(&Object::AdjustGraceXPos);
+            Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
+            AdjustGraceXPosParams adjustGraceXPosParams(doc, &adjustGraceXPos, &adjustGraceXPosEnd, staffNs);
+            measure->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+        });
+    }
+    else {
+        // Adjust the x position of the LayerElement where multiple layer collide
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustLayers(&Object::AdjustLayers);
+        AdjustLayersParams adjustLayersParams(doc, &adjustLayers, staffNs);
+        this->Process(&adjustLayers, &adjustLayersParams);
+
+        // Adjust the X position of the accidentals, including in chords
+        Functor adjustAccidX(&Object::AdjustAccidX);
+        AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
+        this->Process(&adjustAccidX, &adjustAccidXParams);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustXPos(&Object::AdjustXPos);
+        Functor adjustXPosEnd(&Object::AdjustXPosEnd);
+        AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, staffNs);
+        this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustGraceXPos(&Object::AdjustGraceXPos);
+        Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
+        AdjustGraceXPosParams adjustGraceXPosParams(doc, &adjustGraceXPos, &adjustGraceXPosEnd, staffNs);
+        this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    }
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
@@ -272,9 +362,35 @@ void Page::LayOutHorizontally()
     this->Process(&alignMeasures, &alignMeasuresParams, &alignMeasuresEnd);
 }
 
+void Page::ProcessMeasures(const ArrayOfObjects &measures, const std::vector<bool> &firstMeasures,
+    ThreadPool *threads, const std::function<void(Object *, bool)> &process)
+{
+    assert(measures.size() == firstMeasures.size());
+    assert(threads);
+
+    // Cache the position of the systems beforehand - they are then only read by the threads (see
+    // System::GetDrawingX). The measures themselves are not modified since the modification of their aligners is not
+    // propagated (see HorizontalAligner::Modify)
+    ArrayOfObjects::const_iterator iter;
+    for (iter = measures.begin(); iter != measures.end(); ++iter) {
+        System *system = vrv_cast<System *>((*iter)->GetFirstParent(SYSTEM));
+        assert(system);
+        system->GetDrawingX();
+        system->GetDrawingY();
+    }
+
+    // The threads use the font of the current one. The objects they create are layout objects without uuid, so the
+    // uuid generator of the document is not used by them.
+    Resources::LoadedFont *font = Resources::GetCurrentFont();
+    threads->Run((int)measures.size(), [&](int i) {
+        Resources::SetCurrentFont(font);
+        process(measures.at(i), firstMeasures.at(i));
+    });
+}
+
 void Page::LayOutVertically()
 {
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -347,7 +463,7 @@ void Page::LayOutVertically()
 
 void Page::JustifyHorizontally()
 {
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
 
     if (!doc->GetJustificationX()) {
@@ -367,7 +483,7 @@ void Page::JustifyHorizontally()
 
 void Page::LayOutPitchPos()
 {
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -386,21 +502,21 @@ void Page::LayOutPitchPos()
 
 int Page::GetContentHeight() const
 {
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    System *last = dynamic_cast<System *>(m_children.back());
+    System *last = vrv_cast<System *>(m_children.back());
     assert(last);
     return doc->m_drawingPageHeight - doc->m_drawingPageTopMar - last->GetDrawingYRel() + last->GetHeight();
 }
 
 int Page::GetContentWidth() const
 {
-    Doc *doc = dynamic_cast<Doc *>(GetParent());
+    Doc *doc = vrv_cast<Doc *>(GetParent());
     assert(doc);
     // in non debug
     if (!doc) return 0;
@@ -409,7 +525,7 @@ int Page::GetContentWidth() const
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    System *first = dynamic_cast<System *>(m_children.front());
+    System *first = vrv_cast<System *>(m_children.front());
     assert(first);
 
     // For avoiding unused variable warning in non debug mode
@@ -461,7 +577,7 @@ void Page::UpgradePageBasedMEI(Doc *doc)
 
 int Page::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     params->m_page = this;
@@ -60,7 +60,7 @@ void Rest::Reset()
 void Rest::AddChild(Object *child)
 {
     if (child->Is(DOTS)) {
-        assert(dynamic_cast<Dots *>(child));
+        assert(vrv_cast<Dots *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -78,6 +78,7 @@ void Rest::AddChild(Object *child)
         m_children.insert(m_children.begin(), child);
     else
         m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -123,7 +124,7 @@ int Rest::GetRestLocOffset(int loc)
 
 int Rest::PrepareLayerElementParts(FunctorParams *functorParams)
 {
-    Dots *currentDots = dynamic_cast<Dots *>(this->FindChildByType(DOTS, 1));
+    Dots *currentDots = vrv_cast<Dots *>(this->FindChildByType(DOTS, 1));
 
     if ((this->GetDur() > DUR_BR) && this->HasDots()) {
         if (!currentDots) {
@@ -144,7 +145,7 @@ int Rest::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Rest::CalcDots(FunctorParams *functorParams)
 {
-    CalcDotsParams *params = dynamic_cast<CalcDotsParams *>(functorParams);
+    CalcDotsParams *params = vrv_cast<CalcDotsParams *>(functorParams);
     assert(params);
 
     // We currently have no dots object with mensural rests
@@ -157,7 +158,7 @@ int Rest::CalcDots(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -168,7 +169,7 @@ int Rest::CalcDots(FunctorParams *functorParams)
     Dots *dots = NULL;
 
     // For single notes we need here to set the dot loc
-    dots = dynamic_cast<Dots *>(this->FindChildByType(DOTS, 1));
+    dots = vrv_cast<Dots *>(this->FindChildByType(DOTS, 1));
     assert(dots);
 
     std::list<int> *dotLocs = dots->GetDotLocsForStaff(staff);
@@ -75,13 +75,13 @@ void BTrem::Reset()
 void BTrem::AddChild(Object *child)
 {
     if (child->Is(CHORD)) {
-        assert(dynamic_cast<Chord *>(child));
+        assert(vrv_cast<Chord *>(child));
     }
     else if (child->Is(CLEF)) {
-        assert(dynamic_cast<Clef *>(child));
+        assert(vrv_cast<Clef *>(child));
     }
     else if (child->Is(NOTE)) {
-        assert(dynamic_cast<Note *>(child));
+        assert(vrv_cast<Note *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -93,6 +93,7 @@ void BTrem::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 //----------------------------------------------------------------------------
@@ -122,13 +123,13 @@ void FTrem::Reset()
 void FTrem::AddChild(Object *child)
 {
     if (child->Is(CHORD)) {
-        assert(dynamic_cast<Chord *>(child));
+        assert(vrv_cast<Chord *>(child));
     }
     else if (child->Is(CLEF)) {
-        assert(dynamic_cast<Clef *>(child));
+        assert(vrv_cast<Clef *>(child));
     }
     else if (child->Is(NOTE)) {
-        assert(dynamic_cast<Note *>(child));
+        assert(vrv_cast<Note *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -140,6 +141,7 @@ void FTrem::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -155,7 +157,7 @@ void FTrem::FilterList(ListOfObjects *childList)
         }
         // also remove notes within chords
         if ((*iter)->Is(NOTE)) {
-            Note *note = dynamic_cast<Note *>(*iter);
+            Note *note = vrv_cast<Note *>(*iter);
             assert(note);
             if (note->IsChordTone()) {
                 iter = childList->erase(iter);
@@ -291,7 +293,7 @@ void MultiRpt::Reset()
 
 int MRpt::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
     // If multiNumber is not true, nothing needs to be done
@@ -313,7 +315,7 @@ int MRpt::PrepareRpt(FunctorParams *functorParams)
 
 int FTrem::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     ListOfObjects *fTremChildren = this->GetList(this);
@@ -328,9 +330,9 @@ int FTrem::CalcStem(FunctorParams *functorParams)
 
     int elementCount = 2;
 
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
-    Staff *staff = dynamic_cast<Staff *>(layer->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstParent(STAFF));
     assert(staff);
 
     this->m_drawingParams.CalcBeam(layer, staff, params->m_doc, beamElementCoords, elementCount);
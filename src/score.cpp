@@ -41,10 +41,10 @@ void Score::Reset()
 void Score::AddChild(Object *child)
 {
     if (child->Is(SCOREDEF)) {
-        assert(dynamic_cast<ScoreDef *>(child));
+        assert(vrv_cast<ScoreDef *>(child));
     }
     else if (child->Is(SECTION)) {
-        assert(dynamic_cast<Section *>(child));
+        assert(vrv_cast<Section *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -56,6 +56,7 @@ void Score::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
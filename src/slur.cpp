@@ -59,7 +59,7 @@ void Slur::GetCrossStaffOverflows(
     // If the starting point is a chord we need to select the appropriate extreme staff
     Staff *startStaff = NULL;
     if (this->GetStart()->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(this->GetStart());
+        Chord *chord = vrv_cast<Chord *>(this->GetStart());
         assert(chord);
         Staff *staffAbove = NULL;
         Staff *staffBelow = NULL;
@@ -72,7 +72,7 @@ void Slur::GetCrossStaffOverflows(
     // Same for the end point
     Staff *endStaff = NULL;
     if (this->GetEnd()->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(this->GetEnd());
+        Chord *chord = vrv_cast<Chord *>(this->GetEnd());
         assert(chord);
         Staff *staffAbove = NULL;
         Staff *staffBelow = NULL;
@@ -84,11 +84,11 @@ void Slur::GetCrossStaffOverflows(
 
     // No cross-staff endpoints, check if the slur itself crosses staves
     if (!startStaff) {
-        startStaff = dynamic_cast<Staff *>(this->GetStart()->GetFirstParent(STAFF));
+        startStaff = vrv_cast<Staff *>(this->GetStart()->GetFirstParent(STAFF));
         assert(startStaff);
     }
     if (!endStaff) {
-        endStaff = dynamic_cast<Staff *>(this->GetEnd()->GetFirstParent(STAFF));
+        endStaff = vrv_cast<Staff *>(this->GetEnd()->GetFirstParent(STAFF));
         assert(endStaff);
     }
 
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #define _USE_MATH_DEFINES // needed by Windows for math constants like "M_PI"
 #include <math.h>
@@ -38,11 +39,257 @@ static inline double DegToRad(double deg)
 // static inline double RadToDeg(double deg) { return (deg * 180.0) / M_PI; } // unused
 }
 
+//----------------------------------------------------------------------------
+// SvgStream
+//----------------------------------------------------------------------------
+
+SvgStream::SvgStream()
+{
+    // the root element, written by the SvgDeviceContext with its attributes
+    m_buffers.emplace_back();
+    m_elements.emplace_back();
+    Element &root = m_elements.back();
+    root.m_name = "svg";
+    root.m_end.m_buffer = &m_buffers.back();
+    m_stack.push_back({ &root, false });
+
+    m_lastCursor = NULL;
+}
+
+SvgStream::~SvgStream()
+{
+}
+
+std::string &SvgStream::GetText(Cursor &cursor)
+{
+    if (cursor.m_offset != std::string::npos) {
+        cursor.m_buffer = this->AddBuffer(cursor.m_buffer, cursor.m_offset);
+        cursor.m_offset = std::string::npos;
+    }
+    return cursor.m_buffer->m_text;
+}
+
+SvgStream::Buffer *SvgStream::AddBuffer(Buffer *buffer, size_t offset)
+{
+    m_buffers.emplace_back();
+    // a buffer anchored at the same offset as previous ones comes after them
+    buffer->m_anchors.push_back(std::make_pair(offset, &m_buffers.back()));
+    return &m_buffers.back();
+}
+
+void SvgStream::CloseLastElement()
+{
+    if (!m_lastCursor) return;
+
+    m_lastCursor->m_buffer->m_text.append(" />\n");
+    m_lastCursor = NULL;
+}
+
+void SvgStream::AddElement(const std::string &name, bool beforeGroups)
+{
+    this->CloseLastElement();
+
+    Element *parent = m_stack.back().m_element;
+    if (parent->m_tagOpen) {
+        this->GetText(parent->m_end).append(">\n");
+        parent->m_tagOpen = false;
+    }
+
+    Cursor *cursor = &parent->m_end;
+    if (beforeGroups && parent->m_hasGroup) {
+        cursor = &parent->m_firstGroup;
+    }
+    else if ((name == "g") && !parent->m_hasGroup) {
+        parent->m_firstGroup.m_buffer = parent->m_end.m_buffer;
+        parent->m_firstGroup.m_offset = parent->m_end.m_offset;
+        if (parent->m_firstGroup.m_offset == std::string::npos) {
+            parent->m_firstGroup.m_offset = parent->m_end.m_buffer->m_text.size();
+        }
+        parent->m_hasGroup = true;
+    }
+
+    std::string &text = this->GetText(*cursor);
+    AppendIndent(text, parent->m_depth + 1);
+    text.push_back('<');
+    text.append(name);
+
+    m_lastCursor = cursor;
+    m_lastName = name;
+}
+
+void SvgStream::AddAttribute(const char *name, const std::string &value)
+{
+    Cursor *cursor = m_lastCursor;
+    if (!cursor && m_stack.back().m_element->m_tagOpen) cursor = &m_stack.back().m_element->m_end;
+    assert(cursor);
+
+    std::string &text = cursor->m_buffer->m_text;
+    text.push_back(' ');
+    text.append(name);
+    text.append("=\"");
+    AppendEscaped(text, value, true);
+    text.push_back('"');
+}
+
+void SvgStream::AddText(const std::string &text)
+{
+    assert(m_lastCursor);
+
+    std::string &output = m_lastCursor->m_buffer->m_text;
+    output.push_back('>');
+    AppendEscaped(output, text, false);
+    output.append("</");
+    output.append(m_lastName);
+    output.append(">\n");
+    m_lastCursor = NULL;
+}
+
+void SvgStream::PushElement()
+{
+    assert(m_lastCursor);
+
+    Element *parent = m_stack.back().m_element;
+    m_elements.emplace_back();
+    Element &element = m_elements.back();
+    element.m_name = m_lastName;
+    element.m_depth = parent->m_depth + 1;
+    element.m_end = *m_lastCursor;
+    element.m_tagOpen = true;
+    element.m_parentCursor = m_lastCursor;
+    m_stack.push_back({ &element, false });
+
+    m_lastCursor = NULL;
+}
+
+void SvgStream::PopElement()
+{
+    this->CloseLastElement();
+
+    // the root element is closed when written
+    assert(m_stack.size() > 1);
+    StackItem item = m_stack.back();
+    m_stack.pop_back();
+    // a resumed element was already closed
+    if (item.m_resumed) return;
+
+    Element *element = item.m_element;
+    Cursor end = element->m_end;
+    if (element->m_tagOpen) {
+        element->m_tagOpen = false;
+        if (element->m_resumable) {
+            // the content (if resumed) and the end of the empty element are written with the buffer
+            Buffer *content = this->AddBuffer(end.m_buffer, end.m_buffer->m_text.size());
+            content->m_element = element;
+            element->m_end.m_buffer = content;
+        }
+        else {
+            end.m_buffer->m_text.append(" />\n");
+        }
+    }
+    else {
+        std::string &text = end.m_buffer->m_text;
+        // keep the position before the closing tag for resuming the element
+        if (element->m_resumable) element->m_end.m_offset = text.size();
+        AppendIndent(text, element->m_depth);
+        text.append("</");
+        text.append(element->m_name);
+        text.append(">\n");
+    }
+    *element->m_parentCursor = end;
+}
+
+void SvgStream::RegisterElement(const std::string &id)
+{
+    Element *element = m_stack.back().m_element;
+    // keep the first one with the id, as the search in the document would do
+    if (m_resumableElements.emplace(id, element).second) element->m_resumable = true;
+}
+
+void SvgStream::ResumeElement(const std::string &id)
+{
+    this->CloseLastElement();
+
+    Element *element = m_stack.back().m_element;
+    std::unordered_map<std::string, Element *>::iterator iter = m_resumableElements.find(id);
+    if (iter != m_resumableElements.end()) {
+        element = iter->second;
+    }
+    m_stack.push_back({ element, true });
+}
+
+void SvgStream::Write(pugi::xml_writer &writer)
+{
+    this->CloseLastElement();
+
+    this->WriteBuffer(m_buffers.front(), writer);
+}
+
+void SvgStream::WriteBuffer(Buffer &buffer, pugi::xml_writer &writer)
+{
+    const Element *element = buffer.m_element;
+    if (element) {
+        if (buffer.m_text.empty() && buffer.m_anchors.empty()) {
+            writer.write(" />\n", 4);
+            return;
+        }
+        writer.write(">\n", 2);
+    }
+
+    std::stable_sort(buffer.m_anchors.begin(), buffer.m_anchors.end(),
+        [](const std::pair<size_t, Buffer *> &a, const std::pair<size_t, Buffer *> &b) { return a.first < b.first; });
+
+    size_t offset = 0;
+    std::vector<std::pair<size_t, Buffer *> >::iterator iter;
+    for (iter = buffer.m_anchors.begin(); iter != buffer.m_anchors.end(); ++iter) {
+        if (iter->first > offset) writer.write(buffer.m_text.data() + offset, iter->first - offset);
+        offset = iter->first;
+        this->WriteBuffer(*iter->second, writer);
+    }
+    if (buffer.m_text.size() > offset) writer.write(buffer.m_text.data() + offset, buffer.m_text.size() - offset);
+
+    if (element) {
+        std::string end;
+        AppendIndent(end, element->m_depth);
+        end.append("</" + element->m_name + ">\n");
+        writer.write(end.data(), end.size());
+    }
+}
+
+void SvgStream::AppendEscaped(std::string &output, const std::string &text, bool attribute)
+{
+    std::string::const_iterator iter;
+    for (iter = text.begin(); iter != text.end(); ++iter) {
+        unsigned char c = *iter;
+        switch (c) {
+            case '&': output.append("&amp;"); break;
+            case '<': output.append("&lt;"); break;
+            case '>': output.append("&gt;"); break;
+            case '"':
+                if (attribute)
+                    output.append("&quot;");
+                else
+                    output.push_back(c);
+                break;
+            default:
+                // control characters other than tabulations (and new lines in text) as two-digit references
+                if ((c < 32) && (c != '\t') && (attribute || ((c != '\n') && (c != '\r')))) {
+                    output.append("&#");
+                    output.push_back((char)('0' + c / 10));
+                    output.push_back((char)('0' + c % 10));
+                    output.push_back(';');
+                }
+                else {
+                    output.push_back(c);
+                }
+        }
+    }
+}
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
 
-SvgDeviceContext::SvgDeviceContext(int width, int height) : DeviceContext()
+SvgDeviceContext::SvgDeviceContext(int width, int height, bool dom) : DeviceContext()
 {
     m_width = width;
     m_height = height;
@@ -56,9 +303,15 @@ SvgDeviceContext::SvgDeviceContext(int width, int height) : DeviceContext()
     SetPen(AxBLACK, 1, AxSOLID);
 
     m_smufl_glyphs.clear();
+    m_smufl_glyphCodes.clear();
 
     m_committed = false;
     m_vrvTextFont = false;
+    m_outputFlags = pugi::format_default | pugi::format_no_declaration;
+
+    m_dom = dom;
+    // the initial SVG element is written with the header in the stream mode
+    if (!m_dom) return;
 
     // create the initial SVG element
     // width and height need to be set later; these are taken care of in "commit"
@@ -71,8 +324,6 @@ SvgDeviceContext::SvgDeviceContext(int width, int height) : DeviceContext()
     // start the stack
     m_svgNodeStack.push_back(m_svgNode);
     m_currentNode = m_svgNode;
-
-    m_outdata.clear();
 }
 
 SvgDeviceContext::~SvgDeviceContext()
@@ -110,26 +361,18 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     if (m_smufl_glyphs.size() > 0) {
 
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
 
-        // for each needed glyph
-        std::vector<std::string>::const_iterator it;
+        // for each needed glyph, parse its definition as cached by the Resources
+        std::vector<wchar_t>::const_iterator it;
         for (it = m_smufl_glyphs.begin(); it != m_smufl_glyphs.end(); ++it) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source((*it).c_str());
-            sourceDoc.load(source);
-
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                defs.append_copy(child);
-            }
+            const std::string &glyphDef = Resources::GetGlyphDef(*it);
+            if (!glyphDef.empty()) defs.append_buffer(glyphDef.c_str(), glyphDef.size());
         }
     }
 
-    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
     if (xml_declaration) {
         // edit the xml declaration
-        output_flags = pugi::format_default;
+        m_outputFlags = pugi::format_default;
         pugi::xml_node decl = m_svgDoc.prepend_child(pugi::node_declaration);
         decl.append_attribute("version") = "1.0";
         decl.append_attribute("encoding") = "UTF-8";
@@ -141,9 +384,6 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     desc.append_child(pugi::node_pcdata)
         .set_value(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
 
-    // save the glyph data to m_outdata
-    m_svgDoc.save(m_outdata, "\t", output_flags);
-
     m_committed = true;
 }
 
@@ -163,16 +403,17 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         }
     }
 
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = baseClass.c_str();
+    AddElement("g");
+    PushElement();
+    AddAttribute("class", baseClass);
     if (gId.length() > 0) {
-        m_currentNode.append_attribute("id") = gId.c_str();
+        AddAttribute("id", gId);
+        RegisterElement(gId);
     }
 
     // this sets staffDef styles for lyrics
     if (object->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(object);
+        Staff *staff = vrv_cast<Staff *>(object);
         assert(staff);
 
         assert(staff->m_drawingStaffDef);
@@ -192,24 +433,14 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
             styleStr.append(
                 "font-weight:" + staff->AttCommon::FontweightToStr(staff->m_drawingStaffDef->GetLyricWeight()) + ";");
         }
-        if (!styleStr.empty()) m_currentNode.append_attribute("style") = styleStr.c_str();
+        if (!styleStr.empty()) AddAttribute("style", styleStr);
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
         AttColor *att = dynamic_cast<AttColor *>(object);
         assert(att);
         if (att->HasColor()) {
-            m_currentNode.append_attribute("fill") = att->GetColor().c_str();
-        }
-    }
-
-    if (object->HasAttClass(ATT_COMMONPART)) {
-        AttCommonPart *att = dynamic_cast<AttCommonPart *>(object);
-        assert(att);
-        if (att->HasLabel()) {
-            pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
-            svgTitle.append_attribute("class") = "labelAttr";
-            svgTitle.append_child(pugi::node_pcdata).set_value(att->GetLabel().c_str());
+            AddAttribute("fill", att->GetColor());
         }
     }
 
@@ -217,20 +448,18 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         AttLang *att = dynamic_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            AddAttribute("xml:lang", att->GetLang());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
         AttTypography *att = dynamic_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
-        if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style")
-                = att->AttConverter::FontstyleToStr(att->GetFontstyle()).c_str();
-        if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight")
-                = att->AttConverter::FontweightToStr(att->GetFontweight()).c_str();
+        if (att->HasFontname()) AddAttribute("font-family", att->GetFontname());
+        if (att->HasFontstyle()) AddAttribute("font-style", att->AttConverter::FontstyleToStr(att->GetFontstyle()));
+        if (att->HasFontweight()) {
+            AddAttribute("font-weight", att->AttConverter::FontweightToStr(att->GetFontweight()));
+        }
     }
 
     if (object->HasAttClass(ATT_VISIBILITY)) {
@@ -238,14 +467,25 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         assert(att);
         if (att->HasVisible()) {
             if (att->GetVisible() == BOOLEAN_true) {
-                m_currentNode.append_attribute("visibility") = "visible";
+                AddAttribute("visibility", "visible");
             }
             else if (att->GetVisible() == BOOLEAN_false) {
-                m_currentNode.append_attribute("visibility") = "hidden";
+                AddAttribute("visibility", "hidden");
             }
         }
     }
 
+    // the first child, added once all the attributes are written
+    if (object->HasAttClass(ATT_COMMONPART)) {
+        AttCommonPart *att = dynamic_cast<AttCommonPart *>(object);
+        assert(att);
+        if (att->HasLabel()) {
+            AddElement("title");
+            AddAttribute("class", "labelAttr");
+            AddText(att->GetLabel());
+        }
+    }
+
     // m_currentNode.append_attribute("style") = StringFormat("stroke: #%s; stroke-opacity: %f; fill: #%s; fill-opacity:
     // %f;",
     // GetColour(currentPen.GetColour()).c_str(), currentPen.GetOpacity(), GetColour(currentBrush.GetColour()).c_str(),
@@ -258,11 +498,12 @@ void SvgDeviceContext::StartCustomGraphic(std::string name, std::string gClass,
         name.append(" " + gClass);
     }
 
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = name.c_str();
+    AddElement("g");
+    PushElement();
+    AddAttribute("class", name);
     if (gId.length() > 0) {
-        m_currentNode.append_attribute("id") = gId.c_str();
+        AddAttribute("id", gId);
+        RegisterElement(gId);
     }
 }
 
@@ -274,81 +515,69 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
         baseClass.append(" " + gClass);
     }
 
-    m_currentNode = AppendChild("tspan");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = baseClass.c_str();
-    m_currentNode.append_attribute("id") = gId.c_str();
+    AddElement("tspan", true);
+    PushElement();
+    AddAttribute("class", baseClass);
+    AddAttribute("id", gId);
 
     if (object->HasAttClass(ATT_COLOR)) {
         AttColor *att = dynamic_cast<AttColor *>(object);
         assert(att);
-        if (att->HasColor()) m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+        if (att->HasColor()) AddAttribute("fill", att->GetColor());
     }
 
     if (object->HasAttClass(ATT_LANG)) {
         AttLang *att = dynamic_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            AddAttribute("xml:lang", att->GetLang());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
         AttTypography *att = dynamic_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
-        if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style")
-                = att->AttConverter::FontstyleToStr(att->GetFontstyle()).c_str();
-        if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight")
-                = att->AttConverter::FontweightToStr(att->GetFontweight()).c_str();
+        if (att->HasFontname()) AddAttribute("font-family", att->GetFontname());
+        if (att->HasFontstyle()) AddAttribute("font-style", att->AttConverter::FontstyleToStr(att->GetFontstyle()));
+        if (att->HasFontweight()) {
+            AddAttribute("font-weight", att->AttConverter::FontweightToStr(att->GetFontweight()));
+        }
     }
 
     if (object->HasAttClass(ATT_WHITESPACE)) {
         AttWhitespace *att = dynamic_cast<AttWhitespace *>(object);
         assert(att);
         if (att->HasSpace()) {
-            m_currentNode.append_attribute("xml:space") = att->GetSpace().c_str();
-            ;
+            AddAttribute("xml:space", att->GetSpace());
         }
     }
 }
 
 void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
 {
-    std::string xpath = "//g[@id=\"" + gId + "\"]";
-    pugi::xpath_node selection = m_currentNode.select_single_node(xpath.c_str());
-    if (selection) {
-        m_currentNode = selection.node();
-    }
-    m_svgNodeStack.push_back(m_currentNode);
+    ResumeElement(gId);
 }
 
 void SvgDeviceContext::EndGraphic(Object *object, View *view)
 {
     DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    PopElement();
 }
 
 void SvgDeviceContext::EndCustomGraphic()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    PopElement();
 }
 
 void SvgDeviceContext::EndResumedGraphic(Object *object, View *view)
 {
     DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    PopElement();
 }
 
 void SvgDeviceContext::EndTextGraphic(Object *object, View *view)
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    PopElement();
 }
 
 void SvgDeviceContext::StartPage()
@@ -357,36 +586,32 @@ void SvgDeviceContext::StartPage()
     m_vrvTextFont = false;
 
     // default styles
-    m_currentNode = m_currentNode.append_child("style");
-    m_currentNode.append_attribute("type") = "text/css";
-    m_currentNode.append_child(pugi::node_pcdata)
-        .set_value("g.page-margin{font-family:Times;} g.tempo{font-weight:bold;} g.dir, g.dynam {font-style:italic;}");
-    m_currentNode = m_svgNodeStack.back();
+    AddElement("style");
+    AddAttribute("type", "text/css");
+    AddText("g.page-margin{font-family:Times;} g.tempo{font-weight:bold;} g.dir, g.dynam {font-style:italic;}");
 
     // a graphic for definition scaling
-    m_currentNode = m_currentNode.append_child("svg");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "definition-scale";
-    m_currentNode.append_attribute("viewBox")
-        = StringFormat("0 0 %d %d", m_width * DEFINITION_FACTOR, m_height * DEFINITION_FACTOR).c_str();
+    AddElement("svg");
+    PushElement();
+    AddAttribute("class", "definition-scale");
+    AddAttribute("viewBox",
+        "0 0 " + std::to_string(m_width * DEFINITION_FACTOR) + " " + std::to_string(m_height * DEFINITION_FACTOR));
 
     // a graphic for the origin
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "page-margin";
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)).c_str();
+    AddElement("g");
+    PushElement();
+    AddAttribute("class", "page-margin");
+    AddAttribute("transform", "translate(" + std::to_string(m_originX) + ", " + std::to_string(m_originY) + ")");
 }
 
 void SvgDeviceContext::EndPage()
 {
     // end page-margin
-    m_svgNodeStack.pop_back();
+    PopElement();
     // end definition-scale
-    m_svgNodeStack.pop_back();
+    PopElement();
     // end page-scale
-    // m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    // PopElement();
 }
 
 void SvgDeviceContext::SetBackground(int colour, int style)
@@ -439,23 +664,129 @@ pugi::xml_node SvgDeviceContext::AppendChild(std::string name)
         return m_currentNode.append_child(name.c_str());
 }
 
+void SvgDeviceContext::AddElement(const std::string &name, bool beforeGroups)
+{
+    if (!m_dom) {
+        m_stream.AddElement(name, beforeGroups);
+        return;
+    }
+    m_element = (beforeGroups) ? AppendChild(name) : m_currentNode.append_child(name.c_str());
+}
+
+void SvgDeviceContext::AddAttribute(const char *name, const std::string &value)
+{
+    if (!m_dom) {
+        m_stream.AddAttribute(name, value);
+        return;
+    }
+    m_element.append_attribute(name) = value.c_str();
+}
+
+void SvgDeviceContext::AddAttribute(const char *name, int value)
+{
+    if (!m_dom) {
+        m_stream.AddAttribute(name, std::to_string(value));
+        return;
+    }
+    m_element.append_attribute(name) = value;
+}
+
+void SvgDeviceContext::AddAttribute(const char *name, float value)
+{
+    if (!m_dom) {
+        char buffer[128];
+        snprintf(buffer, sizeof(buffer), "%.9g", value);
+        m_stream.AddAttribute(name, buffer);
+        return;
+    }
+    m_element.append_attribute(name) = value;
+}
+
+void SvgDeviceContext::AddAttribute(const char *name, double value)
+{
+    if (!m_dom) {
+        char buffer[128];
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+        m_stream.AddAttribute(name, buffer);
+        return;
+    }
+    m_element.append_attribute(name) = value;
+}
+
+void SvgDeviceContext::AddText(const std::string &text)
+{
+    if (!m_dom) {
+        m_stream.AddText(text);
+        return;
+    }
+    m_element.append_child(pugi::node_pcdata).set_value(text.c_str());
+}
+
+void SvgDeviceContext::PushElement()
+{
+    if (!m_dom) {
+        m_stream.PushElement();
+        return;
+    }
+    m_currentNode = m_element;
+    m_svgNodeStack.push_back(m_currentNode);
+}
+
+void SvgDeviceContext::PopElement()
+{
+    if (!m_dom) {
+        m_stream.PopElement();
+        return;
+    }
+    m_svgNodeStack.pop_back();
+    m_currentNode = m_svgNodeStack.back();
+}
+
+void SvgDeviceContext::RegisterElement(const std::string &id)
+{
+    if (!m_dom) {
+        m_stream.RegisterElement(id);
+        return;
+    }
+    // keep the first one with the id, as the search in the document would do
+    m_graphicNodes.emplace(id, m_currentNode);
+}
+
+void SvgDeviceContext::ResumeElement(const std::string &id)
+{
+    if (!m_dom) {
+        m_stream.ResumeElement(id);
+        return;
+    }
+    std::unordered_map<std::string, pugi::xml_node>::iterator iter = m_graphicNodes.find(id);
+    if (iter != m_graphicNodes.end()) {
+        m_currentNode = iter->second;
+    }
+    m_svgNodeStack.push_back(m_currentNode);
+}
+
 // Drawing methods
 void SvgDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d")
-        = StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
-              bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
-              bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
-              )
-              .c_str();
-    // pathChild.append_attribute("fill") = "#000000";
-    // pathChild.append_attribute("fill-opacity") = "1";
-    pathChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    // pathChild.append_attribute("stroke-opacity") = "1";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+    AddElement("path", true);
+    // M command
+    std::string d = "M" + std::to_string(bezier1[0].x) + "," + std::to_string(bezier1[0].y);
+    // First bezier
+    d += " C" + std::to_string(bezier1[1].x) + "," + std::to_string(bezier1[1].y) + " "
+        + std::to_string(bezier1[2].x) + "," + std::to_string(bezier1[2].y) + " " + std::to_string(bezier1[3].x) + ","
+        + std::to_string(bezier1[3].y);
+    // Second Bezier
+    d += " C" + std::to_string(bezier2[2].x) + "," + std::to_string(bezier2[2].y) + " "
+        + std::to_string(bezier2[1].x) + "," + std::to_string(bezier2[1].y) + " " + std::to_string(bezier2[0].x) + ","
+        + std::to_string(bezier2[0].y);
+    AddAttribute("d", d);
+    // AddAttribute("fill", "#000000");
+    // AddAttribute("fill-opacity", "1");
+    AddAttribute("stroke", "#" + GetColour(m_penStack.top().GetColour()));
+    AddAttribute("stroke-linecap", "round");
+    AddAttribute("stroke-linejoin", "round");
+    // AddAttribute("stroke-opacity", "1");
+    AddAttribute("stroke-width", m_penStack.top().GetWidth());
 }
 
 void SvgDeviceContext::DrawCircle(int x, int y, int radius)
@@ -474,17 +805,16 @@ void SvgDeviceContext::DrawEllipse(int x, int y, int width, int height)
     int rh = height / 2;
     int rw = width / 2;
 
-    pugi::xml_node ellipseChild = AppendChild("ellipse");
-    ellipseChild.append_attribute("cx") = x + rw;
-    ellipseChild.append_attribute("cy") = y + rh;
-    ellipseChild.append_attribute("rx") = rw;
-    ellipseChild.append_attribute("ry") = rh;
-    if (currentBrush.GetOpacity() != 1.0) ellipseChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) ellipseChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    AddElement("ellipse", true);
+    AddAttribute("cx", x + rw);
+    AddAttribute("cy", y + rh);
+    AddAttribute("rx", rw);
+    AddAttribute("ry", rh);
+    if (currentBrush.GetOpacity() != 1.0) AddAttribute("fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) AddAttribute("stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        ellipseChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        ellipseChild.append_attribute("stroke")
-            = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+        AddAttribute("stroke-width", currentPen.GetWidth());
+        AddAttribute("stroke", "#" + GetColour(m_penStack.top().GetColour()));
     }
 }
 
@@ -546,29 +876,30 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
     else
         fSweep = 0;
 
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)),
-                                          abs(int(ry)), fArc, fSweep, int(xe), int(ye))
-                                          .c_str();
-    // pathChild.append_attribute("fill") = "#000000";
-    if (currentBrush.GetOpacity() != 1.0) pathChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) pathChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    AddElement("path", true);
+    AddAttribute("d", "M" + std::to_string(int(xs)) + " " + std::to_string(int(ys)) + " A"
+            + std::to_string(abs(int(rx))) + " " + std::to_string(abs(int(ry))) + " 0.0 " + std::to_string(fArc) + " "
+            + std::to_string(fSweep) + " " + std::to_string(int(xe)) + " " + std::to_string(int(ye)));
+    // AddAttribute("fill", "#000000");
+    if (currentBrush.GetOpacity() != 1.0) AddAttribute("fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) AddAttribute("stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        pathChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        pathChild.append_attribute("stroke")
-            = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+        AddAttribute("stroke-width", currentPen.GetWidth());
+        AddAttribute("stroke", "#" + GetColour(m_penStack.top().GetColour()));
     }
 }
 
 void SvgDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
-    pathChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
-    if (m_penStack.top().GetDashLength() > 0)
-        pathChild.append_attribute("stroke-dasharray")
-            = StringFormat("%d, %d", m_penStack.top().GetDashLength(), m_penStack.top().GetDashLength()).c_str();
-    if (m_penStack.top().GetWidth() > 1) pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+    AddElement("path", true);
+    AddAttribute(
+        "d", "M" + std::to_string(x1) + " " + std::to_string(y1) + " L" + std::to_string(x2) + " " + std::to_string(y2));
+    AddAttribute("stroke", "#" + GetColour(m_penStack.top().GetColour()));
+    if (m_penStack.top().GetDashLength() > 0) {
+        std::string dashLength = std::to_string(m_penStack.top().GetDashLength());
+        AddAttribute("stroke-dasharray", dashLength + ", " + dashLength);
+    }
+    if (m_penStack.top().GetWidth() > 1) AddAttribute("stroke-width", m_penStack.top().GetWidth());
 }
 
 void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style)
@@ -579,28 +910,25 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffs
     Pen currentPen = m_penStack.top();
     Brush currentBrush = m_brushStack.top();
 
-    pugi::xml_node polygonChild = AppendChild("polygon");
+    AddElement("polygon", true);
     // if (fillStyle == wxODDEVEN_RULE)
-    //    polygonChild.append_attribute("fill-rule") = "evenodd;";
+    //    AddAttribute("fill-rule", "evenodd;");
     // else
     if (currentPen.GetWidth() > 0)
-        polygonChild.append_attribute("stroke")
-            = StringFormat("#%s", GetColour(currentPen.GetColour()).c_str()).c_str();
-    if (currentPen.GetWidth() > 1)
-        polygonChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        AddAttribute("stroke", "#" + GetColour(currentPen.GetColour()));
+    if (currentPen.GetWidth() > 1) AddAttribute("stroke-width", currentPen.GetWidth());
     if (currentPen.GetOpacity() != 1.0)
-        polygonChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        AddAttribute("stroke-opacity", std::to_string(currentPen.GetOpacity()));
     if (currentBrush.GetColour() != AxBLACK)
-        polygonChild.append_attribute("fill")
-            = StringFormat("#%s", GetColour(currentBrush.GetColour()).c_str()).c_str();
+        AddAttribute("fill", "#" + GetColour(currentBrush.GetColour()));
     if (currentBrush.GetOpacity() != 1.0)
-        polygonChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+        AddAttribute("fill-opacity", std::to_string(currentBrush.GetOpacity()));
 
     std::string pointsString;
     for (int i = 0; i < n; i++) {
-        pointsString += StringFormat("%d,%d ", points[i].x + xoffset, points[i].y + yoffset);
+        pointsString += std::to_string(points[i].x + xoffset) + "," + std::to_string(points[i].y + yoffset) + " ";
     }
-    polygonChild.append_attribute("points") = pointsString.c_str();
+    AddAttribute("points", pointsString);
 }
 
 void SvgDeviceContext::DrawRectangle(int x, int y, int width, int height)
@@ -622,18 +950,18 @@ void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height,
         x -= width;
     }
 
-    pugi::xml_node rectChild = AppendChild("rect");
-    rectChild.append_attribute("x") = x;
-    rectChild.append_attribute("y") = y;
-    rectChild.append_attribute("height") = height;
-    rectChild.append_attribute("width") = width;
-    if (radius != 0) rectChild.append_attribute("rx") = radius;
+    AddElement("rect", true);
+    AddAttribute("x", x);
+    AddAttribute("y", y);
+    AddAttribute("height", height);
+    AddAttribute("width", width);
+    if (radius != 0) AddAttribute("rx", radius);
     // for empty rectangles with bounding boxes
     /*
-    rectChild.append_attribute("fill-opacity") = "0.0";
-    rectChild.append_attribute("stroke-opacity") = "1.0";
-    rectChild.append_attribute("stroke-width") = "10";
-    rectChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+    AddAttribute("fill-opacity", "0.0");
+    AddAttribute("stroke-opacity", "1.0");
+    AddAttribute("stroke-width", "10");
+    AddAttribute("stroke", StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()));
     */
 }
 
@@ -649,51 +977,51 @@ void SvgDeviceContext::StartText(int x, int y, char alignment)
         anchor = "middle";
     }
 
-    m_currentNode = AppendChild("text");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    AddElement("text", true);
+    PushElement();
+    AddAttribute("x", x);
+    AddAttribute("y", y);
     // unless dx, dy have a value they don't need to be set
-    // m_currentNode.append_attribute("dx") = 0;
-    // m_currentNode.append_attribute("dy") = 0;
+    // AddAttribute("dx", 0);
+    // AddAttribute("dy", 0);
     if (!anchor.empty()) {
-        m_currentNode.append_attribute("text-anchor") = anchor.c_str();
+        AddAttribute("text-anchor", anchor);
     }
     // font-size seems to be required in <text> in FireFox and also we set it to 0px so space
     // is not added between tspan elements
-    m_currentNode.append_attribute("font-size") = "0px";
+    AddAttribute("font-size", "0px");
     //
     if (!m_fontStack.top()->GetFaceName().empty()) {
-        m_currentNode.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        AddAttribute("font-family", m_fontStack.top()->GetFaceName());
     }
     if (m_fontStack.top()->GetStyle() != FONTSTYLE_NONE) {
         if (m_fontStack.top()->GetStyle() == FONTSTYLE_italic) {
-            m_currentNode.append_attribute("font-style") = "italic";
+            AddAttribute("font-style", "italic");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_normal) {
-            m_currentNode.append_attribute("font-style") = "normal";
+            AddAttribute("font-style", "normal");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_oblique) {
-            m_currentNode.append_attribute("font-style") = "oblique";
+            AddAttribute("font-style", "oblique");
         }
     }
     if (m_fontStack.top()->GetWeight() != FONTWEIGHT_NONE) {
         if (m_fontStack.top()->GetWeight() == FONTWEIGHT_bold) {
-            m_currentNode.append_attribute("font-weight") = "bold";
+            AddAttribute("font-weight", "bold");
         }
     }
 }
 
 void SvgDeviceContext::MoveTextTo(int x, int y)
 {
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    // The attributes are added to the text only if nothing was added to it yet
+    AddAttribute("x", x);
+    AddAttribute("y", y);
 }
 
 void SvgDeviceContext::EndText()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    PopElement();
 }
 
 void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtext)
@@ -707,17 +1035,17 @@ void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtex
         svgText.replace(0, 1, "\xC2\xA0");
     }
 
-    pugi::xml_node textChild = AppendChild("tspan");
+    AddElement("tspan", true);
     if (!m_fontStack.top()->GetFaceName().empty()) {
-        textChild.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        AddAttribute("font-family", m_fontStack.top()->GetFaceName());
         // Special case where we want to specifiy if the VerovioText font (woff) needs to be included in the output
         if (m_fontStack.top()->GetFaceName() == "VerovioText") this->VrvTextFont();
     }
     if (m_fontStack.top()->GetPointSize() != 0) {
-        textChild.append_attribute("font-size") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        AddAttribute("font-size", std::to_string(m_fontStack.top()->GetPointSize()) + "px");
     }
-    textChild.append_attribute("class") = "text";
-    textChild.append_child(pugi::node_pcdata).set_value(svgText.c_str());
+    AddAttribute("class", "text");
+    AddText(svgText);
 }
 
 void SvgDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
@@ -731,6 +1059,9 @@ void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, boo
 
     int w, h, gx, gy;
 
+    // the size is the same for all the chars
+    std::string pointSize = std::to_string(m_fontStack.top()->GetPointSize()) + "px";
+
     // print chars one by one
     for (unsigned int i = 0; i < text.length(); i++) {
         wchar_t c = text.at(i);
@@ -739,21 +1070,18 @@ void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, boo
             continue;
         }
 
-        std::string path = glyph->GetPath();
-
         // Add the glyph to the array for the <defs>
-        std::vector<std::string>::const_iterator it = std::find(m_smufl_glyphs.begin(), m_smufl_glyphs.end(), path);
-        if (it == m_smufl_glyphs.end()) {
-            m_smufl_glyphs.push_back(path);
+        if (m_smufl_glyphCodes.insert(c).second) {
+            m_smufl_glyphs.push_back(c);
         }
 
         // Write the char in the SVG
-        pugi::xml_node useChild = AppendChild("use");
-        useChild.append_attribute("xlink:href") = StringFormat("#%s", glyph->GetCodeStr().c_str()).c_str();
-        useChild.append_attribute("x") = x;
-        useChild.append_attribute("y") = y;
-        useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
-        useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        AddElement("use", true);
+        AddAttribute("xlink:href", "#" + glyph->GetCodeStr());
+        AddAttribute("x", x);
+        AddAttribute("y", y);
+        AddAttribute("height", pointSize);
+        AddAttribute("width", pointSize);
 
         // Get the bounds of the char
         if (glyph->GetHorizAdvX() > 0)
@@ -775,9 +1103,6 @@ void SvgDeviceContext::DrawBackgroundImage(int x, int y)
 
 std::string SvgDeviceContext::GetColour(int colour)
 {
-    std::ostringstream ss;
-    ss << std::hex;
-
     switch (colour) {
         case (AxBLACK): return "000000";
         case (AxWHITE): return "FFFFFF";
@@ -790,6 +1115,8 @@ std::string SvgDeviceContext::GetColour(int colour)
             int blue = (colour & 255);
             int green = (colour >> 8) & 255;
             int red = (colour >> 16) & 255;
+            std::ostringstream ss;
+            ss << std::hex;
             ss << red << green << blue;
             // std::strin = wxDecToHex(char(red)) + wxDecToHex(char(green)) + wxDecToHex(char(blue)) ;  // ax3
             return ss.str();
@@ -798,9 +1125,58 @@ std::string SvgDeviceContext::GetColour(int colour)
 
 std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
-    if (!m_committed) Commit(xml_declaration);
+    std::string output;
+    SvgStringWriter writer(&output);
+    this->Write(writer, xml_declaration);
+    return output;
+}
+
+void SvgDeviceContext::WriteSVG(std::ostream &output, bool xml_declaration)
+{
+    pugi::xml_writer_stream writer(output);
+    this->Write(writer, xml_declaration);
+}
+
+void SvgDeviceContext::Write(pugi::xml_writer &writer, bool xml_declaration)
+{
+    if (m_dom) {
+        if (!m_committed) Commit(xml_declaration);
+        m_svgDoc.save(writer, "\t", m_outputFlags);
+        return;
+    }
+
+    // the header as prepended to the document in Commit
+    std::string header;
+    if (xml_declaration) header = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n";
+    header += "<svg width=\"" + std::to_string((int)((double)m_width * m_userScaleX)) + "px\" height=\""
+        + std::to_string((int)((double)m_height * m_userScaleY)) + "px\" version=\"1.1\""
+        + " xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" overflow=\"visible\">\n";
+    header += "\t<desc>";
+    SvgStream::AppendEscaped(header, "Engraved by Verovio " + GetVersion(), false);
+    header += "</desc>\n";
+    writer.write(header.data(), header.size());
+
+    // the <defs> and the woff font are written by pugixml as children of the <svg> element
+    if (m_smufl_glyphs.size() > 0) {
+        pugi::xml_document defsDoc;
+        pugi::xml_node defs = defsDoc.append_child("defs");
+        std::vector<wchar_t>::const_iterator it;
+        for (it = m_smufl_glyphs.begin(); it != m_smufl_glyphs.end(); ++it) {
+            const std::string &glyphDef = Resources::GetGlyphDef(*it);
+            if (!glyphDef.empty()) defs.append_buffer(glyphDef.c_str(), glyphDef.size());
+        }
+        defs.print(writer, "\t", m_outputFlags, pugi::encoding_auto, 1);
+    }
+
+    if (m_vrvTextFont) {
+        std::string woff = Resources::GetPath() + "/woff.xml";
+        pugi::xml_document woffDoc;
+        woffDoc.load_file(woff.c_str());
+        if (woffDoc.first_child()) woffDoc.first_child().print(writer, "\t", m_outputFlags, pugi::encoding_auto, 1);
+    }
 
-    return m_outdata.str();
+    m_stream.Write(writer);
+    writer.write("</svg>\n", 7);
 }
 
 void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
@@ -810,7 +1186,7 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
         BoundingBox *box = object;
         // For floating elements, get the current bounding box set by System::SetCurrentFloatingPositioner
         if (object->IsFloatingObject()) {
-            FloatingObject *floatingObject = dynamic_cast<FloatingObject *>(object);
+            FloatingObject *floatingObject = vrv_cast<FloatingObject *>(object);
             assert(floatingObject);
             box = floatingObject->GetCurrentFloatingPositioner();
             // No bounding box found, ignore the object - this happens when the @staff is missing because the element is
@@ -68,6 +68,7 @@ void Syl::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -77,10 +78,10 @@ void Syl::AddChild(Object *child)
 
 int Syl::PrepareLyrics(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
 
-    Verse *verse = dynamic_cast<Verse *>(this->GetFirstParent(VERSE, MAX_NOTE_DEPTH));
+    Verse *verse = vrv_cast<Verse *>(this->GetFirstParent(VERSE, MAX_NOTE_DEPTH));
     if (verse) {
         m_drawingVerse = std::max(verse->GetN(), 1);
     }
@@ -128,7 +129,7 @@ int Syl::FillStaffCurrentTimeSpanning(FunctorParams *functorParams)
 
 int Syl::AdjustSylSpacing(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     if (!this->HasUpdatedHorizontalBB()) {
@@ -76,10 +76,10 @@ void System::Reset()
 void System::AddChild(Object *child)
 {
     if (child->Is(MEASURE)) {
-        assert(dynamic_cast<Measure *>(child));
+        assert(vrv_cast<Measure *>(child));
     }
     else if (child->Is(SCOREDEF)) {
-        assert(dynamic_cast<ScoreDef *>(child));
+        assert(vrv_cast<ScoreDef *>(child));
     }
     else if (child->IsSystemElement()) {
         assert(dynamic_cast<SystemElement *>(child));
@@ -94,6 +94,7 @@ void System::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -101,7 +102,8 @@ int System::GetDrawingX() const
 {
     if (m_xAbs != VRV_UNSET) return m_xAbs;
 
-    m_cachedDrawingX = 0;
+    // Only write the cached value when it changes since the measures read it concurrently (see Page::ProcessMeasures)
+    if (m_cachedDrawingX != 0) m_cachedDrawingX = 0;
     return m_drawingXRel;
 }
 
@@ -109,7 +111,8 @@ int System::GetDrawingY() const
 {
     if (m_yAbs != VRV_UNSET) return m_yAbs;
 
-    m_cachedDrawingY = 0;
+    // See System::GetDrawingX
+    if (m_cachedDrawingY != 0) m_cachedDrawingY = 0;
     return m_drawingYRel;
 }
 
@@ -200,7 +203,7 @@ int System::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int System::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_xAbs != VRV_UNSET) m_xAbs /= params->m_page->GetPPUFactor();
@@ -213,7 +216,7 @@ int System::ApplyPPUFactor(FunctorParams *functorParams)
 
 int System::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // since we are starting a new system its first scoreDef will need to be a SYSTEM_SCOREDEF
@@ -224,7 +227,7 @@ int System::AlignHorizontally(FunctorParams *functorParams)
 
 int System::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_systemAligner = &m_systemAligner;
@@ -234,7 +237,7 @@ int System::AlignVertically(FunctorParams *functorParams)
 
 int System::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_cumulatedShift = params->m_doc->GetSpacingStaff() * params->m_doc->GetDrawingUnit(100);
@@ -246,7 +249,7 @@ int System::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int System::AdjustYPos(FunctorParams *functorParams)
 {
-    AdjustYPosParams *params = dynamic_cast<AdjustYPosParams *>(functorParams);
+    AdjustYPosParams *params = vrv_cast<AdjustYPosParams *>(functorParams);
     assert(params);
 
     params->m_previousOverflowBelow = 0;
@@ -260,7 +263,7 @@ int System::AdjustYPos(FunctorParams *functorParams)
 
 int System::AlignMeasures(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     SetDrawingXRel(this->m_systemLeftMar + this->GetDrawingLabelsWidth());
@@ -272,7 +275,7 @@ int System::AlignMeasures(FunctorParams *functorParams)
 
 int System::AlignMeasuresEnd(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     m_drawingTotalWidth = params->m_shift + this->GetDrawingLabelsWidth();
@@ -283,7 +286,7 @@ int System::AlignMeasuresEnd(FunctorParams *functorParams)
 
 int System::AlignSystems(FunctorParams *functorParams)
 {
-    AlignSystemsParams *params = dynamic_cast<AlignSystemsParams *>(functorParams);
+    AlignSystemsParams *params = vrv_cast<AlignSystemsParams *>(functorParams);
     assert(params);
 
     SetDrawingYRel(params->m_shift);
@@ -297,7 +300,7 @@ int System::AlignSystems(FunctorParams *functorParams)
 
 int System::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     assert(GetParent());
@@ -332,7 +335,7 @@ int System::JustifyX(FunctorParams *functorParams)
 
 int System::AdjustStaffOverlap(FunctorParams *functorParams)
 {
-    AdjustStaffOverlapParams *params = dynamic_cast<AdjustStaffOverlapParams *>(functorParams);
+    AdjustStaffOverlapParams *params = vrv_cast<AdjustStaffOverlapParams *>(functorParams);
     assert(params);
 
     params->m_previous = NULL;
@@ -343,7 +346,7 @@ int System::AdjustStaffOverlap(FunctorParams *functorParams)
 
 int System::AdjustFloatingPostioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionersParams *params = dynamic_cast<AdjustFloatingPostionersParams *>(functorParams);
+    AdjustFloatingPostionersParams *params = vrv_cast<AdjustFloatingPostionersParams *>(functorParams);
     assert(params);
 
     AdjustFloatingPostionerGrpsParams adjustFloatingPostionerGrpsParams(params->m_doc);
@@ -397,7 +400,7 @@ int System::AdjustFloatingPostioners(FunctorParams *functorParams)
 
 int System::CastOffPages(FunctorParams *functorParams)
 {
-    CastOffPagesParams *params = dynamic_cast<CastOffPagesParams *>(functorParams);
+    CastOffPagesParams *params = vrv_cast<CastOffPagesParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentPage->GetChildCount() > 0)
@@ -411,7 +414,7 @@ int System::CastOffPages(FunctorParams *functorParams)
     // We want to move the system to the currentPage. However, we cannot use DetachChild
     // from the contentPage because this screws up the iterator. Relinquish gives up
     // the ownership of the system - the contentPage itself will be deleted afterwards.
-    System *system = dynamic_cast<System *>(params->m_contentPage->Relinquish(this->GetIdx()));
+    System *system = vrv_cast<System *>(params->m_contentPage->Relinquish(this->GetIdx()));
     assert(system);
     params->m_currentPage->AddChild(system);
 
@@ -420,7 +423,7 @@ int System::CastOffPages(FunctorParams *functorParams)
 
 int System::UnCastOff(FunctorParams *functorParams)
 {
-    UnCastOffParams *params = dynamic_cast<UnCastOffParams *>(functorParams);
+    UnCastOffParams *params = vrv_cast<UnCastOffParams *>(functorParams);
     assert(params);
 
     // Just move all the content of the system to the continous one (parameter)
@@ -433,7 +436,7 @@ int System::UnCastOff(FunctorParams *functorParams)
 
 int System::CastOffSystemsEnd(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     if (params->m_pendingObjects.empty()) return FUNCTOR_STOP;
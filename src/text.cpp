@@ -51,10 +51,10 @@ void Rend::Reset()
 void Rend::AddChild(Object *child)
 {
     if (child->Is(REND)) {
-        assert(dynamic_cast<Rend *>(child));
+        assert(vrv_cast<Rend *>(child));
     }
     else if (child->Is(TEXT)) {
-        assert(dynamic_cast<Text *>(child));
+        assert(vrv_cast<Text *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -66,6 +66,7 @@ void Rend::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
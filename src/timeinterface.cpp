@@ -14,6 +14,8 @@
 //----------------------------------------------------------------------------
 
 #include "attcomparison.h"
+#include "doc.h"
+#include "editorial.h"
 #include "functorparams.h"
 #include "layerelement.h"
 #include "measure.h"
@@ -90,10 +92,40 @@ std::string TimePointInterface::ExtractUuidFragment(std::string refUuid)
     return refUuid;
 }
 
+LayerElement *TimePointInterface::GetIndexedElement(Doc *doc, const std::string &uuid, Measure *measure, bool &lookUp)
+{
+    assert(doc);
+
+    lookUp = false;
+    Object *object = doc->GetIndexedObject(uuid);
+    if (!object) return NULL;
+
+    // From here, another object with the same uuid can still be found by processing the LayerElements
+    lookUp = true;
+    if (!object->IsLayerElement()) return NULL;
+    LayerElement *element = vrv_cast<LayerElement *>(object);
+    assert(element);
+    if (!element->IsTimePointingTarget()) return NULL;
+    if (measure && (element->GetFirstParent(MEASURE) != measure)) return NULL;
+    // The content of hidden editorial elements is not processed
+    Object *parent = element->GetParent();
+    while (parent) {
+        if (parent->IsEditorialElement()) {
+            EditorialElement *editorialElement = vrv_cast<EditorialElement *>(parent);
+            assert(editorialElement);
+            if (editorialElement->m_visibility == Hidden) return NULL;
+        }
+        parent = parent->GetParent();
+    }
+
+    lookUp = false;
+    return element;
+}
+
 Measure *TimePointInterface::GetStartMeasure()
 {
     if (!m_start) return NULL;
-    return dynamic_cast<Measure *>(this->m_start->GetFirstParent(MEASURE));
+    return vrv_cast<Measure *>(this->m_start->GetFirstParent(MEASURE));
 }
 
 bool TimePointInterface::IsOnStaff(int n)
@@ -107,7 +139,7 @@ bool TimePointInterface::IsOnStaff(int n)
         return false;
     }
     else if (m_start) {
-        Staff *staff = dynamic_cast<Staff *>(m_start->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(m_start->GetFirstParent(STAFF));
         if (staff && (staff->GetN() == n)) return true;
     }
     return false;
@@ -122,7 +154,7 @@ std::vector<Staff *> TimePointInterface::GetTstampStaves(Measure *measure)
         staffList = this->GetStaff();
     }
     else if (m_start && !m_start->Is(TIMESTAMP_ATTR)) {
-        Staff *staff = dynamic_cast<Staff *>(m_start->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(m_start->GetFirstParent(STAFF));
         if (staff) staffList.push_back(staff->GetN());
     }
     else if (measure->GetChildCount(STAFF) == 1) {
@@ -197,7 +229,7 @@ bool TimeSpanningInterface::SetStartAndEnd(LayerElement *element)
 Measure *TimeSpanningInterface::GetEndMeasure()
 {
     if (!m_end) return NULL;
-    return dynamic_cast<Measure *>(this->m_end->GetFirstParent(MEASURE));
+    return vrv_cast<Measure *>(this->m_end->GetFirstParent(MEASURE));
 }
 
 bool TimeSpanningInterface::IsSpanningMeasures()
@@ -212,7 +244,7 @@ bool TimeSpanningInterface::IsSpanningMeasures()
 
 int TimePointInterface::InterfacePrepareTimestamps(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     // First we check if the object has already a mapped @startid (it should not)
@@ -241,12 +273,25 @@ int TimePointInterface::InterfaceResetDrawing(FunctorParams *functorParams, Obje
 
 int TimePointInterface::InterfacePrepareTimePointing(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimePointingParams *params = vrv_cast<PrepareTimePointingParams *>(functorParams);
     assert(params);
 
     if (!this->HasStartid()) return FUNCTOR_CONTINUE;
 
     this->SetUuidStr();
+
+    // Look for the start within the measure through the uuid index
+    if (!m_start && !m_startUuid.empty()) {
+        bool lookUp;
+        LayerElement *start = this->GetIndexedElement(
+            params->m_doc, m_startUuid, vrv_cast<Measure *>(object->GetFirstParent(MEASURE)), lookUp);
+        if (start) {
+            this->SetStart(start);
+            return FUNCTOR_CONTINUE;
+        }
+    }
+
+    // Otherwise stack it for the LayerElements of the measure (or for the warning at the end of it)
     params->m_timePointingInterfaces.push_back(std::make_pair(this, object->GetClassId()));
 
     return FUNCTOR_CONTINUE;
@@ -254,7 +299,7 @@ int TimePointInterface::InterfacePrepareTimePointing(FunctorParams *functorParam
 
 int TimeSpanningInterface::InterfacePrepareTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (!this->HasStartid() && !this->HasEndid()) {
@@ -266,14 +311,39 @@ int TimeSpanningInterface::InterfacePrepareTimeSpanning(FunctorParams *functorPa
     }
 
     this->SetUuidStr();
-    params->m_timeSpanningInterfaces.push_back(std::make_pair(this, object->GetClassId()));
+
+    // Look for the start and the end through the uuid index
+    // Dir, dynam and harm are matched only within their measure (see Measure::PrepareTimeSpanningEnd)
+    bool inMeasureOnly = object->Is({ DIR, DYNAM, HARM });
+    Measure *measure = (inMeasureOnly) ? vrv_cast<Measure *>(object->GetFirstParent(MEASURE)) : NULL;
+    bool lookUpStart = false;
+    bool lookUpEnd = false;
+    if (!m_start && !m_startUuid.empty()) {
+        LayerElement *start = this->GetIndexedElement(params->m_doc, m_startUuid, measure, lookUpStart);
+        if (start) this->SetStart(start);
+    }
+    if (!m_end && !m_endUuid.empty()) {
+        LayerElement *end = this->GetIndexedElement(params->m_doc, m_endUuid, measure, lookUpEnd);
+        if (end) this->SetEnd(end);
+    }
+
+    if (this->HasStartAndEnd()) return FUNCTOR_CONTINUE;
+
+    // Stack the ones that can still be matched by processing the LayerElements
+    if (lookUpStart || lookUpEnd) {
+        params->m_timeSpanningInterfaces.push_back(std::make_pair(this, object->GetClassId()));
+    }
+    // Keep the other ones for the @tstamp and @tstamp2 matching, except the ones only within the measure
+    else if (!inMeasureOnly) {
+        params->m_unmatchedInterfaces.push_back(std::make_pair(this, object->GetClassId()));
+    }
 
     return FUNCTOR_CONTINUE;
 }
 
 int TimeSpanningInterface::InterfacePrepareTimestamps(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     // First we check if the object has already a mapped @endid (it should not)
@@ -300,7 +370,7 @@ int TimeSpanningInterface::InterfacePrepareTimestamps(FunctorParams *functorPara
 
 int TimeSpanningInterface::InterfaceFillStaffCurrentTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (this->IsSpanningMeasures()) {
@@ -9,7 +9,17 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <thread>
+
+#if !defined(_WIN32) && !defined(USE_EMSCRIPTEN)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 //----------------------------------------------------------------------------
 
@@ -24,6 +34,7 @@
 #include "note.h"
 #include "page.h"
 #include "slur.h"
+#include "staff.h"
 #include "style.h"
 #include "svgdevicecontext.h"
 #include "vrv.h"
@@ -43,8 +54,6 @@ const char *UTF_16_LE_BOM = "\xFF\xFE";
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_scale = DEFAULT_SCALE;
@@ -60,15 +69,20 @@ Toolkit::Toolkit(bool initFont)
     m_spacingSystem = DEFAULT_SPACING_SYSTEM;
 
     m_noLayout = false;
+    m_lazyLayout = false;
     m_ignoreLayout = false;
     m_adjustPageHeight = false;
     m_noJustification = false;
     m_evenNoteSpacing = false;
+    m_svgDom = false;
+    m_layoutThreads = 1;
+    m_importThreads = 1;
     m_showBoundingBoxes = false;
     m_scoreBasedMei = false;
 
     m_cString = NULL;
     m_humdrumBuffer = NULL;
+    m_font = NULL;
 
     if (initFont) {
         Resources::InitFonts();
@@ -89,8 +103,12 @@ Toolkit::~Toolkit()
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
-    Resources::SetPath(path);
-    return Resources::InitFonts();
+    // Back to the default font, but of the toolkit resource path (the process-wide default is left unchanged)
+    Resources::LoadedFont *font = Resources::LoadDefaultFont(path);
+    if (!font) return false;
+    m_resourcePath = path;
+    m_font = font;
+    return true;
 };
 
 bool Toolkit::SetBorder(int border)
@@ -247,6 +265,11 @@ void Toolkit::SetChoiceXPathQueries(std::vector<std::string> const &xPathQueries
 }
 
 FileFormat Toolkit::IdentifyInputFormat(const string &data)
+{
+    return IdentifyInputFormat(data.c_str(), data.size());
+}
+
+FileFormat Toolkit::IdentifyInputFormat(const char *data, size_t length)
 {
 #ifdef MUSICXML_DEFAULT_HUMDRUM
     FileFormat musicxmlDefault = MUSICXMLHUM;
@@ -255,7 +278,7 @@ FileFormat Toolkit::IdentifyInputFormat(const string &data)
 #endif
 
     size_t searchLimit = 600;
-    if (data.size() == 0) {
+    if (length == 0) {
         return UNKNOWN;
     }
     if (data[0] == 0) {
@@ -278,7 +301,7 @@ FileFormat Toolkit::IdentifyInputFormat(const string &data)
         // <score-partwise> == root node for part-wise organization of MusicXML data
         // <score-timewise> == root node for time-wise organization of MusicXML data
         // <opus> == root node for multi-movement/work organization of MusicXML data
-        string initial = data.substr(0, searchLimit);
+        string initial(data, std::min(length, searchLimit));
 
         if (initial.find("<mei ") != string::npos) {
             return MEI;
@@ -328,7 +351,12 @@ FileFormat Toolkit::IdentifyInputFormat(const string &data)
 
 bool Toolkit::SetFont(std::string const &font)
 {
-    return Resources::SetFont(font);
+    std::string path = m_resourcePath.empty() ? Resources::GetPath() : m_resourcePath;
+    Resources::LoadedFont *loadedFont = Resources::GetFont(path, font);
+    if (!loadedFont) return false;
+    m_font = loadedFont;
+    Resources::SetCurrentFont(m_font);
+    return true;
 };
 
 bool Toolkit::LoadFile(const std::string &filename)
@@ -337,6 +365,25 @@ bool Toolkit::LoadFile(const std::string &filename)
         return LoadUTF16File(filename);
     }
 
+#if !defined(_WIN32) && !defined(USE_EMSCRIPTEN)
+    // Map the file with private pages so it can be parsed in place without being read into a string
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    struct stat fileStat;
+    void *fileMap = MAP_FAILED;
+    if ((fstat(fd, &fileStat) == 0) && S_ISREG(fileStat.st_mode) && (fileStat.st_size > 0)) {
+        fileMap = mmap(NULL, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (fileMap != MAP_FAILED) {
+        bool success = LoadBuffer(static_cast<char *>(fileMap), fileStat.st_size, true);
+        munmap(fileMap, fileStat.st_size);
+        return success;
+    }
+#endif
+
     std::ifstream in(filename.c_str());
     if (!in.is_open()) {
         return false;
@@ -351,7 +398,7 @@ bool Toolkit::LoadFile(const std::string &filename)
     std::string content(fileSize, 0);
     in.read(&content[0], fileSize);
 
-    return LoadData(content);
+    return LoadBuffer(&content[0], content.size(), true);
 }
 
 bool Toolkit::IsUTF16(const std::string &filename)
@@ -406,12 +453,27 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
 
 bool Toolkit::LoadData(const std::string &data)
 {
+    return LoadData(data.c_str(), data.size());
+}
+
+bool Toolkit::LoadData(const char *data, size_t length)
+{
+    // The buffer is not modified when not loaded in place
+    return LoadBuffer(const_cast<char *>(data), length, false);
+}
+
+bool Toolkit::LoadBuffer(char *data, size_t length, bool inPlace)
+{
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+
     string newData;
     FileInputStream *input = NULL;
 
     auto inputFormat = m_format;
     if (inputFormat == AUTO) {
-        inputFormat = IdentifyInputFormat(data);
+        inputFormat = IdentifyInputFormat(data, length);
     }
 
     if (inputFormat == PAE) {
@@ -424,32 +486,15 @@ bool Toolkit::LoadData(const std::string &data)
     else if (inputFormat == HUMDRUM) {
         // LogMessage("Importing Humdrum data");
 
-        Doc tempdoc;
-        HumdrumInput *tempinput = new HumdrumInput(&tempdoc, "");
-        tempinput->SetTypeOption(GetHumType());
+        // The Humdrum data is imported directly into the document
+        HumdrumInput *huminput = new HumdrumInput(&m_doc, "");
+        huminput->SetTypeOption(GetHumType());
 
         if (GetOutputFormat() == HUMDRUM) {
-            tempinput->SetOutputFormat("humdrum");
-        }
-
-        if (!tempinput->ImportString(data)) {
-            LogError("Error importing Humdrum data");
-            delete tempinput;
-            return false;
+            huminput->SetOutputFormat("humdrum");
         }
 
-        SetHumdrumBuffer(tempinput->GetHumdrumString().c_str());
-
-        if (GetOutputFormat() == HUMDRUM) {
-            return true;
-        }
-
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-
-        input = new MeiInput(&m_doc, "");
+        input = huminput;
     }
 #endif
     else if (inputFormat == MEI) {
@@ -457,37 +502,34 @@ bool Toolkit::LoadData(const std::string &data)
     }
     else if (inputFormat == MUSICXML) {
         // This is the direct converter from MusicXML to MEI using iomusicxml:
-        input = new MusicXmlInput(&m_doc, "");
+        MusicXmlInput *musicxmlInput = new MusicXmlInput(&m_doc, "");
+        musicxmlInput->SetImportThreads(GetImportThreads());
+        input = musicxmlInput;
     }
 #ifndef NO_HUMDRUM_SUPPORT
     else if (inputFormat == MUSICXMLHUM) {
         // This is the indirect converter from MusicXML to MEI using iohumdrum:
         hum::Tool_musicxml2hum converter;
         pugi::xml_document xmlfile;
-        xmlfile.load(data.c_str());
+        if (inPlace) {
+            xmlfile.load_buffer_inplace(data, length, pugi::parse_default, pugi::encoding_utf8);
+        }
+        else {
+            xmlfile.load_buffer(data, length, pugi::parse_default, pugi::encoding_utf8);
+        }
         stringstream conversion;
         bool status = converter.convert(conversion, xmlfile);
         if (!status) {
             LogError("Error converting MusicXML");
             return false;
         }
-        std::string buffer = conversion.str();
-        SetHumdrumBuffer(buffer.c_str());
-
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        FileInputStream *tempinput = new HumdrumInput(&tempdoc, "");
-        tempinput->SetTypeOption(GetHumType());
-        if (!tempinput->ImportString(conversion.str())) {
-            LogError("Error importing Humdrum data");
-            delete tempinput;
-            return false;
-        }
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MeiInput(&m_doc, "");
+        newData = conversion.str();
+        SetHumdrumBuffer(newData.c_str());
+
+        // Now import the Humdrum data directly into the document
+        HumdrumInput *huminput = new HumdrumInput(&m_doc, "");
+        huminput->SetTypeOption(GetHumType());
+        input = huminput;
     }
 #endif
     else {
@@ -502,23 +544,67 @@ bool Toolkit::LoadData(const std::string &data)
     }
 
     // xpath queries?
-    if (m_appXPathQueries.size() > 0) {
-        input->SetAppXPathQueries(m_appXPathQueries);
+    auto setXPathQueries = [this](FileInputStream *input) {
+        if (m_appXPathQueries.size() > 0) {
+            input->SetAppXPathQueries(m_appXPathQueries);
+        }
+        if (m_choiceXPathQueries.size() > 0) {
+            input->SetChoiceXPathQueries(m_choiceXPathQueries);
+        }
+        if (m_mdivXPathQuery.length() > 0) {
+            input->SetMdivXPathQuery(m_mdivXPathQuery);
+        }
+    };
+    setXPathQueries(input);
+
+    // load the file
+    bool success = false;
+    if (newData.size()) {
+        success = input->ImportString(newData);
     }
-    if (m_choiceXPathQueries.size() > 0) {
-        input->SetChoiceXPathQueries(m_choiceXPathQueries);
+    else if (inPlace) {
+        success = input->ImportBufferInPlace(data, length);
     }
-    if (m_mdivXPathQuery.length() > 0) {
-        input->SetMdivXPathQuery(m_mdivXPathQuery);
+    else {
+        success = input->ImportBuffer(data, length);
     }
-
-    // load the file
-    if (!input->ImportString(newData.size() ? newData : data)) {
+    if (!success) {
         LogError("Error importing data");
         delete input;
         return false;
     }
 
+#ifndef NO_HUMDRUM_SUPPORT
+    if (inputFormat == HUMDRUM) {
+        HumdrumInput *huminput = vrv_cast<HumdrumInput *>(input);
+        assert(huminput);
+        SetHumdrumBuffer(huminput->GetHumdrumString().c_str());
+
+        if (GetOutputFormat() == HUMDRUM) {
+            delete input;
+            return true;
+        }
+    }
+
+    // The Humdrum input neither selects the <mdiv> nor makes only one <lem> or <rdg> (or child of <choice>)
+    // visible. This is done by the MEI input, so a document that needs it is written to MEI and read again.
+    if (((inputFormat == HUMDRUM) || (inputFormat == MUSICXMLHUM))
+        && ((m_mdivXPathQuery.length() > 0) || m_doc.FindChildByType(APP) || m_doc.FindChildByType(CHOICE))) {
+        MeiOutput meioutput(&m_doc, "");
+        meioutput.SetScoreBasedMEI(true);
+        newData = meioutput.GetOutput();
+        delete input;
+
+        input = new MeiInput(&m_doc, "");
+        setXPathQueries(input);
+        if (!input->ImportString(newData)) {
+            LogError("Error importing data");
+            delete input;
+            return false;
+        }
+    }
+#endif
+
     m_doc.SetPageHeight(this->GetPageHeight());
     m_doc.SetPageWidth(this->GetPageWidth());
     m_doc.SetPageRightMar(this->GetBorder());
@@ -529,6 +615,7 @@ bool Toolkit::LoadData(const std::string &data)
     m_doc.SetSpacingStaff(this->GetSpacingStaff());
     m_doc.SetSpacingSystem(this->GetSpacingSystem());
     m_doc.SetEvenSpacing(this->GetEvenNoteSpacing());
+    m_doc.SetLayoutThreads(this->GetLayoutThreads());
 
     m_doc.PrepareDrawing();
 
@@ -542,6 +629,9 @@ bool Toolkit::LoadData(const std::string &data)
             m_doc.CastOffEncodingDoc();
             // LogElapsedTimeEnd("layout");
         }
+        else if (m_lazyLayout) {
+            m_doc.CastOffDocLazily();
+        }
         else {
             // LogElapsedTimeStart();
             m_doc.CastOffDoc();
@@ -565,6 +655,11 @@ std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
     // Page number is one-based - correct it to 0-based first
     pageNo--;
 
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+    m_doc.CastOffDocUpTo(-1);
+
     MeiOutput meioutput(&m_doc, "");
     meioutput.SetScoreBasedMEI(scoreBased);
     return meioutput.GetOutput(pageNo);
@@ -572,6 +667,11 @@ std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
 
 bool Toolkit::SaveFile(const std::string &filename)
 {
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+    m_doc.CastOffDocUpTo(-1);
+
     MeiOutput meioutput(&m_doc, filename.c_str());
     meioutput.SetScoreBasedMEI(m_scoreBasedMei);
     if (!meioutput.ExportFile()) {
@@ -645,7 +745,11 @@ bool Toolkit::ParseOptions(const std::string &json_options)
 
     if (json.has<jsonxx::String>("mdivXPathQuery")) SetMdivXPathQuery(json.get<jsonxx::String>("mdivXPathQuery"));
 
-    if (json.has<jsonxx::Number>("xmlIdSeed")) Object::SeedUuid(json.get<jsonxx::Number>("xmlIdSeed"));
+    if (json.has<jsonxx::Number>("layoutThreads")) SetLayoutThreads(json.get<jsonxx::Number>("layoutThreads"));
+
+    if (json.has<jsonxx::Number>("importThreads")) SetImportThreads(json.get<jsonxx::Number>("importThreads"));
+
+    if (json.has<jsonxx::Number>("xmlIdSeed")) SetXmlIdSeed(json.get<jsonxx::Number>("xmlIdSeed"));
 
     // Parse the various flags
     // Note: it seems that there is a bug with jsonxx and emscripten
@@ -653,6 +757,8 @@ bool Toolkit::ParseOptions(const std::string &json_options)
 
     if (json.has<jsonxx::Number>("noLayout")) SetNoLayout(json.get<jsonxx::Number>("noLayout"));
 
+    if (json.has<jsonxx::Number>("lazyLayout")) SetLazyLayout(json.get<jsonxx::Number>("lazyLayout"));
+
     if (json.has<jsonxx::Number>("ignoreLayout")) SetIgnoreLayout(json.get<jsonxx::Number>("ignoreLayout"));
 
     if (json.has<jsonxx::Number>("adjustPageHeight")) SetAdjustPageHeight(json.get<jsonxx::Number>("adjustPageHeight"));
@@ -666,6 +772,8 @@ bool Toolkit::ParseOptions(const std::string &json_options)
     if (json.has<jsonxx::Number>("showBoundingBoxes"))
         SetShowBoundingBoxes(json.get<jsonxx::Number>("showBoundingBoxes"));
 
+    if (json.has<jsonxx::Number>("svgDom")) SetSvgDom(json.get<jsonxx::Number>("svgDom"));
+
     return true;
 #else
     // The non-js version of the app should not use this function.
@@ -673,6 +781,12 @@ bool Toolkit::ParseOptions(const std::string &json_options)
 #endif
 }
 
+void Toolkit::SetXmlIdSeed(int seed)
+{
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+    Object::SeedUuid(seed);
+}
+
 std::string Toolkit::GetElementAttr(const std::string &xmlId)
 {
 #if defined(USE_EMSCRIPTEN) || defined(PYTHON_BINDING)
@@ -706,6 +820,9 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
 bool Toolkit::Edit(const std::string &json_editorAction)
 {
 #ifdef USE_EMSCRIPTEN
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
 
     jsonxx::Object json;
 
@@ -787,11 +904,19 @@ void Toolkit::RedoLayout()
     m_doc.SetPageRightMar(this->GetBorder());
     m_doc.SetPageLeftMar(this->GetBorder());
     m_doc.SetPageTopMar(this->GetBorder());
+    m_doc.SetSpacingLinear(this->GetSpacingLinear());
+    m_doc.SetSpacingNonLinear(this->GetSpacingNonLinear());
     m_doc.SetSpacingStaff(this->GetSpacingStaff());
     m_doc.SetSpacingSystem(this->GetSpacingSystem());
+    m_doc.SetEvenSpacing(this->GetEvenNoteSpacing());
+    m_doc.SetLayoutThreads(this->GetLayoutThreads());
 
-    m_doc.UnCastOffDoc();
-    m_doc.CastOffDoc();
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+
+    // Only the pages modified by Toolkit::Edit are cast off again
+    m_doc.RedoCastOffDoc();
 }
 
 void Toolkit::RedoPagePitchPosLayout()
@@ -803,44 +928,72 @@ void Toolkit::RedoPagePitchPosLayout()
         return;
     }
 
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+
     page->LayOutPitchPos();
 }
 
-std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
+void Toolkit::SetSvgPage(int pageNo, int &width, int &height)
 {
     // Page number is one-based - correct it to 0-based first
     pageNo--;
 
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+
+    // Cast off the pages up to the requested one if the layout is lazy
+    m_doc.CastOffDocUpTo(pageNo);
+
     // Get the current system for the SVG clipping size
     m_view.SetPage(pageNo);
 
     // Adjusting page width and height according to the options
-    int width = m_pageWidth;
-    int height = m_pageHeight;
+    width = m_pageWidth;
+    height = m_pageHeight;
 
     if (m_noLayout) width = m_doc.GetAdjustedDrawingPageWidth();
     if (m_adjustPageHeight || m_noLayout) height = m_doc.GetAdjustedDrawingPageHeight();
+}
 
-    // Create the SVG object, h & w come from the system
-    // We will need to set the size of the page after having drawn it depending on the options
-    SvgDeviceContext svg(width, height);
+void Toolkit::DrawSvgPage(SvgDeviceContext *svg, View *view, Page *page)
+{
+    assert(svg);
+    assert(view);
+    assert(page);
 
     // set scale and border from user options
-    svg.SetUserScale(m_view.GetPPUFactor() * (double)m_scale / 100, m_view.GetPPUFactor() * (double)m_scale / 100);
+    svg->SetUserScale(page->GetPPUFactor() * (double)m_scale / 100, page->GetPPUFactor() * (double)m_scale / 100);
 
     // debug BB?
-    svg.SetDrawBoundingBoxes(m_showBoundingBoxes);
+    svg->SetDrawBoundingBoxes(m_showBoundingBoxes);
 
     // render the page
-    m_view.DrawCurrentPage(&svg, false);
+    view->DrawPage(svg, page, false);
+}
 
-    std::string out_str = svg.GetStringSVG(xml_declaration);
-    return out_str;
+std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
+{
+    int width, height;
+    this->SetSvgPage(pageNo, width, height);
+
+    // Create the SVG object, h & w come from the system
+    // We will need to set the size of the page after having drawn it depending on the options
+    SvgDeviceContext svg(width, height, m_svgDom);
+    this->DrawSvgPage(&svg, &m_view, m_doc.GetDrawingPage());
+
+    return svg.GetStringSVG(xml_declaration);
 }
 
 bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
 {
-    std::string output = RenderToSvg(pageNo, true);
+    int width, height;
+    this->SetSvgPage(pageNo, width, height);
+
+    SvgDeviceContext svg(width, height, m_svgDom);
+    this->DrawSvgPage(&svg, &m_view, m_doc.GetDrawingPage());
 
     std::ofstream outfile;
     outfile.open(filename.c_str());
@@ -850,11 +1003,81 @@ bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
         return false;
     }
 
-    outfile << output;
+    // write the SVG directly to the file without an intermediate string
+    svg.WriteSVG(outfile, true);
     outfile.close();
     return true;
 }
 
+std::vector<std::string> Toolkit::RenderAllToSvg(int threads, bool xml_declaration)
+{
+    int pageCount = this->GetPageCount();
+    std::vector<std::string> svgs(pageCount);
+
+#ifdef USE_EMSCRIPTEN
+    threads = 1;
+#endif
+
+    // Pages with their own dimensions change the drawing values of the document and cannot be drawn concurrently
+    bool concurrent = (threads > 1) && (pageCount > 1);
+    int i;
+    for (i = 0; concurrent && (i < pageCount); i++) {
+        Page *page = vrv_cast<Page *>(m_doc.GetChild(i));
+        assert(page);
+        if (page->m_pageHeight != -1) concurrent = false;
+    }
+
+    if (!concurrent) {
+        for (i = 0; i < pageCount; i++) svgs.at(i) = this->RenderToSvg(i + 1, xml_declaration);
+        return svgs;
+    }
+
+    // Lay out all the pages first since this changes the document
+    // Without page dimensions of their own, the drawing values set on the document are the same for every page and
+    // the drawing threads only read them. Everything else changed when drawing belongs to the page drawn.
+    std::vector<int> widths(pageCount);
+    std::vector<int> heights(pageCount);
+    for (i = 0; i < pageCount; i++) this->SetSvgPage(i + 1, widths.at(i), heights.at(i));
+
+    std::vector<bool> linkedPages;
+    m_doc.PrepareParallelDrawing(linkedPages);
+
+    // Group the linked pages together - each group is drawn by one thread
+    std::vector<std::pair<int, int> > groups;
+    int first = 0;
+    for (i = 0; i < pageCount; i++) {
+        if (linkedPages.at(i) && (i < pageCount - 1)) continue;
+        groups.push_back(std::make_pair(first, i));
+        first = i + 1;
+    }
+
+    std::atomic<int> nextGroup(0);
+    auto drawGroups = [&]() {
+        Resources::SetCurrentFont(m_font);
+        View view;
+        view.SetDoc(&m_doc);
+        int group;
+        while ((group = nextGroup++) < (int)groups.size()) {
+            for (int j = groups.at(group).first; j <= groups.at(group).second; j++) {
+                Page *page = vrv_cast<Page *>(m_doc.GetChild(j));
+                assert(page);
+                SvgDeviceContext svg(widths.at(j), heights.at(j), m_svgDom);
+                this->DrawSvgPage(&svg, &view, page);
+                svgs.at(j) = svg.GetStringSVG(xml_declaration);
+            }
+        }
+    };
+
+    threads = std::min(threads, (int)groups.size());
+    std::vector<std::thread> workers;
+    for (i = 1; i < threads; i++) workers.push_back(std::thread(drawGroups));
+    // The current thread draws too
+    drawGroups();
+    for (i = 0; i < (int)workers.size(); i++) workers.at(i).join();
+
+    return svgs;
+}
+
 std::string Toolkit::GetHumdrum()
 {
     return GetHumdrumBuffer();
@@ -902,16 +1125,19 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     jsonxx::Array a;
 
     double time = (double)(millisec * 120 / 1000);
-    NoteOnsetOffsetComparison matchTime(time);
     ArrayOfObjects notes;
     // Here we would need to check that the midi export is done
     if (m_doc.GetMidiExportDone()) {
-        m_doc.FindAllChildByAttComparison(&notes, &matchTime);
+        m_doc.FindNotesAtTime(time, &notes);
+        // The page numbers are known only once the entire document is cast off
+        Resources::SetCurrentFont(m_font);
+        Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+        m_doc.CastOffDocUpTo(-1);
 
         // Get the pageNo from the first note (if any)
         int pageNo = -1;
         if (notes.size() > 0) {
-            Page *page = dynamic_cast<Page *>(notes.at(0)->GetFirstParent(PAGE));
+            Page *page = vrv_cast<Page *>(notes.at(0)->GetFirstParent(PAGE));
             if (page) pageNo = page->GetIdx() + 1;
         }
 
@@ -930,6 +1156,67 @@ std::string Toolkit::GetElementsAtTime(int millisec)
 #endif
 }
 
+std::string Toolkit::GetElementChangesBetweenTimes(int startMillisec, int endMillisec)
+{
+#if defined(USE_EMSCRIPTEN) || defined(PYTHON_BINDING)
+    jsonxx::Object o;
+    jsonxx::Array changes;
+
+    double startTime = (double)(startMillisec * 120 / 1000);
+    double endTime = (double)(endMillisec * 120 / 1000);
+    ArrayOfObjects notes;
+    if (m_doc.GetMidiExportDone()) {
+        m_doc.FindNotesChangingBetweenTimes(startTime, endTime, &notes);
+        // The page numbers are known only once the entire document is cast off
+        Resources::SetCurrentFont(m_font);
+        Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+        m_doc.CastOffDocUpTo(-1);
+
+        // Group the notes starting and ending by time
+        std::map<double, std::pair<ArrayOfObjects, ArrayOfObjects> > notesByTime;
+        ArrayOfObjects::iterator iter;
+        for (iter = notes.begin(); iter != notes.end(); iter++) {
+            Note *note = vrv_cast<Note *>(*iter);
+            assert(note);
+            if ((note->m_playingOnset >= startTime) && (note->m_playingOnset < endTime)) {
+                notesByTime[note->m_playingOnset].first.push_back(note);
+            }
+            if ((note->m_playingOffset >= startTime) && (note->m_playingOffset < endTime)) {
+                notesByTime[note->m_playingOffset].second.push_back(note);
+            }
+        }
+
+        std::map<double, std::pair<ArrayOfObjects, ArrayOfObjects> >::iterator timeIter;
+        for (timeIter = notesByTime.begin(); timeIter != notesByTime.end(); timeIter++) {
+            ArrayOfObjects &on = timeIter->second.first;
+            ArrayOfObjects &off = timeIter->second.second;
+            jsonxx::Object change;
+            jsonxx::Array onIds;
+            jsonxx::Array offIds;
+            for (iter = on.begin(); iter != on.end(); iter++) onIds << (*iter)->GetUuid();
+            for (iter = off.begin(); iter != off.end(); iter++) offIds << (*iter)->GetUuid();
+
+            // Get the pageNo from the first note starting (or ending)
+            int pageNo = -1;
+            Object *first = (!on.empty()) ? on.at(0) : off.at(0);
+            Page *page = vrv_cast<Page *>(first->GetFirstParent(PAGE));
+            if (page) pageNo = page->GetIdx() + 1;
+
+            change << "time" << timeIter->first * 1000 / 120;
+            change << "on" << onIds;
+            change << "off" << offIds;
+            change << "page" << pageNo;
+            changes << change;
+        }
+        o << "changes" << changes;
+    }
+    return o.json();
+#else
+    // The non-js version of the app should not use this function.
+    return "";
+#endif
+}
+
 bool Toolkit::RenderToMidiFile(const std::string &filename)
 {
     MidiFile outputfile;
@@ -941,18 +1228,31 @@ bool Toolkit::RenderToMidiFile(const std::string &filename)
     return true;
 }
 
-int Toolkit::GetPageCount()
+int Toolkit::GetPageCount(bool estimate)
 {
+    if (estimate) return m_doc.GetEstimatedPageCount();
+
+    // The number of pages is known only once the entire document is cast off
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+    m_doc.CastOffDocUpTo(-1);
+
     return m_doc.GetPageCount();
 }
 
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+    m_doc.CastOffDocUpTo(-1);
+
     Object *element = m_doc.FindChildByUuid(xmlId);
     if (!element) {
         return 0;
     }
-    Page *page = dynamic_cast<Page *>(element->GetFirstParent(PAGE));
+    Page *page = vrv_cast<Page *>(element->GetFirstParent(PAGE));
     if (!page) {
         return 0;
     }
@@ -964,7 +1264,7 @@ double Toolkit::GetTimeForElement(const std::string &xmlId)
     Object *element = m_doc.FindChildByUuid(xmlId);
     double timeofElement = 0.0;
     if (element->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
         timeofElement = note->m_playingOnset * 1000 / 120;
     }
@@ -1072,15 +1372,16 @@ bool Toolkit::Drag(std::string elementId, int x, int y)
         element = m_doc.FindChildByUuid(elementId);
     }
     if (element->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
-        Layer *layer = dynamic_cast<Layer *>(note->GetFirstParent(LAYER));
+        Layer *layer = vrv_cast<Layer *>(note->GetFirstParent(LAYER));
         if (!layer) return false;
         int oct;
         data_PITCHNAME pname
             = (data_PITCHNAME)m_view.CalculatePitchCode(layer, m_view.ToLogicalY(y), note->GetDrawingX(), &oct);
         note->SetPname(pname);
         note->SetOct(oct);
+        m_doc.SetCastOffModified(note);
         return true;
     }
     return false;
@@ -1090,6 +1391,11 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
 {
     LogMessage("Insert!");
     if (!m_doc.GetDrawingPage()) return false;
+
+    // Use the font and the uuid generator of the toolkit in the current thread
+    Resources::SetCurrentFont(m_font);
+    Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+
     Object *start = m_doc.GetDrawingPage()->FindChildByUuid(startid);
     Object *end = m_doc.GetDrawingPage()->FindChildByUuid(endid);
     // Check if both start and end elements exist
@@ -1098,23 +1404,34 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
         return false;
     }
     // Check if it is a LayerElement
-    if (!dynamic_cast<LayerElement *>(start)) {
+    if (!start->IsLayerElement()) {
         LogMessage("Element '%s' is not supported as start element", start->GetClassName().c_str());
         return false;
     }
-    if (!dynamic_cast<LayerElement *>(end)) {
-        LogMessage("Element '%s' is not supported as end element", start->GetClassName().c_str());
+    if (!end->IsLayerElement()) {
+        LogMessage("Element '%s' is not supported as end element", end->GetClassName().c_str());
         return false;
     }
 
-    Measure *measure = dynamic_cast<Measure *>(start->GetFirstParent(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(start->GetFirstParent(MEASURE));
     assert(measure);
+    Measure *endMeasure = vrv_cast<Measure *>(end->GetFirstParent(MEASURE));
+    assert(endMeasure);
     if (elementType == "slur") {
         Slur *slur = new Slur();
         slur->SetStartid(startid);
         slur->SetEndid(endid);
         measure->AddChild(slur);
-        m_doc.PrepareDrawing();
+        slur->SetStart(vrv_cast<LayerElement *>(start));
+        slur->SetEnd(vrv_cast<LayerElement *>(end));
+        // Only prepare the measures of the slur instead of preparing the drawing of the entire document again
+        if (!m_doc.PrepareMeasuresTimeSpanning(measure, endMeasure)) {
+            LogMessage("Element '%s' does not follow '%s'", endid.c_str(), startid.c_str());
+            measure->DeleteChild(slur);
+            return false;
+        }
+        m_doc.SetCastOffModified(start);
+        m_doc.SetCastOffModified(end);
         return true;
     }
     return false;
@@ -1124,16 +1441,22 @@ bool Toolkit::Set(std::string elementId, std::string attrType, std::string attrV
 {
     if (!m_doc.GetDrawingPage()) return false;
     Object *element = m_doc.GetDrawingPage()->FindChildByUuid(elementId);
-    if (Att::SetCmn(element, attrType, attrValue)) return true;
-    if (Att::SetCmnornaments(element, attrType, attrValue)) return true;
-    if (Att::SetCritapp(element, attrType, attrValue)) return true;
-    if (Att::SetExternalsymbols(element, attrType, attrValue)) return true;
-    if (Att::SetMei(element, attrType, attrValue)) return true;
-    if (Att::SetMensural(element, attrType, attrValue)) return true;
-    if (Att::SetMidi(element, attrType, attrValue)) return true;
-    if (Att::SetPagebased(element, attrType, attrValue)) return true;
-    if (Att::SetShared(element, attrType, attrValue)) return true;
-    return false;
+    bool success = Att::SetCmn(element, attrType, attrValue) || Att::SetCmnornaments(element, attrType, attrValue)
+        || Att::SetCritapp(element, attrType, attrValue) || Att::SetExternalsymbols(element, attrType, attrValue)
+        || Att::SetMei(element, attrType, attrValue) || Att::SetMensural(element, attrType, attrValue)
+        || Att::SetMidi(element, attrType, attrValue) || Att::SetPagebased(element, attrType, attrValue)
+        || Att::SetShared(element, attrType, attrValue);
+    if (!success) return false;
+
+    // The stems, flags and dots depend on the attributes (e.g., @dur) - prepare them again only for the layer
+    Object *layer = element->GetFirstParent(LAYER);
+    if (layer) {
+        Object::SetCurrentUuidGenerator(m_doc.GetUuidGenerator());
+        Functor prepareLayerElementParts(&Object::PrepareLayerElementParts);
+        layer->Process(&prepareLayerElementParts, NULL);
+    }
+    m_doc.SetCastOffModified(element);
+    return true;
 }
 
 #ifdef USE_EMSCRIPTEN
@@ -59,25 +59,25 @@ void Tuplet::Reset()
 void Tuplet::AddChild(Object *child)
 {
     if (child->Is(BEAM)) {
-        assert(dynamic_cast<Beam *>(child));
+        assert(vrv_cast<Beam *>(child));
     }
     else if (child->Is(CHORD)) {
-        assert(dynamic_cast<Chord *>(child));
+        assert(vrv_cast<Chord *>(child));
     }
     else if (child->Is(CLEF)) {
-        assert(dynamic_cast<Clef *>(child));
+        assert(vrv_cast<Clef *>(child));
     }
     else if (child->Is(NOTE)) {
-        assert(dynamic_cast<Note *>(child));
+        assert(vrv_cast<Note *>(child));
     }
     else if (child->Is(REST)) {
-        assert(dynamic_cast<Rest *>(child));
+        assert(vrv_cast<Rest *>(child));
     }
     else if (child->Is(SPACE)) {
-        assert(dynamic_cast<Space *>(child));
+        assert(vrv_cast<Space *>(child));
     }
     else if (child->Is(TUPLET)) {
-        assert(dynamic_cast<Tuplet *>(child));
+        assert(vrv_cast<Tuplet *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -89,6 +89,7 @@ void Tuplet::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -51,7 +51,7 @@ void Verse::Reset()
 void Verse::AddChild(Object *child)
 {
     if (child->Is(SYL)) {
-        assert(dynamic_cast<Syl *>(child));
+        assert(vrv_cast<Syl *>(child));
     }
     else if (child->IsEditorialElement()) {
         assert(dynamic_cast<EditorialElement *>(child));
@@ -63,6 +63,7 @@ void Verse::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    this->AddToDocUuidIndex(child);
     Modify();
 }
 
@@ -72,7 +73,7 @@ void Verse::AddChild(Object *child)
 
 int Verse::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     // this gets (or creates) the measureAligner for the measure
@@ -88,12 +89,12 @@ int Verse::AlignVertically(FunctorParams *functorParams)
 
 int Verse::PrepareProcessingLists(FunctorParams *functorParams)
 {
-    PrepareProcessingListsParams *params = dynamic_cast<PrepareProcessingListsParams *>(functorParams);
+    PrepareProcessingListsParams *params = vrv_cast<PrepareProcessingListsParams *>(functorParams);
     assert(params);
     // StaffN_LayerN_VerseN_t *tree = static_cast<StaffN_LayerN_VerseN_t*>((*params).at(0));
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(staff && layer);
 
     params->m_verseTree.child[staff->GetN()].child[layer->GetN()].child[this->GetN()];
@@ -78,7 +78,7 @@ StaffAlignment *SystemAligner::GetStaffAlignmentForStaffN(int staffN) const
     StaffAlignment *alignment = NULL;
     int i;
     for (i = 0; i < this->GetChildCount(); i++) {
-        alignment = dynamic_cast<StaffAlignment *>(m_children.at(i));
+        alignment = vrv_cast<StaffAlignment *>(m_children.at(i));
         assert(alignment);
 
         if ((alignment->GetStaff()) && (alignment->GetStaff()->GetN() == staffN)) return alignment;
@@ -115,6 +115,7 @@ void StaffAlignment::ClearPositioners()
         delete *iter;
     }
     m_floatingPositioners.clear();
+    m_floatingPositionersByClassId.clear();
 }
 
 void StaffAlignment::SetStaff(Staff *staff, Doc *doc)
@@ -170,7 +171,7 @@ void StaffAlignment::SetVerseCount(int verse_count)
 int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 {
     if (box->Is(FLOATING_POSITIONER)) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return positioner->GetContentTop() - this->GetYRel();
     }
@@ -180,7 +181,7 @@ int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 int StaffAlignment::CalcOverflowBelow(BoundingBox *box)
 {
     if (box->Is(FLOATING_POSITIONER)) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return -(positioner->GetContentBottom() + m_staffHeight - this->GetYRel());
     }
@@ -197,6 +198,7 @@ void StaffAlignment::SetCurrentFloatingPositioner(FloatingObject *object, Object
     else {
         FloatingPositioner *box = new FloatingPositioner(object);
         m_floatingPositioners.push_back(box);
+        m_floatingPositionersByClassId[object->GetClassId()].push_back(box);
         item = m_floatingPositioners.end() - 1;
     }
     (*item)->SetObjectXY(objectX, objectY);
@@ -210,7 +212,7 @@ void StaffAlignment::SetCurrentFloatingPositioner(FloatingObject *object, Object
 
 int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionersParams *params = dynamic_cast<AdjustFloatingPostionersParams *>(functorParams);
+    AdjustFloatingPostionersParams *params = vrv_cast<AdjustFloatingPostionersParams *>(functorParams);
     assert(params);
 
     int staffSize = this->GetStaffSize();
@@ -226,14 +228,19 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             // For now just clear the overflowBelow, which avoids the overlap to be calculated. We could also keep them
             // and check if they are some lyrics in order to know if the overlap needs to be calculated or not.
             m_overflowBelowBBoxes.clear();
+            m_overflowBelowBBoxIndex.Clear();
         }
         return FUNCTOR_SIBLINGS;
     }
 
+    std::map<ClassId, ArrayOfFloatingPositioners>::iterator positioners
+        = m_floatingPositionersByClassId.find(params->m_classId);
+    if (positioners == m_floatingPositionersByClassId.end()) return FUNCTOR_SIBLINGS;
+
+    ArrayOfBoundingBoxes overlaps;
     ArrayOfFloatingPositioners::iterator iter;
-    for (iter = m_floatingPositioners.begin(); iter != m_floatingPositioners.end(); ++iter) {
+    for (iter = positioners->second.begin(); iter != positioners->second.end(); ++iter) {
         assert((*iter)->GetObject());
-        if (!(*iter)->GetObject()->Is(params->m_classId)) continue;
 
         // Skip if no content bounding box is available
         if (!(*iter)->HasContentBB()) continue;
@@ -245,7 +252,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             bool skipBelow = false;
 
             if ((*iter)->GetObject()->Is(SLUR)) {
-                Slur *slur = dynamic_cast<Slur *>((*iter)->GetObject());
+                Slur *slur = vrv_cast<Slur *>((*iter)->GetObject());
                 assert(slur);
                 slur->GetCrossStaffOverflows(this, (*iter)->m_cuvreDir, skipAbove, skipBelow);
             }
@@ -255,7 +262,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             if (overflowAbove > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%sparams->m_doctop overflow: %d", current->GetUuid().c_str(), overflowAbove);
                 this->SetOverflowAbove(overflowAbove);
-                this->m_overflowAboveBBoxes.push_back((*iter));
+                this->AddBBoxAbove(*iter);
             }
 
             int overflowBelow = 0;
@@ -263,7 +270,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             if (overflowBelow > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%s bottom overflow: %d", current->GetUuid().c_str(), overflowBelow);
                 this->SetOverflowBelow(overflowBelow);
-                this->m_overflowBelowBBoxes.push_back((*iter));
+                this->AddBBoxBelow(*iter);
             }
             continue;
         }
@@ -271,32 +278,28 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
         // This sets the default position (without considering any overflowing box)
         (*iter)->CalcDrawingYRel(params->m_doc, this, NULL);
 
-        ArrayOfBoundingBoxes *overflowBoxes = &m_overflowBelowBBoxes;
+        BoundingBoxIndex *overflowBoxes = &m_overflowBelowBBoxIndex;
         // above?
         if ((*iter)->GetDrawingPlace() == STAFFREL_above) {
-            overflowBoxes = &m_overflowAboveBBoxes;
+            overflowBoxes = &m_overflowAboveBBoxIndex;
         }
-        auto i = overflowBoxes->begin();
-        auto end = overflowBoxes->end();
-        while (i != end) {
-            // find all the overflowing elements from the staff that overlap horizonatally
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // update the yRel accordingly
-                (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
-                i++;
-            }
+        // find all the overflowing elements from the staff that overlap horizonatally
+        overflowBoxes->FindHorizontalContentOverlaps(*iter, overlaps);
+        ArrayOfBoundingBoxes::iterator i;
+        for (i = overlaps.begin(); i != overlaps.end(); ++i) {
+            // update the yRel accordingly
+            (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
         }
         //  Now update the staffAlignment max overflow (above or below) and add the positioner to the list of
         //  overflowing elements
         if ((*iter)->GetDrawingPlace() == STAFFREL_above) {
             int overflowAbove = this->CalcOverflowAbove((*iter));
-            overflowBoxes->push_back((*iter));
+            this->AddBBoxAbove(*iter);
             this->SetOverflowAbove(overflowAbove);
         }
         else {
             int overflowBelow = this->CalcOverflowBelow((*iter));
-            overflowBoxes->push_back((*iter));
+            this->AddBBoxBelow(*iter);
             this->SetOverflowBelow(overflowBelow);
         }
     }
@@ -306,7 +309,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustFloatingPostionerGrps(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionerGrpsParams *params = dynamic_cast<AdjustFloatingPostionerGrpsParams *>(functorParams);
+    AdjustFloatingPostionerGrpsParams *params = vrv_cast<AdjustFloatingPostionerGrpsParams *>(functorParams);
     assert(params);
 
     ArrayOfFloatingPositioners positioners;
@@ -360,7 +363,7 @@ int StaffAlignment::AdjustFloatingPostionerGrps(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
 {
-    AdjustStaffOverlapParams *params = dynamic_cast<AdjustStaffOverlapParams *>(functorParams);
+    AdjustStaffOverlapParams *params = vrv_cast<AdjustStaffOverlapParams *>(functorParams);
     assert(params);
 
     // This is the bottom alignment (or something is wrong)
@@ -371,25 +374,22 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
+    ArrayOfBoundingBoxes overlaps;
     ArrayOfBoundingBoxes::iterator iter;
     // go through all the elements of the top staff that have an overflow below
     for (iter = params->m_previous->m_overflowBelowBBoxes.begin();
          iter != params->m_previous->m_overflowBelowBBoxes.end(); iter++) {
-        auto i = m_overflowAboveBBoxes.begin();
-        auto end = m_overflowAboveBBoxes.end();
-        while (i != end) {
-            // find all the elements from the bottom staff that have an overflow at the top with an horizontal overap
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // calculate the vertical overlap and see if this is more than the expected space
-                int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
-                int overflowAbove = this->CalcOverflowAbove(*i);
-                int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
-                if (spacing < (overflowBelow + overflowAbove)) {
-                    // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
-                    this->SetOverlap((overflowBelow + overflowAbove) - spacing);
-                }
-                i++;
+        // find all the elements from the bottom staff that have an overflow at the top with an horizontal overap
+        m_overflowAboveBBoxIndex.FindHorizontalContentOverlaps(*iter, overlaps);
+        ArrayOfBoundingBoxes::iterator i;
+        for (i = overlaps.begin(); i != overlaps.end(); ++i) {
+            // calculate the vertical overlap and see if this is more than the expected space
+            int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
+            int overflowAbove = this->CalcOverflowAbove(*i);
+            int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
+            if (spacing < (overflowBelow + overflowAbove)) {
+                // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
+                this->SetOverlap((overflowBelow + overflowAbove) - spacing);
             }
         }
     }
@@ -401,7 +401,7 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
 
 int StaffAlignment::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     SetYRel(-params->m_cumulatedShift);
@@ -413,7 +413,7 @@ int StaffAlignment::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustYPos(FunctorParams *functorParams)
 {
-    AdjustYPosParams *params = dynamic_cast<AdjustYPosParams *>(functorParams);
+    AdjustYPosParams *params = vrv_cast<AdjustYPosParams *>(functorParams);
     assert(params);
 
     int maxOverlfowAbove;
@@ -37,7 +37,7 @@ void View::DrawBeam(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Beam *beam = dynamic_cast<Beam *>(element);
+    Beam *beam = vrv_cast<Beam *>(element);
     assert(beam);
 
     // duration variables
@@ -265,7 +265,7 @@ void View::DrawFTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    FTrem *fTrem = dynamic_cast<FTrem *>(element);
+    FTrem *fTrem = vrv_cast<FTrem *>(element);
     assert(fTrem);
 
     // temporary coordinates
@@ -73,52 +73,52 @@ void View::DrawControlElement(DeviceContext *dc, ControlElement *element, Measur
         system->AddToDrawingList(element);
     }
     else if (element->Is(BREATH)) {
-        Breath *breath = dynamic_cast<Breath *>(element);
+        Breath *breath = vrv_cast<Breath *>(element);
         assert(breath);
         DrawBreath(dc, breath, measure, system);
     }
     else if (element->Is(DIR)) {
-        Dir *dir = dynamic_cast<Dir *>(element);
+        Dir *dir = vrv_cast<Dir *>(element);
         assert(dir);
         DrawDir(dc, dir, measure, system);
     }
     else if (element->Is(DYNAM)) {
-        Dynam *dynam = dynamic_cast<Dynam *>(element);
+        Dynam *dynam = vrv_cast<Dynam *>(element);
         assert(dynam);
         DrawDynam(dc, dynam, measure, system);
     }
     else if (element->Is(FERMATA)) {
-        Fermata *fermata = dynamic_cast<Fermata *>(element);
+        Fermata *fermata = vrv_cast<Fermata *>(element);
         assert(fermata);
         DrawFermata(dc, fermata, measure, system);
     }
     else if (element->Is(HARM)) {
-        Harm *harm = dynamic_cast<Harm *>(element);
+        Harm *harm = vrv_cast<Harm *>(element);
         assert(harm);
         DrawHarm(dc, harm, measure, system);
     }
     else if (element->Is(MORDENT)) {
-        Mordent *mordent = dynamic_cast<Mordent *>(element);
+        Mordent *mordent = vrv_cast<Mordent *>(element);
         assert(mordent);
         DrawMordent(dc, mordent, measure, system);
     }
     else if (element->Is(PEDAL)) {
-        Pedal *pedal = dynamic_cast<Pedal *>(element);
+        Pedal *pedal = vrv_cast<Pedal *>(element);
         assert(pedal);
         DrawPedal(dc, pedal, measure, system);
     }
     else if (element->Is(TEMPO)) {
-        Tempo *tempo = dynamic_cast<Tempo *>(element);
+        Tempo *tempo = vrv_cast<Tempo *>(element);
         assert(tempo);
         DrawTempo(dc, tempo, measure, system);
     }
     else if (element->Is(TRILL)) {
-        Trill *trill = dynamic_cast<Trill *>(element);
+        Trill *trill = vrv_cast<Trill *>(element);
         assert(trill);
         DrawTrill(dc, trill, measure, system);
     }
     else if (element->Is(TURN)) {
-        Turn *turn = dynamic_cast<Turn *>(element);
+        Turn *turn = vrv_cast<Turn *>(element);
         assert(turn);
         DrawTurn(dc, turn, measure, system);
     }
@@ -131,7 +131,7 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     assert(system);
 
     if (dc->Is(BBOX_DEVICE_CONTEXT)) {
-        BBoxDeviceContext *bBoxDC = dynamic_cast<BBoxDeviceContext *>(dc);
+        BBoxDeviceContext *bBoxDC = vrv_cast<BBoxDeviceContext *>(dc);
         assert(bBoxDC);
         if (!bBoxDC->UpdateVerticalValues()) {
             if (element->Is({ SLUR, HAIRPIN, OCTAVE, TIE })) return;
@@ -144,8 +144,8 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     if (!interface->HasStartAndEnd()) return;
 
     // Get the parent system of the first and last note
-    System *parentSystem1 = dynamic_cast<System *>(interface->GetStart()->GetFirstParent(SYSTEM));
-    System *parentSystem2 = dynamic_cast<System *>(interface->GetEnd()->GetFirstParent(SYSTEM));
+    System *parentSystem1 = vrv_cast<System *>(interface->GetStart()->GetFirstParent(SYSTEM));
+    System *parentSystem2 = vrv_cast<System *>(interface->GetEnd()->GetFirstParent(SYSTEM));
 
     int x1, x2;
     Object *objectX = NULL;
@@ -212,11 +212,11 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
 
         if (element->Is(HAIRPIN)) {
             // cast to Harprin check in DrawHairpin
-            DrawHairpin(dc, dynamic_cast<Hairpin *>(element), x1, x2, *staffIter, spanningType, graphic);
+            DrawHairpin(dc, vrv_cast<Hairpin *>(element), x1, x2, *staffIter, spanningType, graphic);
         }
         else if (element->Is(OCTAVE)) {
             // cast to Slur check in DrawOctave
-            DrawOctave(dc, dynamic_cast<Octave *>(element), x1, x2, *staffIter, spanningType, graphic);
+            DrawOctave(dc, vrv_cast<Octave *>(element), x1, x2, *staffIter, spanningType, graphic);
         }
         else if (element->Is(SLUR)) {
             // For slurs we limit support to one value in @staff
@@ -226,7 +226,7 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
         }
         else if (element->Is(SYL)) {
             // cast to Syl check in DrawSylConnector
-            DrawSylConnector(dc, dynamic_cast<Syl *>(element), x1, x2, *staffIter, spanningType, graphic);
+            DrawSylConnector(dc, vrv_cast<Syl *>(element), x1, x2, *staffIter, spanningType, graphic);
         }
         else if (element->Is(TIE)) {
             // For ties we limit support to one value in @staff
@@ -282,15 +282,15 @@ void View::DrawHairpin(
 
     // For now, with timestamps, get the first layer. We should eventually look at the @layerident (not implemented)
     if (start->Is(TIMESTAMP_ATTR))
-        layer1 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
+        layer1 = vrv_cast<Layer *>(staff->FindChildByType(LAYER));
     else
-        layer1 = dynamic_cast<Layer *>(start->GetFirstParent(LAYER));
+        layer1 = vrv_cast<Layer *>(start->GetFirstParent(LAYER));
 
     // idem
     if (end->Is(TIMESTAMP_ATTR))
-        layer2 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
+        layer2 = vrv_cast<Layer *>(staff->FindChildByType(LAYER));
     else
-        layer2 = dynamic_cast<Layer *>(end->GetFirstParent(LAYER));
+        layer2 = vrv_cast<Layer *>(end->GetFirstParent(LAYER));
 
     assert(layer1 && layer2);
 
@@ -555,24 +555,24 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
     }
 
     if (start->Is(NOTE)) {
-        startNote = dynamic_cast<Note *>(start);
+        startNote = vrv_cast<Note *>(start);
         assert(startNote);
         startParentChord = startNote->IsChordTone();
         startStemDir = startNote->GetDrawingStemDir();
     }
     else if (start->Is(CHORD)) {
-        startChord = dynamic_cast<Chord *>(start);
+        startChord = vrv_cast<Chord *>(start);
         assert(startChord);
         startStemDir = startChord->GetDrawingStemDir();
     }
     if (end->Is(NOTE)) {
-        endNote = dynamic_cast<Note *>(end);
+        endNote = vrv_cast<Note *>(end);
         assert(endNote);
         endParentChord = endNote->IsChordTone();
         endStemDir = endNote->GetDrawingStemDir();
     }
     else if (end->Is(CHORD)) {
-        endChord = dynamic_cast<Chord *>(end);
+        endChord = vrv_cast<Chord *>(end);
         assert(endChord);
         endStemDir = endChord->GetDrawingStemDir();
     }
@@ -582,15 +582,15 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
 
     // For now, with timestamps, get the first layer. We should eventually look at the @layerident (not implemented)
     //if (start->Is(TIMESTAMP_ATTR))
-    //    layer1 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
+    //    layer1 = vrv_cast<Layer *>(staff->FindChildByType(LAYER));
     //else
-    layer1 = dynamic_cast<Layer *>(start->GetFirstParent(LAYER));
+    layer1 = vrv_cast<Layer *>(start->GetFirstParent(LAYER));
 
     // idem
     //if (end->Is(TIMESTAMP_ATTR))
-    //    layer2 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
+    //    layer2 = vrv_cast<Layer *>(staff->FindChildByType(LAYER));
     //else
-    layer2 = dynamic_cast<Layer *>(end->GetFirstParent(LAYER));
+    layer2 = vrv_cast<Layer *>(end->GetFirstParent(LAYER));
 
     assert(layer1 && layer2);
 
@@ -817,7 +817,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
         start->FindAllChildByAttComparison(&artics, &matchType);
         // Then the @n of each first staffDef
         for (articIter = artics.begin(); articIter != artics.end(); articIter++) {
-            Artic *artic = dynamic_cast<Artic *>(*articIter);
+            Artic *artic = vrv_cast<Artic *>(*articIter);
             assert(artic);
             ArticPart *outsidePart = artic->GetOutsidePart();
             if (outsidePart) {
@@ -835,7 +835,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
         end->FindAllChildByAttComparison(&artics, &matchType);
         // Then the @n of each first staffDef
         for (articIter = artics.begin(); articIter != artics.end(); articIter++) {
-            Artic *artic = dynamic_cast<Artic *>(*articIter);
+            Artic *artic = vrv_cast<Artic *>(*articIter);
             assert(artic);
             ArticPart *outsidePart = artic->GetOutsidePart();
             if (outsidePart) {
@@ -910,7 +910,7 @@ float View::AdjustSlur(Slur *slur, Staff *staff, int layerN, curvature_CURVEDIR
 
     /************** content **************/
 
-    System *system = dynamic_cast<System *>(staff->GetFirstParent(SYSTEM));
+    System *system = vrv_cast<System *>(staff->GetFirstParent(SYSTEM));
     assert(system);
     FindTimeSpanningLayerElementsParams findTimeSpanningLayerElementsParams;
     findTimeSpanningLayerElementsParams.m_minPos = p1->x;
@@ -1267,8 +1267,8 @@ void View::DrawTie(DeviceContext *dc, Tie *tie, int x1, int x2, Staff *staff, ch
 
     parentChord1 = note1->IsChordTone();
 
-    Layer *layer1 = dynamic_cast<Layer *>(note1->GetFirstParent(LAYER));
-    Layer *layer2 = dynamic_cast<Layer *>(note2->GetFirstParent(LAYER));
+    Layer *layer1 = vrv_cast<Layer *>(note1->GetFirstParent(LAYER));
+    Layer *layer2 = vrv_cast<Layer *>(note2->GetFirstParent(LAYER));
     assert(layer1 && layer2);
 
     if (layer1->GetN() != layer2->GetN()) {
@@ -2149,7 +2149,7 @@ void View::DrawSystemElement(DeviceContext *dc, SystemElement *element, System *
     assert(system);
 
     if (element->Is(BOUNDARY_END)) {
-        BoundaryEnd *boundaryEnd = dynamic_cast<BoundaryEnd *>(element);
+        BoundaryEnd *boundaryEnd = vrv_cast<BoundaryEnd *>(element);
         assert(boundaryEnd);
         assert(boundaryEnd->GetStart());
         dc->StartGraphic(element, boundaryEnd->GetStart()->GetUuid(), element->GetUuid());
@@ -2183,7 +2183,7 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
     assert(system);
 
     if (dc->Is(BBOX_DEVICE_CONTEXT)) {
-        BBoxDeviceContext *bBoxDC = dynamic_cast<BBoxDeviceContext *>(dc);
+        BBoxDeviceContext *bBoxDC = vrv_cast<BBoxDeviceContext *>(dc);
         assert(bBoxDC);
         if (!bBoxDC->UpdateVerticalValues()) {
             return;
@@ -2200,8 +2200,8 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
     if (!ending->GetMeasure() || !endingEndBoundary->GetMeasure()) return;
 
     // Get the parent system of the first and last note
-    System *parentSystem1 = dynamic_cast<System *>(ending->GetFirstParent(SYSTEM));
-    System *parentSystem2 = dynamic_cast<System *>(endingEndBoundary->GetFirstParent(SYSTEM));
+    System *parentSystem1 = vrv_cast<System *>(ending->GetFirstParent(SYSTEM));
+    System *parentSystem2 = vrv_cast<System *>(endingEndBoundary->GetFirstParent(SYSTEM));
 
     assert(parentSystem1 && parentSystem2);
     // in non debug mode
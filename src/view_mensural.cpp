@@ -44,7 +44,7 @@ void View::DrawMensuralNote(DeviceContext *dc, LayerElement *element, Layer *lay
     assert(staff);
     assert(measure);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     int noteY = element->GetDrawingY();
@@ -145,7 +145,7 @@ void View::DrawMensuralRest(DeviceContext *dc, LayerElement *element, Layer *lay
 
     wchar_t charCode;
 
-    Rest *rest = dynamic_cast<Rest *>(element);
+    Rest *rest = vrv_cast<Rest *>(element);
     assert(rest);
 
     bool drawingCueSize = rest->IsCueSize();
@@ -176,7 +176,7 @@ void View::DrawMensur(DeviceContext *dc, LayerElement *element, Layer *layer, St
     assert(staff);
     assert(measure);
 
-    Mensur *mensur = dynamic_cast<Mensur *>(element);
+    Mensur *mensur = vrv_cast<Mensur *>(element);
     assert(mensur);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -445,7 +445,7 @@ void View::DrawMaximaToBrevis(DeviceContext *dc, int y, LayerElement *element, L
     assert(layer);
     assert(staff);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     int xn, xLeft, xRight, yTop, yBottom, y3, y4;
@@ -520,7 +520,7 @@ void View::DrawLigature(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(layer);
     assert(staff);
 
-    Ligature *ligature = dynamic_cast<Ligature *>(element);
+    Ligature *ligature = vrv_cast<Ligature *>(element);
     assert(ligature);
 
     dc->StartGraphic(ligature, "", ligature->GetUuid());
@@ -539,7 +539,7 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
     assert(staff);
 
     LogDebug("DrawLigatureNote");
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     int xn, x1, x2, y, y1, y2, y3, y4;
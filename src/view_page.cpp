@@ -50,7 +50,16 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     assert(dc);
     assert(m_doc);
 
-    m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+    this->DrawPage(dc, m_doc->SetDrawingPage(m_pageIdx), background);
+}
+
+void View::DrawPage(DeviceContext *dc, Page *page, bool background)
+{
+    assert(dc);
+    assert(m_doc);
+    assert(page);
+
+    m_currentPage = page;
 
     int i;
 
@@ -104,7 +113,7 @@ void View::SetScoreDefDrawingWidth(DeviceContext *dc, ScoreDef *scoreDef)
     // longest key signature of the staffDefs
     ListOfObjects *scoreDefList = scoreDef->GetList(scoreDef); // make sure it's initialized
     for (ListOfObjects::iterator it = scoreDefList->begin(); it != scoreDefList->end(); it++) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(*it);
+        StaffDef *staffDef = vrv_cast<StaffDef *>(*it);
         assert(staffDef);
         if (!staffDef->HasKeySigInfo()) continue;
         KeySig *keySig = staffDef->GetKeySigCopy();
@@ -141,7 +150,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
     system->ResetDrawingList();
 
     // First get the first measure of the system
-    Measure *measure = dynamic_cast<Measure *>(system->FindChildByType(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(system->FindChildByType(MEASURE));
     if (measure) {
         // NULL for the BarLine parameters indicates that we are drawing the scoreDef
         DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, system->GetDrawingX(), NULL);
@@ -149,7 +158,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
         // This needs to be improved because we are now using (tuplet) oblique figures.
         // We should also have a better way to specify if the number has to be displayed or not
         if ((measure->GetN() != VRV_UNSET) && (measure->GetN() > 1)) {
-            Staff *staff = dynamic_cast<Staff *>(measure->FindChildByType(STAFF));
+            Staff *staff = vrv_cast<Staff *>(measure->FindChildByType(STAFF));
             if (staff) {
                 dc->SetFont(m_doc->GetDrawingSmuflFont(100, false));
                 dc->DrawMusicText(IntToTupletFigures(measure->GetN()), ToDeviceContextX(system->GetDrawingX()),
@@ -211,7 +220,7 @@ void View::DrawScoreDef(DeviceContext *dc, ScoreDef *scoreDef, Measure *measure,
     // we need at least one measure to be able to draw the groups - we need access to the staff elements,
     assert(measure);
 
-    StaffGrp *staffGrp = dynamic_cast<StaffGrp *>(scoreDef->FindChildByType(STAFFGRP));
+    StaffGrp *staffGrp = vrv_cast<StaffGrp *>(scoreDef->FindChildByType(STAFFGRP));
     if (!staffGrp) {
         return;
     }
@@ -302,7 +311,7 @@ void View::DrawStaffGrp(
             dc->GetTextExtent(label, &extend);
 
             // keep the widest width for the system
-            System *system = dynamic_cast<System *>(measure->GetFirstParent(SYSTEM));
+            System *system = vrv_cast<System *>(measure->GetFirstParent(SYSTEM));
             if (!system) {
                 LogDebug("Staff or System missing in View::DrawStaffDefLabels");
             }
@@ -373,7 +382,7 @@ void View::DrawStaffDefLabels(DeviceContext *dc, Measure *measure, ScoreDef *sco
 
         AttCommonNComparison comparison(STAFF, staffDef->GetN());
         Staff *staff = dynamic_cast<Staff *>(measure->FindChildByAttComparison(&comparison, 1));
-        System *system = dynamic_cast<System *>(measure->GetFirstParent(SYSTEM));
+        System *system = vrv_cast<System *>(measure->GetFirstParent(SYSTEM));
 
         if (!staff || !system) {
             LogDebug("Staff or System missing in View::DrawStaffDefLabels");
@@ -856,7 +865,7 @@ void View::DrawStaffDef(DeviceContext *dc, Staff *staff, Measure *measure)
     assert(measure);
 
     // StaffDef information is always in the first layer
-    Layer *layer = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
+    Layer *layer = vrv_cast<Layer *>(staff->FindChildByType(LAYER));
     if (!layer || !layer->HasStaffDef()) return;
 
     // StaffDef staffDef;
@@ -886,7 +895,7 @@ void View::DrawStaffDefCautionary(DeviceContext *dc, Staff *staff, Measure *meas
     assert(measure);
 
     // StaffDef cautionary information is always in the first layer
-    Layer *layer = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
+    Layer *layer = vrv_cast<Layer *>(staff->FindChildByType(LAYER));
     if (!layer || !layer->HasCautionStaffDef()) return;
 
     // StaffDef staffDef;
@@ -921,7 +930,7 @@ int View::CalculatePitchCode(Layer *layer, int y_n, int x_pos, int *octave)
     assert(layer);
     assert(octave);
 
-    Staff *parentStaff = dynamic_cast<Staff *>(layer->GetFirstParent(STAFF));
+    Staff *parentStaff = vrv_cast<Staff *>(layer->GetFirstParent(STAFF));
     assert(parentStaff); // Pointer to parent has to be a staff
 
     static int touches[]
@@ -995,7 +1004,7 @@ void View::DrawLayerList(DeviceContext *dc, Layer *layer, Staff *staff, Measure
 
     for (iter = drawingList->begin(); iter != drawingList->end(); ++iter) {
         if ((*iter)->Is(classId) && (classId == TUPLET)) {
-            Tuplet *tuplet = dynamic_cast<Tuplet *>((*iter));
+            Tuplet *tuplet = vrv_cast<Tuplet *>((*iter));
             assert(tuplet);
             dc->ResumeGraphic(tuplet, tuplet->GetUuid());
             DrawTupletPostponed(dc, tuplet, layer, staff);
@@ -1022,12 +1031,12 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
     for (current = parent->GetFirst(); current; current = parent->GetNext()) {
         if (current->Is(MEASURE)) {
             // cast to Measure check in DrawMeasure
-            DrawMeasure(dc, dynamic_cast<Measure *>(current), system);
+            DrawMeasure(dc, vrv_cast<Measure *>(current), system);
         }
         // scoreDef are not drawn directly, but anything else should not be possible
         else if (current->Is(SCOREDEF)) {
             // nothing to do, then
-            ScoreDef *scoreDef = dynamic_cast<ScoreDef *>(current);
+            ScoreDef *scoreDef = vrv_cast<ScoreDef *>(current);
             assert(scoreDef);
             SetScoreDefDrawingWidth(dc, scoreDef);
         }
@@ -1056,7 +1065,7 @@ void View::DrawMeasureChildren(DeviceContext *dc, Object *parent, Measure *measu
     for (current = parent->GetFirst(); current; current = parent->GetNext()) {
         if (current->Is(STAFF)) {
             // cast to Staff check in DrawStaff
-            DrawStaff(dc, dynamic_cast<Staff *>(current), measure, system);
+            DrawStaff(dc, vrv_cast<Staff *>(current), measure, system);
         }
         else if (current->IsControlElement()) {
             // cast to ControlElement check in DrawControlElement
@@ -1084,7 +1093,7 @@ void View::DrawStaffChildren(DeviceContext *dc, Object *parent, Staff *staff, Me
     for (current = parent->GetFirst(); current; current = parent->GetNext()) {
         if (current->Is(LAYER)) {
             // cast to Layer check in DrawLayer
-            DrawLayer(dc, dynamic_cast<Layer *>(current), staff, measure);
+            DrawLayer(dc, vrv_cast<Layer *>(current), staff, measure);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawStaffEditorialElement
@@ -1167,9 +1176,9 @@ void View::DrawSystemEditorialElement(DeviceContext *dc, EditorialElement *eleme
 {
     assert(element);
     if (element->Is(APP))
-        assert((dynamic_cast<App *>(element))->GetLevel() == EDITORIAL_TOPLEVEL);
+        assert((vrv_cast<App *>(element))->GetLevel() == EDITORIAL_TOPLEVEL);
     else if (element->Is(CHOICE))
-        assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_TOPLEVEL);
+        assert((vrv_cast<Choice *>(element))->GetLevel() == EDITORIAL_TOPLEVEL);
 
     std::string boundaryStart;
     if (element->IsBoundaryElement()) boundaryStart = "boundaryStart";
@@ -1186,9 +1195,9 @@ void View::DrawMeasureEditorialElement(DeviceContext *dc, EditorialElement *elem
 {
     assert(element);
     if (element->Is(APP))
-        assert((dynamic_cast<App *>(element))->GetLevel() == EDITORIAL_MEASURE);
+        assert((vrv_cast<App *>(element))->GetLevel() == EDITORIAL_MEASURE);
     else if (element->Is(CHOICE))
-        assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_MEASURE);
+        assert((vrv_cast<Choice *>(element))->GetLevel() == EDITORIAL_MEASURE);
 
     dc->StartGraphic(element, "", element->GetUuid());
     if (element->m_visibility == Visible) {
@@ -1201,9 +1210,9 @@ void View::DrawStaffEditorialElement(DeviceContext *dc, EditorialElement *elemen
 {
     assert(element);
     if (element->Is(APP))
-        assert((dynamic_cast<App *>(element))->GetLevel() == EDITORIAL_STAFF);
+        assert((vrv_cast<App *>(element))->GetLevel() == EDITORIAL_STAFF);
     else if (element->Is(CHOICE))
-        assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_STAFF);
+        assert((vrv_cast<Choice *>(element))->GetLevel() == EDITORIAL_STAFF);
 
     dc->StartGraphic(element, "", element->GetUuid());
     if (element->m_visibility == Visible) {
@@ -1217,9 +1226,9 @@ void View::DrawLayerEditorialElement(
 {
     assert(element);
     if (element->Is(APP))
-        assert((dynamic_cast<App *>(element))->GetLevel() == EDITORIAL_LAYER);
+        assert((vrv_cast<App *>(element))->GetLevel() == EDITORIAL_LAYER);
     else if (element->Is(CHOICE))
-        assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_LAYER);
+        assert((vrv_cast<Choice *>(element))->GetLevel() == EDITORIAL_LAYER);
 
     dc->StartGraphic(element, "", element->GetUuid());
     if (element->m_visibility == Visible) {
@@ -1232,9 +1241,9 @@ void View::DrawTextEditorialElement(DeviceContext *dc, EditorialElement *element
 {
     assert(element);
     if (element->Is(APP))
-        assert((dynamic_cast<App *>(element))->GetLevel() == EDITORIAL_TEXT);
+        assert((vrv_cast<App *>(element))->GetLevel() == EDITORIAL_TEXT);
     else if (element->Is(CHOICE))
-        assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_TEXT);
+        assert((vrv_cast<Choice *>(element))->GetLevel() == EDITORIAL_TEXT);
 
     dc->StartTextGraphic(element, "", element->GetUuid());
     if (element->m_visibility == Visible) {
@@ -1247,9 +1256,9 @@ void View::DrawFbEditorialElement(DeviceContext *dc, EditorialElement *element,
 {
     assert(element);
     if (element->Is(APP))
-        assert((dynamic_cast<App *>(element))->GetLevel() == EDITORIAL_FB);
+        assert((vrv_cast<App *>(element))->GetLevel() == EDITORIAL_FB);
     else if (element->Is(CHOICE))
-        assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_FB);
+        assert((vrv_cast<Choice *>(element))->GetLevel() == EDITORIAL_FB);
 
     dc->StartTextGraphic(element, "", element->GetUuid());
     if (element->m_visibility == Visible) {
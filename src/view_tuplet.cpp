@@ -40,7 +40,7 @@ bool View::OneBeamInTuplet(Tuplet *tuplet)
     // Are we contained in a beam?
     if (tuplet->GetFirstParent(BEAM, 1) && (tuplet->GetNoteCount() != 0)) {
         // is only the tuplet beamed and no other tuplet contained?
-        currentBeam = dynamic_cast<Beam *>(tuplet->GetFirstParent(BEAM, MAX_BEAM_DEPTH));
+        currentBeam = vrv_cast<Beam *>(tuplet->GetFirstParent(BEAM, MAX_BEAM_DEPTH));
         if ((currentBeam->GetChildCount() == 1) && (tuplet->GetChildCount(TUPLET) == 0)) return true;
     }
 
@@ -136,7 +136,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
     ListOfObjects::iterator iter = tupletChildren->begin();
     while (iter != tupletChildren->end()) {
         if ((*iter)->Is(NOTE)) {
-            Note *currentNote = dynamic_cast<Note *>(*iter);
+            Note *currentNote = vrv_cast<Note *>(*iter);
             assert(currentNote);
             if (currentNote->GetDrawingStemDir() == STEMDIRECTION_up)
                 ups++;
@@ -151,7 +151,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
     // if ups or downs are 0, it means all the stems go in the same direction
     if (ups == 0 || downs == 0) {
 
-        Note *firstNote = dynamic_cast<Note *>(tuplet->FindChildByType(NOTE));
+        Note *firstNote = vrv_cast<Note *>(tuplet->FindChildByType(NOTE));
         Note *lastNote = dynamic_cast<Note *>(tuplet->FindChildByType(NOTE, UNLIMITED_DEPTH, BACKWARD));
 
         // Calculate the average between the first and last stem
@@ -191,7 +191,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
         iter = tupletChildren->begin();
         while (iter != tupletChildren->end()) {
             if ((*iter)->Is(NOTE)) {
-                Note *currentNote = dynamic_cast<Note *>(*iter);
+                Note *currentNote = vrv_cast<Note *>(*iter);
                 assert(currentNote);
 
                 if (direction == STEMDIRECTION_up) {
@@ -228,7 +228,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
         iter = tupletChildren->begin();
         while (iter != tupletChildren->end()) {
             if ((*iter)->Is(NOTE)) {
-                Note *currentNote = dynamic_cast<Note *>(*iter);
+                Note *currentNote = vrv_cast<Note *>(*iter);
                 assert(currentNote);
 
                 if (currentNote->GetDrawingStemDir() == direction) {
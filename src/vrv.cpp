@@ -10,12 +10,18 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/stat.h>
 #include <vector>
 
 #ifndef _WIN32
@@ -50,63 +56,224 @@
 
 #define STRING_FORMAT_MAX_LEN 2048
 
+// The largest string read from a binary stream that cannot tell how many bytes are left
+#define BINARY_STRING_MAX_LEN (16 * 1024 * 1024)
+
+#define FONT_CACHE_MAGIC "VRVF"
+#define FONT_CACHE_VERSION 2
+// For detecting caches written on a platform with another byte order
+#define FONT_CACHE_BYTE_ORDER 0x01020304
+
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// Resources::LoadedFont
+//----------------------------------------------------------------------------
+
+class Resources::LoadedFont {
+public:
+    /** The glyphs of the font over the Bravura ones */
+    std::map<wchar_t, Glyph> m_glyphs;
+    /** The text font of the same resource path */
+    std::map<wchar_t, Glyph> *m_textGlyphs;
+    /** The glyph definitions for the SVG <defs>, never changed once added */
+    std::map<wchar_t, std::string> m_glyphDefs;
+};
+
 //----------------------------------------------------------------------------
 // Static members with some default values
 //----------------------------------------------------------------------------
 
 std::string Resources::m_path = "/usr/local/share/verovio";
-std::map<wchar_t, Glyph> Resources::m_font;
-std::map<wchar_t, Glyph> Resources::m_textFont;
+std::map<std::string, Resources::LoadedFont> Resources::m_fonts;
+std::map<std::string, std::map<wchar_t, Glyph> > Resources::m_textFonts;
+// Protects the resource path and the loading of the fonts
+static std::mutex s_resourcesMutex;
+// The glyph definitions can be requested concurrently when drawing pages in parallel
+static std::mutex s_glyphDefsMutex;
+// The font initialized with InitFonts and the one selected for the current thread (if any)
+static std::atomic<Resources::LoadedFont *> s_defaultFont(NULL);
+static thread_local Resources::LoadedFont *s_currentFont = NULL;
 
 //----------------------------------------------------------------------------
 // Font related methods
 //----------------------------------------------------------------------------
 
+std::string Resources::GetPath()
+{
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+    return m_path;
+}
+
+void Resources::SetPath(std::string path)
+{
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+    m_path = path;
+}
+
 bool Resources::InitFonts()
 {
-    // We will need to rethink this for adding the option to add custom fonts
-    // Font Bravura first since it is expected to have always all symbols
-    if (!LoadFont("Bravura")) LogError("Bravura font could not be loaded.");
-    // The Leipzig as the default font
-    if (!LoadFont("Leipzig")) LogError("Leipzig font could not be loaded.");
+    LoadedFont *font = LoadDefaultFont(GetPath());
+    if (!font) return false;
 
-    if (m_font.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, m_font.size());
-        return false;
+    s_defaultFont = font;
+    s_currentFont = font;
+    return true;
+}
+
+Resources::LoadedFont *Resources::LoadDefaultFont(const std::string &path)
+{
+    LoadedFont *font = NULL;
+    {
+        std::lock_guard<std::mutex> lock(s_resourcesMutex);
+        // We will need to rethink this for adding the option to add custom fonts
+        // The Leipzig as the default font (loaded over Bravura, see LoadFont)
+        font = LoadFont(path, "Leipzig");
+    }
+    if (!font) {
+        LogError("Leipzig font could not be loaded.");
+        return NULL;
+    }
+
+    if (font->m_glyphs.size() < SMUFL_COUNT) {
+        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, font->m_glyphs.size());
+        return NULL;
     }
 
-    if (!InitTextFont()) {
+    if (!font->m_textGlyphs) {
         LogError("Text font could not be initialized.");
-        return false;
+        return NULL;
     }
 
-    return true;
+    return font;
+}
+
+Resources::LoadedFont *Resources::GetFont(const std::string &path, const std::string &fontName)
+{
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+    return LoadFont(path, fontName);
 }
 
 bool Resources::SetFont(std::string fontName)
 {
-    return LoadFont(fontName);
+    LoadedFont *font = GetFont(GetPath(), fontName);
+    if (!font) return false;
+    s_currentFont = font;
+    return true;
+}
+
+Resources::LoadedFont *Resources::GetCurrentFont()
+{
+    return (s_currentFont) ? s_currentFont : s_defaultFont.load();
+}
+
+void Resources::SetCurrentFont(LoadedFont *font)
+{
+    s_currentFont = font;
 }
 
 Glyph *Resources::GetGlyph(wchar_t smuflCode)
 {
-    if (!m_font.count(smuflCode)) return NULL;
-    return &m_font[smuflCode];
+    LoadedFont *font = GetCurrentFont();
+    if (!font) return NULL;
+    std::map<wchar_t, Glyph>::iterator iter = font->m_glyphs.find(smuflCode);
+    if (iter == font->m_glyphs.end()) return NULL;
+    return &iter->second;
 }
 
 Glyph *Resources::GetTextGlyph(wchar_t code)
 {
-    if (!m_textFont.count(code)) return NULL;
-    return &m_textFont[code];
+    LoadedFont *font = GetCurrentFont();
+    if (!font || !font->m_textGlyphs) return NULL;
+    std::map<wchar_t, Glyph>::iterator iter = font->m_textGlyphs->find(code);
+    if (iter == font->m_textGlyphs->end()) return NULL;
+    return &iter->second;
+}
+
+const std::string &Resources::GetGlyphDef(wchar_t smuflCode)
+{
+    static const std::string emptyDef;
+
+    LoadedFont *font = GetCurrentFont();
+    if (!font) return emptyDef;
+
+    std::lock_guard<std::mutex> lock(s_glyphDefsMutex);
+
+    std::map<wchar_t, std::string>::iterator iter = font->m_glyphDefs.find(smuflCode);
+    if (iter != font->m_glyphDefs.end()) return iter->second;
+
+    Glyph *glyph = GetGlyph(smuflCode);
+    if (!glyph) return emptyDef;
+
+    pugi::xml_document sourceDoc;
+    // use the XML content when loaded from the font cache
+    if (!glyph->GetXML().empty()) {
+        sourceDoc.load_buffer(glyph->GetXML().c_str(), glyph->GetXML().size());
+    }
+    // otherwise load the XML file that contains it
+    else {
+        std::ifstream source(glyph->GetPath().c_str());
+        sourceDoc.load(source);
+    }
+
+    // Store it unformatted since it is parsed again into each SVG
+    std::ostringstream glyphDef;
+    sourceDoc.save(glyphDef, "", pugi::format_raw | pugi::format_no_declaration);
+    // The string is returned by reference - map elements are not moved by later insertions
+    return font->m_glyphDefs.emplace(smuflCode, glyphDef.str()).first->second;
+}
+
+Resources::LoadedFont *Resources::LoadFont(const std::string &path, const std::string &fontName)
+{
+    std::string key = path + "/" + fontName;
+    std::map<std::string, LoadedFont>::iterator iter = m_fonts.find(key);
+    if (iter != m_fonts.end()) return &iter->second;
+
+    std::map<wchar_t, Glyph> glyphs;
+    // Font Bravura first since it is expected to have always all symbols
+    if (fontName != "Bravura") {
+        LoadedFont *bravura = LoadFont(path, "Bravura");
+        if (bravura) {
+            glyphs = bravura->m_glyphs;
+        }
+        else {
+            LogError("Bravura font could not be loaded.");
+        }
+    }
+
+    std::map<wchar_t, Glyph> fontGlyphs;
+    if (!LoadFontCache(path, fontName, fontGlyphs)) {
+        if (!LoadFontXML(path, fontName, fontGlyphs)) return NULL;
+    }
+    std::map<wchar_t, Glyph>::iterator glyphIter;
+    for (glyphIter = fontGlyphs.begin(); glyphIter != fontGlyphs.end(); glyphIter++) {
+        glyphs[glyphIter->first] = glyphIter->second;
+    }
+
+    // The text font is shared by all the fonts of the resource path
+    std::map<wchar_t, Glyph> *textGlyphs = NULL;
+    std::map<std::string, std::map<wchar_t, Glyph> >::iterator textIter = m_textFonts.find(path);
+    if (textIter != m_textFonts.end()) {
+        textGlyphs = &textIter->second;
+    }
+    else {
+        std::map<wchar_t, Glyph> textFont;
+        if (LoadTextFont(path, textFont)) {
+            textGlyphs = &(m_textFonts[path] = textFont);
+        }
+    }
+
+    LoadedFont &font = m_fonts[key];
+    font.m_glyphs.swap(glyphs);
+    font.m_textGlyphs = textGlyphs;
+    return &font;
 }
 
-bool Resources::LoadFont(std::string fontName)
+bool Resources::LoadFontXML(const std::string &path, std::string fontName, std::map<wchar_t, Glyph> &glyphs)
 {
     ::DIR *dir;
     dirent *pdir;
-    std::string dirname = Resources::GetPath() + "/" + fontName;
+    std::string dirname = path + "/" + fontName;
     dir = opendir(dirname.c_str());
 
     if (!dir) {
@@ -116,7 +283,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // First loop through the fontName directory and load each glyph
     // Since the filename starts with the Unicode code, it is used
-    // to assign the glyph to the corresponding position in m_fonts
+    // to assign the glyph to the corresponding position in the map
     while ((pdir = readdir(dir))) {
         if (strstr(pdir->d_name, ".xml")) {
             // E.g, : E053-gClef8va.xml => strtol extracts E053 as hex
@@ -127,8 +294,8 @@ bool Resources::LoadFont(std::string fontName)
             }
             std::string codeStr = pdir->d_name;
             codeStr = codeStr.substr(0, 4);
-            Glyph glyph(Resources::GetPath() + "/" + fontName + "/" + pdir->d_name, codeStr);
-            m_font[smuflCode] = glyph;
+            Glyph glyph(path + "/" + fontName + "/" + pdir->d_name, codeStr);
+            glyphs[smuflCode] = glyph;
         }
     }
 
@@ -136,7 +303,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // Then load the bounding boxes (if bounding box file is provided)
     pugi::xml_document doc;
-    std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    std::string filename = path + "/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -154,11 +321,11 @@ bool Resources::LoadFont(std::string fontName)
         Glyph *glyph = NULL;
         if (current.attribute("c")) {
             wchar_t smuflCode = (wchar_t)strtol(current.attribute("c").value(), NULL, 16);
-            if (!m_font.count(smuflCode)) {
+            if (!glyphs.count(smuflCode)) {
                 LogWarning("Glyph with code '%d' not found.", smuflCode);
                 continue;
             }
-            glyph = &m_font[smuflCode];
+            glyph = &glyphs[smuflCode];
             if (glyph->GetUnitsPerEm() != unitsPerEm * 10) {
                 LogWarning("Glyph and bounding box units-per-em for code '%d' miss-match (bounding box: %d)", smuflCode,
                     unitsPerEm);
@@ -190,13 +357,136 @@ bool Resources::LoadFont(std::string fontName)
     return true;
 }
 
-bool Resources::InitTextFont()
+std::string Resources::GetFontCacheFilename(const std::string &path, std::string fontName)
+{
+    return path + "/" + fontName + ".cache";
+}
+
+std::string Resources::GetFontSignature(const std::string &path, std::string fontName)
+{
+    // The name, size and modification time of the glyph files and of the bounding box file
+    std::vector<std::string> entries;
+    struct stat fileStat;
+    std::string dirname = path + "/" + fontName;
+    ::DIR *dir = opendir(dirname.c_str());
+    if (dir) {
+        dirent *pdir;
+        while ((pdir = readdir(dir))) {
+            if (!strstr(pdir->d_name, ".xml")) continue;
+            std::string filename = dirname + "/" + pdir->d_name;
+            if (stat(filename.c_str(), &fileStat) != 0) continue;
+            entries.push_back(StringFormat("%s:%lld:%lld", pdir->d_name, (long long)fileStat.st_size,
+                (long long)fileStat.st_mtime));
+        }
+        closedir(dir);
+    }
+    std::sort(entries.begin(), entries.end());
+    std::string fontFilename = path + "/" + fontName + ".xml";
+    if (stat(fontFilename.c_str(), &fileStat) == 0) {
+        entries.push_back(StringFormat("%s.xml:%lld:%lld", fontName.c_str(), (long long)fileStat.st_size,
+            (long long)fileStat.st_mtime));
+    }
+
+    // FNV-1a hash of the entries, together with their number
+    uint64_t hash = 14695981039346656037ULL;
+    std::vector<std::string>::iterator iter;
+    for (iter = entries.begin(); iter != entries.end(); ++iter) {
+        std::string::iterator charIter;
+        for (charIter = iter->begin(); charIter != iter->end(); ++charIter) {
+            hash = (hash ^ (unsigned char)(*charIter)) * 1099511628211ULL;
+        }
+        hash = (hash ^ '\n') * 1099511628211ULL;
+    }
+    return StringFormat("%d-%016llx", (int)entries.size(), (unsigned long long)hash);
+}
+
+bool Resources::LoadFontCache(const std::string &path, std::string fontName, std::map<wchar_t, Glyph> &glyphs)
+{
+    std::string filename = GetFontCacheFilename(path, fontName);
+    std::ifstream input(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!input.is_open()) return false;
+
+    std::string magic(4, ' ');
+    int version = 0, byteOrder = 0, count = 0;
+    std::string verovioVersion, signature;
+    input.read(&magic[0], 4);
+    if (!input || (magic != FONT_CACHE_MAGIC) || !BinaryReadInt(input, version) || (version != FONT_CACHE_VERSION)
+        || !BinaryReadInt(input, byteOrder) || (byteOrder != FONT_CACHE_BYTE_ORDER)
+        || !BinaryReadString(input, verovioVersion) || !BinaryReadString(input, signature)
+        || !BinaryReadInt(input, count)) {
+        LogWarning("Font cache '%s' is not valid and is ignored", filename.c_str());
+        return false;
+    }
+
+    // Ignore the cache if it was written by another version or if the glyph files or the bounding box file changed
+    if ((verovioVersion != GetVersion()) || (signature != GetFontSignature(path, fontName))) {
+        LogWarning("Font cache '%s' is out of date and is ignored", filename.c_str());
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        int smuflCode = 0;
+        Glyph glyph;
+        if (!BinaryReadInt(input, smuflCode) || !glyph.ReadCache(input)) {
+            LogWarning("Font cache '%s' is truncated and is ignored", filename.c_str());
+            glyphs.clear();
+            return false;
+        }
+        glyphs[(wchar_t)smuflCode] = glyph;
+    }
+
+    return true;
+}
+
+bool Resources::WriteFontCache(std::string fontName)
+{
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+
+    std::map<wchar_t, Glyph> glyphs;
+    if (!LoadFontXML(m_path, fontName, glyphs)) return false;
+
+    std::string filename = GetFontCacheFilename(m_path, fontName);
+    std::ofstream output(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!output.is_open()) {
+        LogError("Font cache '%s' cannot be written", filename.c_str());
+        return false;
+    }
+
+    output.write(FONT_CACHE_MAGIC, 4);
+    BinaryWriteInt(output, FONT_CACHE_VERSION);
+    BinaryWriteInt(output, FONT_CACHE_BYTE_ORDER);
+    BinaryWriteString(output, GetVersion());
+    BinaryWriteString(output, GetFontSignature(m_path, fontName));
+    BinaryWriteInt(output, (int)glyphs.size());
+
+    std::map<wchar_t, Glyph>::iterator iter;
+    for (iter = glyphs.begin(); iter != glyphs.end(); iter++) {
+        // Keep the content of the glyph file for the SVG <defs>
+        std::ifstream source(iter->second.GetPath().c_str(), std::ios::in | std::ios::binary);
+        std::stringstream xml;
+        xml << source.rdbuf();
+        iter->second.SetXML(xml.str());
+
+        BinaryWriteInt(output, iter->first);
+        iter->second.WriteCache(output);
+    }
+
+    output.close();
+    if (output.fail()) {
+        LogError("Font cache '%s' could not be written", filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool Resources::LoadTextFont(const std::string &path, std::map<wchar_t, Glyph> &glyphs)
 {
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = Resources::GetPath() + "/text/Times.xml";
+    std::string filename = path + "/text/Times.xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -224,7 +514,7 @@ bool Resources::InitTextFont()
             if (current.attribute("h")) height = atof(current.attribute("h").value());
             glyph.SetBoundingBox(x, y, width, height);
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(atof(current.attribute("h-a-x").value()));
-            m_textFont[code] = glyph;
+            glyphs[code] = glyph;
         }
     }
     return true;
@@ -235,12 +525,29 @@ bool Resources::InitTextFont()
 //----------------------------------------------------------------------------
 
 /** Global for LogElapsedTimeXXX functions (debugging purposes) */
-struct timeval start;
-/** For disabling log */
-bool noLog = false;
+thread_local struct timeval start;
+/** For disabling log (in all the threads) */
+std::atomic<bool> noLog(false);
 
 #ifdef EMSCRIPTEN
-std::vector<std::string> logBuffer;
+thread_local std::vector<std::string> logBuffer;
+#endif
+
+/** The log messages collected in the current thread instead of being written (see CollectLog) */
+thread_local std::vector<std::string> *logCollection = NULL;
+
+#ifndef EMSCRIPTEN
+/** Write a log message to stderr, or add it to the messages collected in the current thread */
+static void WriteLog(const char *prefix, const char *fmt, va_list args)
+{
+    if (logCollection) {
+        logCollection->push_back(prefix + StringFormatVariable(fmt, args) + "\n");
+        return;
+    }
+    fprintf(stderr, "%s", prefix);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+}
 #endif
 
 void LogElapsedTimeStart()
@@ -272,9 +579,7 @@ void LogDebug(const char *fmt, ...)
 #else
     va_list args;
     va_start(args, fmt);
-    fprintf(stderr, "[Debug] ");
-    vfprintf(stderr, fmt, args);
-    fprintf(stderr, "\n");
+    WriteLog("[Debug] ", fmt, args);
     va_end(args);
 #endif
 #endif
@@ -293,9 +598,7 @@ void LogError(const char *fmt, ...)
 #else
     va_list args;
     va_start(args, fmt);
-    fprintf(stderr, "[Error] ");
-    vfprintf(stderr, fmt, args);
-    fprintf(stderr, "\n");
+    WriteLog("[Error] ", fmt, args);
     va_end(args);
 #endif
 }
@@ -313,9 +616,7 @@ void LogMessage(const char *fmt, ...)
 #else
     va_list args;
     va_start(args, fmt);
-    fprintf(stderr, "[Message] ");
-    vfprintf(stderr, fmt, args);
-    fprintf(stderr, "\n");
+    WriteLog("[Message] ", fmt, args);
     va_end(args);
 #endif
 }
@@ -333,9 +634,7 @@ void LogWarning(const char *fmt, ...)
 #else
     va_list args;
     va_start(args, fmt);
-    fprintf(stderr, "[Warning] ");
-    vfprintf(stderr, fmt, args);
-    fprintf(stderr, "\n");
+    WriteLog("[Warning] ", fmt, args);
     va_end(args);
 #endif
 }
@@ -345,6 +644,25 @@ void DisableLog()
     noLog = true;
 }
 
+void CollectLog(std::vector<std::string> *messages)
+{
+    logCollection = messages;
+}
+
+void LogCollected(const std::vector<std::string> &messages)
+{
+    if (noLog) return;
+    std::vector<std::string>::const_iterator iter;
+    for (iter = messages.begin(); iter != messages.end(); ++iter) {
+        if (logCollection) {
+            logCollection->push_back(*iter);
+        }
+        else {
+            fprintf(stderr, "%s", iter->c_str());
+        }
+    }
+}
+
 #ifdef EMSCRIPTEN
 bool LogBufferContains(std::string s)
 {
@@ -451,6 +769,130 @@ std::string GetVersion()
     return StringFormat("%d.%d.%d%s-%s", VERSION_MAJOR, VERSION_MINOR, VERSION_REVISION, dev.c_str(), GIT_COMMIT);
 }
 
+void BinaryWriteInt(std::ostream &output, int value)
+{
+    int32_t buffer = (int32_t)value;
+    output.write(reinterpret_cast<const char *>(&buffer), sizeof(int32_t));
+}
+
+bool BinaryReadInt(std::istream &input, int &value)
+{
+    int32_t buffer = 0;
+    input.read(reinterpret_cast<char *>(&buffer), sizeof(int32_t));
+    if (!input) return false;
+    value = (int)buffer;
+    return true;
+}
+
+void BinaryWriteString(std::ostream &output, const std::string &value)
+{
+    BinaryWriteInt(output, (int)value.size());
+    output.write(value.data(), value.size());
+}
+
+bool BinaryReadString(std::istream &input, std::string &value)
+{
+    int size = 0;
+    if (!BinaryReadInt(input, size) || (size < 0)) return false;
+
+    // Check the size against the bytes left before allocating it, since the stream might be corrupted
+    std::streampos position = input.tellg();
+    if (position != std::streampos(-1)) {
+        input.seekg(0, std::ios::end);
+        std::streampos end = input.tellg();
+        input.seekg(position);
+        if (!input || (end - position < size)) return false;
+    }
+    else {
+        // The stream cannot tell where it is (e.g., a pipe)
+        input.clear();
+        if (size > BINARY_STRING_MAX_LEN) return false;
+    }
+    value.resize(size);
+    if (size > 0) input.read(&value[0], size);
+    return (bool)input;
+}
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool(int threads) : m_next(0)
+{
+    m_job = NULL;
+    m_count = 0;
+    m_run = 0;
+    m_busyWorkers = 0;
+    m_stop = false;
+
+    int i;
+    for (i = 1; i < threads; ++i) {
+        m_workers.push_back(std::thread(&ThreadPool::Work, this));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_runStarted.notify_all();
+    int i;
+    for (i = 0; i < (int)m_workers.size(); ++i) {
+        m_workers.at(i).join();
+    }
+}
+
+void ThreadPool::Run(int count, const std::function<void(int)> &job)
+{
+    if (m_workers.empty() || (count < 2)) {
+        int i;
+        for (i = 0; i < count; ++i) job(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_count = count;
+        m_next = 0;
+        m_busyWorkers = (int)m_workers.size();
+        ++m_run;
+    }
+    m_runStarted.notify_all();
+
+    // The calling thread takes jobs too
+    this->RunJobs();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_runEnded.wait(lock, [this]() { return (m_busyWorkers == 0); });
+    m_job = NULL;
+}
+
+void ThreadPool::Work()
+{
+    unsigned long run = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_runStarted.wait(lock, [this, run]() { return (m_stop || (m_run != run)); });
+        if (m_stop) return;
+        run = m_run;
+        lock.unlock();
+        this->RunJobs();
+        lock.lock();
+        if (--m_busyWorkers == 0) m_runEnded.notify_all();
+    }
+}
+
+void ThreadPool::RunJobs()
+{
+    int i;
+    while ((i = m_next++) < m_count) {
+        (*m_job)(i);
+    }
+}
+
 //----------------------------------------------------------------------------
 // Base64 code borrowed
 //----------------------------------------------------------------------------
@@ -0,0 +1,33 @@
+# Run verovio on an input and check the content of the output file
+#
+# Called by ctest (see CMakeLists.txt) with:
+#  -DVEROVIO=<verovio executable> -DRESOURCES=<data directory> -DINPUT=<input file>
+#  -DOUTPUT=<output file name, e.g. out.svg> -DWORK_DIR=<directory for the output file>
+#  -DOPTIONS="<options of the run>" -DMATCH=<regular expression the output has to contain>
+#  and optionally -DNO_MATCH=<regular expression the output must not contain>
+
+separate_arguments(OPTIONS UNIX_COMMAND "${OPTIONS}")
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+execute_process(
+    COMMAND ${VEROVIO} -r ${RESOURCES} ${OPTIONS} -o ${WORK_DIR}/${OUTPUT} ${INPUT}
+    RESULT_VARIABLE RESULT
+    OUTPUT_QUIET
+    ERROR_QUIET
+)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "verovio failed with the options ${OPTIONS}")
+endif()
+if(NOT EXISTS ${WORK_DIR}/${OUTPUT})
+    message(FATAL_ERROR "No output file written")
+endif()
+
+file(READ ${WORK_DIR}/${OUTPUT} CONTENT)
+if(NOT CONTENT MATCHES "${MATCH}")
+    message(FATAL_ERROR "${OUTPUT} does not contain '${MATCH}' with the options '${OPTIONS}'")
+endif()
+if(NO_MATCH AND CONTENT MATCHES "${NO_MATCH}")
+    message(FATAL_ERROR "${OUTPUT} contains '${NO_MATCH}' with the options '${OPTIONS}'")
+endif()
@@ -0,0 +1,61 @@
+# Run verovio twice on the same input with different options and check that the output files are identical
+#
+# Called by ctest (see CMakeLists.txt) with:
+#  -DVEROVIO=<verovio executable> -DRESOURCES=<data directory> -DINPUT=<input file>
+#  -DOUTPUT=<output file name, e.g. out.svg> -DWORK_DIR=<directory for the output files>
+#  -DOPTIONS_A="<options of the first run>" -DOPTIONS_B="<options of the second run>"
+#  and optionally -DIGNORE_REGEX=<regular expression of the content to ignore, e.g. the date in the MEI header>
+
+separate_arguments(OPTIONS_A UNIX_COMMAND "${OPTIONS_A}")
+separate_arguments(OPTIONS_B UNIX_COMMAND "${OPTIONS_B}")
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR}/a ${WORK_DIR}/b)
+
+foreach(RUN a b)
+    if(RUN STREQUAL "a")
+        set(OPTIONS ${OPTIONS_A})
+    else()
+        set(OPTIONS ${OPTIONS_B})
+    endif()
+    execute_process(
+        COMMAND ${VEROVIO} -r ${RESOURCES} ${OPTIONS} -o ${WORK_DIR}/${RUN}/${OUTPUT} ${INPUT}
+        RESULT_VARIABLE RESULT
+        OUTPUT_QUIET
+        ERROR_QUIET
+    )
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "verovio failed with the options ${OPTIONS}")
+    endif()
+endforeach()
+
+file(GLOB FILES_A RELATIVE ${WORK_DIR}/a ${WORK_DIR}/a/*)
+file(GLOB FILES_B RELATIVE ${WORK_DIR}/b ${WORK_DIR}/b/*)
+if(NOT FILES_A)
+    message(FATAL_ERROR "No output file written")
+endif()
+if(NOT FILES_A STREQUAL FILES_B)
+    message(FATAL_ERROR "Different output files: ${FILES_A} and ${FILES_B}")
+endif()
+
+foreach(FILE ${FILES_A})
+    if(IGNORE_REGEX)
+        file(READ ${WORK_DIR}/a/${FILE} CONTENT_A)
+        file(READ ${WORK_DIR}/b/${FILE} CONTENT_B)
+        string(REGEX REPLACE "${IGNORE_REGEX}" "" CONTENT_A "${CONTENT_A}")
+        string(REGEX REPLACE "${IGNORE_REGEX}" "" CONTENT_B "${CONTENT_B}")
+        if(CONTENT_A STREQUAL CONTENT_B)
+            set(RESULT 0)
+        else()
+            set(RESULT 1)
+        endif()
+    else()
+        execute_process(
+            COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK_DIR}/a/${FILE} ${WORK_DIR}/b/${FILE}
+            RESULT_VARIABLE RESULT
+        )
+    endif()
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "${FILE} differs between the options '${OPTIONS_A}' and '${OPTIONS_B}'")
+    endif()
+endforeach()
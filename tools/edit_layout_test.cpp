@@ -0,0 +1,156 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        edit_layout_test.cpp
+// Author:      agent
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+#include "vrv.h"
+
+using namespace vrv;
+
+// Check that the page and system breaks after an edit (only the pages from the edited one being cast off again) are
+// the same as the ones of the edited document loaded again (the entire document being cast off).
+// The rendering is not compared since the editor methods do not prepare the drawing of the edited elements again.
+//
+// Usage: edit_layout_test <resource path> <MEI file>
+// The MEI file is the one of the ctest (../doc/tests/mei/02_layout/score_changes.mei) and the edits use its ids.
+
+static std::string s_resourcePath;
+
+struct Edit {
+    std::string m_name;
+    std::string m_action;
+    std::string m_elementId;
+    std::string m_attrType;
+    std::string m_attrValue;
+    // Options changed with the edit
+    std::string m_font;
+    bool m_evenSpacing;
+};
+
+void SetOptions(Toolkit &toolkit)
+{
+    toolkit.SetResourcePath(s_resourcePath);
+    toolkit.SetPageHeight(1500);
+}
+
+// Return the measure ids of each system of each page, e.g., "m1 m2 m3 | m4 m5 | ..." for each page
+std::vector<std::string> GetBreaks(Toolkit &toolkit)
+{
+    static const std::regex group("<g class=\"(system|measure)\" id=\"([^\"]*)\"");
+    std::vector<std::string> pages;
+    int pageCount = toolkit.GetPageCount();
+    int i;
+    for (i = 1; i <= pageCount; ++i) {
+        std::string svg = toolkit.RenderToSvg(i);
+        std::string breaks;
+        std::sregex_iterator iter(svg.begin(), svg.end(), group);
+        for (; iter != std::sregex_iterator(); ++iter) {
+            if ((*iter)[1] == "system") {
+                if (!breaks.empty()) breaks += "| ";
+            }
+            else {
+                breaks += (*iter)[2].str() + " ";
+            }
+        }
+        pages.push_back(breaks);
+    }
+    return pages;
+}
+
+void SetEditOptions(Toolkit &toolkit, const Edit &edit)
+{
+    if (!edit.m_font.empty()) toolkit.SetFont(edit.m_font);
+    toolkit.SetEvenNoteSpacing(edit.m_evenSpacing);
+}
+
+bool ApplyEdit(Toolkit &toolkit, const Edit &edit)
+{
+    // The editor methods look for the element on the drawing page
+    int pageNo = toolkit.GetPageWithElement(edit.m_elementId);
+    if (pageNo == 0) return false;
+    toolkit.RenderToSvg(pageNo);
+    if (edit.m_action == "insert") {
+        return toolkit.Insert(edit.m_attrType, edit.m_elementId, edit.m_attrValue);
+    }
+    return toolkit.Set(edit.m_elementId, edit.m_attrType, edit.m_attrValue);
+}
+
+bool TestEdit(const std::string &filename, const Edit &edit)
+{
+    Toolkit edited(false);
+    SetOptions(edited);
+    if (!edited.LoadFile(filename)) return false;
+    GetBreaks(edited);
+
+    if (!ApplyEdit(edited, edit)) {
+        std::cerr << edit.m_name << ": the edit failed" << std::endl;
+        return false;
+    }
+    SetEditOptions(edited, edit);
+    edited.RedoLayout();
+    std::vector<std::string> pages = GetBreaks(edited);
+
+    Toolkit loaded(false);
+    SetOptions(loaded);
+    SetEditOptions(loaded, edit);
+    if (!loaded.LoadData(edited.GetMEI(0, true))) return false;
+    std::vector<std::string> expectedPages = GetBreaks(loaded);
+
+    if (pages.size() != expectedPages.size()) {
+        std::cerr << edit.m_name << ": " << pages.size() << " pages instead of " << expectedPages.size() << std::endl;
+        return false;
+    }
+    int i;
+    for (i = 0; i < (int)pages.size(); ++i) {
+        if (pages.at(i) != expectedPages.at(i)) {
+            std::cerr << edit.m_name << ": page " << i + 1 << " has the systems " << pages.at(i) << "instead of "
+                      << expectedPages.at(i) << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        std::cerr << "Usage: edit_layout_test <resource path> <MEI file>" << std::endl;
+        return 1;
+    }
+    s_resourcePath = argv[1];
+    std::string filename = argv[2];
+
+    DisableLog();
+
+    std::vector<Edit> edits = {
+        { "set-note", "set", "m20s1b1", "pname", "c", "", false },
+        { "set-note-duration", "set", "m20s1b1", "dur", "1", "", false },
+        { "insert-slur", "insert", "m18s1b0", "slur", "m21s1b3", "", false },
+        { "set-keysig", "set", "scoredef9", "key.sig", "7s", "", false },
+        { "set-clef", "set", "clef17", "shape", "C", "", false },
+        { "set-note-font", "set", "m20s1b1", "pname", "c", "Leipzig", false },
+        { "set-note-even-spacing", "set", "m20s1b1", "pname", "c", "", true },
+    };
+
+    int failures = 0;
+    for (auto const &edit : edits) {
+        if (!TestEdit(filename, edit)) {
+            failures++;
+        }
+        else {
+            std::cout << edit.m_name << ": passed" << std::endl;
+        }
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -5,7 +5,9 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <assert.h>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -122,6 +124,9 @@ void display_usage()
     cerr << " --ignore-layout            Ignore all encoded layout information (if any)" << endl;
     cerr << "                            and fully recalculate the layout" << endl;
 
+    cerr << " --lazy-layout              Cast off the pages only when they are rendered (without --all-pages," << endl;
+    cerr << "                            only the pages up to the one selected are cast off)" << endl;
+
     cerr << " --mdiv-xpath-query=QR      Set the xPath query for selecting the <mdiv> to be rendered;" << endl;
     cerr << "                            only one <mdiv> can be rendered" << endl;
 
@@ -140,6 +145,16 @@ void display_usage()
 
     cerr << " --spacing-system=SP        Specify the spacing above each system (in MEI vu)" << endl;
 
+    cerr << " --svg-dom                  Build the SVG as a DOM before writing it (compatibility mode)" << endl;
+
+    cerr << " --threads=INT              Number of threads for importing the parts of MusicXML files," << endl;
+    cerr << "                            for laying out the measures and for rendering the pages in SVG" << endl;
+    cerr << "                            with --all-pages" << endl;
+    cerr << "                            (default is 1)" << endl;
+
+    cerr << " --write-font-cache         Write the binary font caches in the resource directory and exit;" << endl;
+    cerr << "                            the caches are used instead of the XML files when loading the fonts" << endl;
+
     cerr << " --xml-id-seed=INT          Seed the random number generator for XML IDs" << endl;
 
     // Debugging options
@@ -168,12 +183,16 @@ int main(int argc, char **argv)
     int no_layout = 0;
     int hum_type = 0;
     int ignore_layout = 0;
+    int lazy_layout = 0;
     int no_justification = 0;
     int even_note_spacing = 0;
     int show_bounding_boxes = 0;
+    int svg_dom = 0;
     int page = 1;
+    int threads = 1;
     int show_help = 0;
     int show_version = 0;
+    int write_font_cache = 0;
 
     // Create the toolkit instance without loading the font because
     // the resource path might be specified in the parameters
@@ -193,15 +212,18 @@ int main(int argc, char **argv)
         { "even-note-spacing", no_argument, &even_note_spacing, 1 }, { "font", required_argument, 0, 0 },
         { "format", required_argument, 0, 'f' }, { "help", no_argument, &show_help, 1 },
         { "hum-type", no_argument, &hum_type, 1 }, { "ignore-layout", no_argument, &ignore_layout, 1 },
-        { "mdiv-xpath-query", required_argument, 0, 0 }, { "no-layout", no_argument, &no_layout, 1 },
-        { "no-mei-hdr", no_argument, &no_mei_hdr, 1 }, { "no-justification", no_argument, &no_justification, 1 },
-        { "outfile", required_argument, 0, 'o' }, { "page", required_argument, 0, 0 },
-        { "page-height", required_argument, 0, 'h' }, { "page-width", required_argument, 0, 'w' },
-        { "resources", required_argument, 0, 'r' }, { "scale", required_argument, 0, 's' },
-        { "show-bounding-boxes", no_argument, &show_bounding_boxes, 1 }, { "spacing-linear", required_argument, 0, 0 },
-        { "spacing-non-linear", required_argument, 0, 0 }, { "spacing-staff", required_argument, 0, 0 },
-        { "spacing-system", required_argument, 0, 0 }, { "type", required_argument, 0, 't' },
-        { "version", no_argument, &show_version, 1 }, { "xml-id-seed", required_argument, 0, 0 }, { 0, 0, 0, 0 } };
+        { "lazy-layout", no_argument, &lazy_layout, 1 }, { "mdiv-xpath-query", required_argument, 0, 0 },
+        { "no-layout", no_argument, &no_layout, 1 }, { "no-mei-hdr", no_argument, &no_mei_hdr, 1 },
+        { "no-justification", no_argument, &no_justification, 1 }, { "outfile", required_argument, 0, 'o' },
+        { "page", required_argument, 0, 0 }, { "page-height", required_argument, 0, 'h' },
+        { "page-width", required_argument, 0, 'w' }, { "resources", required_argument, 0, 'r' },
+        { "scale", required_argument, 0, 's' }, { "show-bounding-boxes", no_argument, &show_bounding_boxes, 1 },
+        { "spacing-linear", required_argument, 0, 0 }, { "spacing-non-linear", required_argument, 0, 0 },
+        { "spacing-staff", required_argument, 0, 0 }, { "spacing-system", required_argument, 0, 0 },
+        { "svg-dom", no_argument, &svg_dom, 1 }, { "threads", required_argument, 0, 0 },
+        { "type", required_argument, 0, 't' }, { "version", no_argument, &show_version, 1 },
+        { "write-font-cache", no_argument, &write_font_cache, 1 }, { "xml-id-seed", required_argument, 0, 0 },
+        { 0, 0, 0, 0 } };
 
     int option_index = 0;
     while ((c = getopt_long(argc, argv, "b:f:h:o:p:r:s:t:w:v", long_options, &option_index)) != -1) {
@@ -247,8 +269,11 @@ int main(int argc, char **argv)
                         exit(1);
                     }
                 }
+                else if (strcmp(long_options[option_index].name, "threads") == 0) {
+                    threads = atoi(optarg);
+                }
                 else if (strcmp(long_options[option_index].name, "xml-id-seed") == 0) {
-                    Object::SeedUuid(atoi(optarg));
+                    toolkit.SetXmlIdSeed(atoi(optarg));
                 }
                 break;
 
@@ -319,14 +344,31 @@ int main(int argc, char **argv)
         exit(0);
     }
 
+    if (write_font_cache) {
+        // Write the caches for the fonts expected to be loaded, i.e., Bravura, Leipzig and the selected one
+        vector<string> fonts = { "Bravura", "Leipzig" };
+        if (!font.empty() && (std::find(fonts.begin(), fonts.end(), font) == fonts.end())) fonts.push_back(font);
+        for (int i = 0; i < (int)fonts.size(); i++) {
+            if (!Resources::WriteFontCache(fonts.at(i))) {
+                cerr << "The cache for font '" << fonts.at(i) << "' could not be written." << endl;
+                exit(1);
+            }
+        }
+        exit(0);
+    }
+
     // Set the various flags in accordance with the options given
     toolkit.SetAdjustPageHeight(adjust_page_height);
     toolkit.SetNoLayout(no_layout);
     toolkit.SetHumType(hum_type);
     toolkit.SetIgnoreLayout(ignore_layout);
+    toolkit.SetLazyLayout(lazy_layout);
     toolkit.SetNoJustification(no_justification);
     toolkit.SetEvenNoteSpacing(even_note_spacing);
     toolkit.SetShowBoundingBoxes(show_bounding_boxes);
+    toolkit.SetSvgDom(svg_dom);
+    toolkit.SetLayoutThreads(threads);
+    toolkit.SetImportThreads(threads);
 
     if (optind <= argc - 1) {
         infile = string(argv[optind]);
@@ -402,8 +444,8 @@ int main(int argc, char **argv)
     }
 
     if (toolkit.GetOutputFormat() != HUMDRUM) {
-        // Check the page range
-        if (page > toolkit.GetPageCount()) {
+        // Check the page range - the first page always exists, so the entire document does not need to be cast off
+        if ((page > 1) && (page > toolkit.GetPageCount())) {
             cerr << "The page requested (" << page << ") is not in the page range (max is " << toolkit.GetPageCount()
                  << ")." << endl;
             exit(1);
@@ -420,7 +462,21 @@ int main(int argc, char **argv)
         to = toolkit.GetPageCount() + 1;
     }
 
-    if (outformat == "svg") {
+    if ((outformat == "svg") && all_pages && !std_output && (threads > 1)) {
+        std::vector<std::string> svgs = toolkit.RenderAllToSvg(threads, true);
+        int p;
+        for (p = from; p < to; p++) {
+            std::string cur_outfile = outfile + StringFormat("_%03d", p) + ".svg";
+            std::ofstream svgfile(cur_outfile.c_str());
+            if (!svgfile.is_open()) {
+                cerr << "Unable to write SVG to " << cur_outfile << "." << endl;
+                exit(1);
+            }
+            svgfile << svgs.at(p - 1);
+            cerr << "Output written to " << cur_outfile << "." << endl;
+        }
+    }
+    else if (outformat == "svg") {
         int p;
         for (p = from; p < to; p++) {
             std::string cur_outfile = outfile;
@@ -0,0 +1,133 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        toolkit_threads_test.cpp
+// Author:      agent
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+#include "vrv.h"
+
+using namespace vrv;
+
+// Check that toolkits used concurrently, each one with its own resource path and font, give the same SVG as when used
+// one after the other. Meanwhile, another thread keeps changing the process-wide resource path and default font, which
+// must not affect the toolkits having their own.
+// The same resource directory is also given as "<path>/." for having the fonts of two resource paths loaded concurrently.
+//
+// Usage: toolkit_threads_test <resource path> <MEI file>
+
+static const int s_runs = 3;
+
+struct Run {
+    std::string m_resourcePath;
+    std::string m_font;
+};
+
+// Render all the pages with the uuids of the toolkit seeded
+std::string RenderAll(const std::string &filename, const Run &run)
+{
+    Toolkit toolkit(false);
+    toolkit.SetXmlIdSeed(1);
+    if (!toolkit.SetResourcePath(run.m_resourcePath)) return "";
+    if (!toolkit.SetFont(run.m_font)) return "";
+    toolkit.SetPageHeight(1500);
+    if (!toolkit.LoadFile(filename)) return "";
+    std::string svg;
+    int pageCount = toolkit.GetPageCount();
+    int i;
+    for (i = 1; i <= pageCount; ++i) {
+        svg += toolkit.RenderToSvg(i);
+    }
+    return svg;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        std::cerr << "Usage: toolkit_threads_test <resource path> <MEI file>" << std::endl;
+        return 1;
+    }
+    std::string resourcePath = argv[1];
+    std::string filename = argv[2];
+
+    DisableLog();
+
+    std::vector<std::string> fonts = { "Leipzig", "Bravura", "Gootville" };
+
+    // The references, rendered sequentially
+    std::vector<std::string> expected;
+    for (auto const &font : fonts) {
+        std::string svg = RenderAll(filename, { resourcePath, font });
+        if (svg.empty()) {
+            std::cerr << font << ": the file could not be rendered" << std::endl;
+            return 1;
+        }
+        expected.push_back(svg);
+    }
+    if ((expected.at(0) == expected.at(1)) || (expected.at(0) == expected.at(2))) {
+        std::cerr << "The fonts give the same SVG" << std::endl;
+        return 1;
+    }
+
+    std::vector<Run> runs;
+    std::vector<int> expectedIndices;
+    int i;
+    for (i = 0; i < (int)fonts.size(); ++i) {
+        runs.push_back({ resourcePath, fonts.at(i) });
+        expectedIndices.push_back(i);
+        runs.push_back({ resourcePath + "/.", fonts.at(i) });
+        expectedIndices.push_back(i);
+    }
+
+    std::atomic<bool> done(false);
+    std::thread defaults([&]() {
+        // A path without fonts - InitFonts fails and the default font is kept
+        std::vector<std::string> paths = { resourcePath, resourcePath + "/missing" };
+        int j = 0;
+        while (!done) {
+            Resources::SetPath(paths.at(j++ % 2));
+            Resources::InitFonts();
+            Resources::SetFont(fonts.at(j % fonts.size()));
+        }
+    });
+
+    std::vector<std::string> results(runs.size() * s_runs);
+    std::vector<std::thread> threads;
+    for (i = 0; i < (int)runs.size(); ++i) {
+        threads.push_back(std::thread([&, i]() {
+            int j;
+            for (j = 0; j < s_runs; ++j) {
+                results.at(i * s_runs + j) = RenderAll(filename, runs.at(i));
+            }
+        }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    done = true;
+    defaults.join();
+
+    int failures = 0;
+    for (i = 0; i < (int)results.size(); ++i) {
+        const Run &run = runs.at(i / s_runs);
+        if (results.at(i) != expected.at(expectedIndices.at(i / s_runs))) {
+            std::cerr << run.m_font << " (" << run.m_resourcePath << "): run " << i % s_runs + 1
+                      << " differs from the sequential rendering" << std::endl;
+            failures++;
+        }
+    }
+    if (failures == 0) {
+        std::cout << results.size() << " concurrent renderings: passed" << std::endl;
+    }
+
+    return (failures == 0) ? 0 : 1;
+}